@@ -51,7 +51,12 @@ class UsdBaseObject : public helium::RefCounted
     virtual bool doCommitData(UsdDevice* device) = 0; // Data commit, execution can be immediate, returns whether doCommitRefs has to be performed
     virtual void doCommitRefs(UsdDevice* device) = 0; // For updates with dependencies on referenced object's data, is always executed deferred
 
+    // Optional conversion phase of a deferred data commit, performed by the device for the whole commit list before any USD is written
+    virtual bool prepareCommitData(UsdDevice* device) { return false; } // Serial validation, returns whether convertCommitData has to be performed
+    virtual void convertCommitData(UsdDevice* device) {} // Runs concurrently with other objects, so no USD access or status reporting; results are consumed by doCommitData
+
     ANARIDataType type;
+    bool inCommitList = false; // Whether the object is queued in the device's commit lists, see UsdDevice::addToCommitList
 
     friend class UsdDevice;
 
@@ -192,19 +192,54 @@ struct UsdBridgeSettings
   const char* OutputPath;           // Directory for output (on server if HostName is not empty) 
   bool CreateNewSession;            // Find a new session directory on creation of the bridge, or re-use the last opened one (leave contents intact). 
   bool BinaryOutput;                // Select usda or usd output.
+  uint32_t TimestepsPerLayer;       // Move the time samples of the scene into value clip layers of this many timesteps each, 0 keeps them in the scene layer
 
   // Output settings
   bool EnablePreviewSurfaceShader;
   bool EnableMdlShader;
+  bool IndexedPrimvars;              // Write color and attribute primvars with few distinct values as indexed primvars, if that is smaller
+  bool HalfPrecisionOutput;          // Write colors, normals, widths and float attributes as half precision primvars (points are unaffected)
 
   // About to be deprecated
   static constexpr bool EnableStTexCoords = false;
 };
 
+// Optional owner of array memory passed to the bridge. If set, data that already has the exact layout of the USD array
+// is referenced by the authored USD values instead of copied. The owner keeps the memory alive and unmodified
+// for as long as references exist; ReleaseDataRef() may be called from any thread.
+class UsdBridgeDataOwner
+{
+  public:
+    virtual ~UsdBridgeDataOwner() = default;
+
+    virtual void AddDataRef() = 0;
+    virtual void ReleaseDataRef() = 0;
+};
+
+// Optional source of the content hash of array data passed to the bridge, see UsdBridgeDataHash.
+class UsdBridgeDataHashSource
+{
+  public:
+    virtual uint64_t GetDataHash() const = 0; // 0 if unknown
+};
+
+// Content hash of array data, used to skip conversion of unchanged data (0 if unknown).
+// A Source is only asked for the hash when the bridge compares the data against data written earlier for the same attribute,
+// so the hash of data that is never compared is never computed. Source has to stay valid during the bridge call that receives it.
+struct UsdBridgeDataHash
+{
+  uint64_t Get() const { return Source ? Source->GetDataHash() : Value; }
+
+  const UsdBridgeDataHashSource* Source = nullptr;
+  uint64_t Value = 0; // Used if Source is not set
+};
+
 // Generic attribute definition
 struct UsdBridgeAttribute
 {
   const void* Data = nullptr;
+  UsdBridgeDataOwner* DataOwner = nullptr;
+  UsdBridgeDataHash DataHash; // Content hash of Data
   UsdBridgeType DataType = UsdBridgeType::UNDEFINED;
   bool PerPrimData = false;
   uint32_t EltSize = 0;
@@ -240,17 +275,24 @@ struct UsdBridgeMeshData
 
   const void* Points = nullptr;
   UsdBridgeType PointsType = UsdBridgeType::UNDEFINED;
+  UsdBridgeDataOwner* PointsOwner = nullptr;
+  UsdBridgeDataHash PointsHash;
   const void* Normals = nullptr;
   UsdBridgeType NormalsType = UsdBridgeType::UNDEFINED;
+  UsdBridgeDataOwner* NormalsOwner = nullptr;
+  UsdBridgeDataHash NormalsHash;
   bool PerPrimNormals = false;
   const void* Colors = nullptr;
   UsdBridgeType ColorsType = UsdBridgeType::UNDEFINED;
+  UsdBridgeDataHash ColorsHash;
   bool PerPrimColors = false;
   const UsdBridgeAttribute* Attributes = nullptr; // Pointer to externally managed attribute array
   uint32_t NumAttributes = 0;
 
   const void* Indices = nullptr;
   UsdBridgeType IndicesType = UsdBridgeType::UNDEFINED;
+  UsdBridgeDataOwner* IndicesOwner = nullptr;
+  UsdBridgeDataHash IndicesHash;
   uint64_t NumIndices = 0;
 
   int FaceVertexCount = 0;
@@ -286,10 +328,13 @@ struct UsdBridgeInstancerData
   float getUniformScale() const { return Scale.Data[0]; }
 
   bool UseUsdGeomPoints = true; // Shape is sphere and geomPoints is desired
+  uint64_t MaxPointsPerTile = 0; // If nonzero, more points than this are written as spatially sorted child prims (tiles)
 
   uint64_t NumPoints = 0;
   const void* Points = nullptr;
   UsdBridgeType PointsType = UsdBridgeType::UNDEFINED;
+  UsdBridgeDataOwner* PointsOwner = nullptr;
+  UsdBridgeDataHash PointsHash;
   const int* ShapeIndices = nullptr; //if set, one for every point
   const void* Scales = nullptr;// 3-vector scale
   UsdBridgeType ScalesType = UsdBridgeType::UNDEFINED;
@@ -299,6 +344,7 @@ struct UsdBridgeInstancerData
   UsdQuaternion Orientation;// In case no orientations are given
   const void* Colors = nullptr;
   UsdBridgeType ColorsType = UsdBridgeType::UNDEFINED;
+  UsdBridgeDataHash ColorsHash;
   static constexpr bool PerPrimColors = false; // For compatibility
   const float* LinearVelocities = nullptr;
   const float* AngularVelocities = nullptr;
@@ -358,11 +404,16 @@ struct UsdBridgeCurveData
 
   const void* Points = nullptr;
   UsdBridgeType PointsType = UsdBridgeType::UNDEFINED;
+  UsdBridgeDataOwner* PointsOwner = nullptr;
+  UsdBridgeDataHash PointsHash;
   const void* Normals = nullptr;
   UsdBridgeType NormalsType = UsdBridgeType::UNDEFINED;
+  UsdBridgeDataOwner* NormalsOwner = nullptr;
+  UsdBridgeDataHash NormalsHash;
   bool PerPrimNormals = false;
   const void* Colors = nullptr;
   UsdBridgeType ColorsType = UsdBridgeType::UNDEFINED;
+  UsdBridgeDataHash ColorsHash;
   bool PerPrimColors = false; // One prim would be a full curve
   const void* Scales = nullptr; // Used for line width, typically 1-component
   UsdBridgeType ScalesType = UsdBridgeType::UNDEFINED;
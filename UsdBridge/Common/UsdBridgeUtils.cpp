@@ -3,7 +3,26 @@
 
 #include "UsdBridgeUtils.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define USDBRIDGE_SIMD_SSE2
+  #include <emmintrin.h>
+  #if defined(__F16C__)
+    #include <immintrin.h>
+  #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #define USDBRIDGE_SIMD_NEON
+  #include <arm_neon.h>
+#endif
 
 namespace ubutils
 {
@@ -225,4 +244,1457 @@ namespace ubutils
     color[2] = SrgbToLinear(color[2]);
   }
 
-}
\ No newline at end of file
+  namespace
+  {
+    // Jobs of a single ParallelFor call, on the stack of the calling thread
+    struct ParallelBatch
+    {
+      void (*JobFunc)(const void*, size_t) = nullptr;
+      const void* JobFuncData = nullptr;
+      size_t NumJobs = 0;
+      std::atomic<size_t> NextJob{0};
+      unsigned int MaxHelpers = 0; // Workers allowed to join the calling thread
+      // Guarded by the pool mutex
+      unsigned int NumHelpers = 0;
+      size_t NumFinished = 0;
+
+      size_t RunJobs()
+      {
+        size_t numRun = 0;
+        for(size_t jobIdx = NextJob++; jobIdx < NumJobs; jobIdx = NextJob++, ++numRun)
+          JobFunc(JobFuncData, jobIdx);
+        return numRun;
+      }
+    };
+
+    class ThreadPool
+    {
+    public:
+      ~ThreadPool() { Stop(); }
+
+      static ThreadPool& Get()
+      {
+        static ThreadPool pool;
+        return pool;
+      }
+
+      void Run(ParallelBatch& batch, unsigned int numHelpers)
+      {
+        batch.MaxHelpers = numHelpers;
+        {
+          std::lock_guard<std::mutex> lock(PoolMutex);
+          StartWorkers(numHelpers);
+          Batches.push_back(&batch);
+        }
+        WorkCondition.notify_all();
+
+        size_t numRun = batch.RunJobs();
+
+        std::unique_lock<std::mutex> lock(PoolMutex);
+        batch.NumFinished += numRun;
+        Batches.erase(std::find(Batches.begin(), Batches.end(), &batch)); // No more jobs to pick up
+        DoneCondition.wait(lock, [&batch]{ return batch.NumFinished == batch.NumJobs && batch.NumHelpers == 0; });
+      }
+
+      void Acquire()
+      {
+        std::lock_guard<std::mutex> lock(PoolMutex);
+        ++NumHolders;
+      }
+
+      void Release()
+      {
+        bool stop = false;
+        {
+          std::lock_guard<std::mutex> lock(PoolMutex);
+          stop = (--NumHolders == 0);
+        }
+        if(stop)
+          Stop();
+      }
+
+    protected:
+      void StartWorkers(unsigned int numWorkers) // Requires PoolMutex to be locked
+      {
+        while(Workers.size() < numWorkers)
+          Workers.emplace_back(&ThreadPool::WorkerFunc, this);
+      }
+
+      void Stop()
+      {
+        std::vector<std::thread> workers;
+        {
+          std::lock_guard<std::mutex> lock(PoolMutex);
+          workers.swap(Workers);
+          StopWorkers = true;
+        }
+        WorkCondition.notify_all();
+
+        for(std::thread& worker : workers)
+          worker.join();
+
+        std::lock_guard<std::mutex> lock(PoolMutex);
+        StopWorkers = false; // Workers are restarted on the next use
+      }
+
+      ParallelBatch* FindBatch() const // Requires PoolMutex to be locked
+      {
+        for(ParallelBatch* batch : Batches)
+        {
+          if(batch->NumHelpers < batch->MaxHelpers && batch->NextJob < batch->NumJobs)
+            return batch;
+        }
+        return nullptr;
+      }
+
+      void WorkerFunc()
+      {
+        std::unique_lock<std::mutex> lock(PoolMutex);
+        while(true)
+        {
+          ParallelBatch* batch = nullptr;
+          WorkCondition.wait(lock, [this, &batch]{ return StopWorkers || (batch = FindBatch()) != nullptr; });
+          if(StopWorkers)
+            break;
+
+          ++batch->NumHelpers;
+          lock.unlock();
+
+          size_t numRun = batch->RunJobs();
+
+          lock.lock();
+          batch->NumFinished += numRun;
+          --batch->NumHelpers;
+          DoneCondition.notify_all();
+        }
+      }
+
+      std::mutex PoolMutex;
+      std::condition_variable WorkCondition;
+      std::condition_variable DoneCondition;
+      std::vector<std::thread> Workers;
+      std::vector<ParallelBatch*> Batches; // Batches with jobs left to pick up, in order of submission
+      unsigned int NumHolders = 0;
+      bool StopWorkers = false;
+    };
+  }
+
+  unsigned int ResolveNumThreads(unsigned int numThreads)
+  {
+    return numThreads ? numThreads : std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  void AcquireThreadPool()
+  {
+    ThreadPool::Get().Acquire();
+  }
+
+  void ReleaseThreadPool()
+  {
+    ThreadPool::Get().Release();
+  }
+
+  void ParallelForImpl(size_t numJobs, unsigned int numThreads, void (*jobFunc)(const void*, size_t), const void* jobFuncData)
+  {
+    ThreadPool& pool = ThreadPool::Get();
+    numThreads = static_cast<unsigned int>(std::min(static_cast<size_t>(ResolveNumThreads(numThreads)), numJobs));
+
+    if(numThreads <= 1)
+    {
+      for(size_t jobIdx = 0; jobIdx < numJobs; ++jobIdx)
+        jobFunc(jobFuncData, jobIdx);
+      return;
+    }
+
+    ParallelBatch batch;
+    batch.JobFunc = jobFunc;
+    batch.JobFuncData = jobFuncData;
+    batch.NumJobs = numJobs;
+    pool.Run(batch, numThreads - 1);
+  }
+
+  namespace
+  {
+    constexpr uint64_t HashPrime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t HashPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t HashPrime3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t HashPrime4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr uint64_t HashPrime5 = 0x27D4EB2F165667C5ULL;
+
+    inline uint64_t HashRotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+    inline uint64_t HashRead64(const unsigned char* p) { uint64_t v; std::memcpy(&v, p, sizeof(v)); return v; }
+    inline uint32_t HashRead32(const unsigned char* p) { uint32_t v; std::memcpy(&v, p, sizeof(v)); return v; }
+
+    inline uint64_t HashRound(uint64_t acc, uint64_t input)
+    {
+      acc += input * HashPrime2;
+      acc = HashRotl(acc, 31);
+      return acc * HashPrime1;
+    }
+
+    inline uint64_t HashMergeRound(uint64_t acc, uint64_t val)
+    {
+      acc ^= HashRound(0, val);
+      return acc * HashPrime1 + HashPrime4;
+    }
+  }
+
+  uint64_t HashData(const void* data, size_t numBytes, uint64_t seed)
+  {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+    const unsigned char* end = p + numBytes;
+    uint64_t hash;
+
+    if(numBytes >= 32)
+    {
+      const unsigned char* limit = end - 32;
+      uint64_t v1 = seed + HashPrime1 + HashPrime2;
+      uint64_t v2 = seed + HashPrime2;
+      uint64_t v3 = seed;
+      uint64_t v4 = seed - HashPrime1;
+      do
+      {
+        v1 = HashRound(v1, HashRead64(p)); p += 8;
+        v2 = HashRound(v2, HashRead64(p)); p += 8;
+        v3 = HashRound(v3, HashRead64(p)); p += 8;
+        v4 = HashRound(v4, HashRead64(p)); p += 8;
+      } while(p <= limit);
+
+      hash = HashRotl(v1, 1) + HashRotl(v2, 7) + HashRotl(v3, 12) + HashRotl(v4, 18);
+      hash = HashMergeRound(hash, v1);
+      hash = HashMergeRound(hash, v2);
+      hash = HashMergeRound(hash, v3);
+      hash = HashMergeRound(hash, v4);
+    }
+    else
+      hash = seed + HashPrime5;
+
+    hash += static_cast<uint64_t>(numBytes);
+
+    for(; p + 8 <= end; p += 8)
+    {
+      hash ^= HashRound(0, HashRead64(p));
+      hash = HashRotl(hash, 27) * HashPrime1 + HashPrime4;
+    }
+    if(p + 4 <= end)
+    {
+      hash ^= static_cast<uint64_t>(HashRead32(p)) * HashPrime1;
+      hash = HashRotl(hash, 23) * HashPrime2 + HashPrime3;
+      p += 4;
+    }
+    for(; p < end; ++p)
+    {
+      hash ^= (*p) * HashPrime5;
+      hash = HashRotl(hash, 11) * HashPrime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= HashPrime2;
+    hash ^= hash >> 29;
+    hash *= HashPrime3;
+    hash ^= hash >> 32;
+
+    return hash;
+  }
+
+  namespace
+  {
+    // Float to IEEE half conversion, rounding to nearest even like GfHalf. Overflow gives infinity, NaN becomes a quiet NaN.
+    inline uint16_t FloatToHalf(float value)
+    {
+      uint32_t bits; std::memcpy(&bits, &value, sizeof(bits));
+      uint32_t sign = bits & 0x80000000u;
+      bits ^= sign;
+
+      uint32_t half;
+      if(bits >= ((127 + 16) << 23)) // Out of range, infinity or NaN
+        half = (bits > (255u << 23)) ? 0x7E00 : 0x7C00;
+      else if(bits < (113 << 23)) // Subnormal or zero; aligns the mantissa with a magic add, which rounds to nearest even
+      {
+        const uint32_t denormMagicBits = ((127 - 15) + (23 - 10) + 1) << 23;
+        float denormMagic; std::memcpy(&denormMagic, &denormMagicBits, sizeof(denormMagic));
+        float absValue; std::memcpy(&absValue, &bits, sizeof(absValue));
+        absValue += denormMagic;
+        std::memcpy(&half, &absValue, sizeof(half));
+        half -= denormMagicBits;
+      }
+      else // Rebias the exponent and round the mantissa to nearest even
+        half = (bits - ((127u - 15u) << 23) + 0xFFFu + ((bits >> 13) & 1u)) >> 13;
+
+      return static_cast<uint16_t>(half | (sign >> 16));
+    }
+
+    // Minimal 4-wide float layer for the conversion kernels, with a scalar fallback.
+    // All int->float conversions are exact and double->float narrowing rounds to nearest, just like static_cast.
+#if defined(USDBRIDGE_SIMD_SSE2)
+    using SimdFloat4 = __m128;
+
+    inline SimdFloat4 SimdLoad(const float* p) { return _mm_loadu_ps(p); }
+    inline void SimdStore(float* p, SimdFloat4 v) { _mm_storeu_ps(p, v); }
+    inline SimdFloat4 SimdSet(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+    inline SimdFloat4 SimdSplat(float v) { return _mm_set1_ps(v); }
+    inline SimdFloat4 SimdMul(SimdFloat4 a, SimdFloat4 b) { return _mm_mul_ps(a, b); }
+    inline SimdFloat4 SimdDiv(SimdFloat4 a, SimdFloat4 b) { return _mm_div_ps(a, b); }
+    inline SimdFloat4 SimdAdd(SimdFloat4 a, SimdFloat4 b) { return _mm_add_ps(a, b); }
+    inline SimdFloat4 SimdSub(SimdFloat4 a, SimdFloat4 b) { return _mm_sub_ps(a, b); }
+    inline SimdFloat4 SimdSqrt(SimdFloat4 a) { return _mm_sqrt_ps(a); }
+    inline SimdFloat4 SimdMin(SimdFloat4 a, SimdFloat4 b) { return _mm_min_ps(a, b); } // a < b ? a : b
+    inline SimdFloat4 SimdMax(SimdFloat4 a, SimdFloat4 b) { return _mm_max_ps(a, b); } // a > b ? a : b
+
+    using SimdMask4 = __m128;
+    inline SimdMask4 SimdLess(SimdFloat4 a, SimdFloat4 b) { return _mm_cmplt_ps(a, b); } // False for NaN
+    inline SimdFloat4 SimdSelect(SimdMask4 mask, SimdFloat4 a, SimdFloat4 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+    inline SimdFloat4 SimdConvert(const uint8_t* p)
+    {
+      int32_t packed; std::memcpy(&packed, p, sizeof(packed));
+      __m128i zero = _mm_setzero_si128();
+      __m128i ints = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+      return _mm_cvtepi32_ps(ints);
+    }
+    inline SimdFloat4 SimdConvert(const uint16_t* p)
+    {
+      __m128i ints = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128());
+      return _mm_cvtepi32_ps(ints);
+    }
+    inline SimdFloat4 SimdConvert(const double* p)
+    {
+      return _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(p)), _mm_cvtpd_ps(_mm_loadu_pd(p+2)));
+    }
+    inline SimdFloat4 SimdConvertScaled(const uint32_t* p, double scale)
+    {
+      // No unsigned conversion in SSE2; flip into signed range and add the offset back as double (exact)
+      __m128i ints = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi32(std::numeric_limits<int32_t>::min()));
+      __m128d offset = _mm_set1_pd(2147483648.0);
+      __m128d scaleVec = _mm_set1_pd(scale);
+      __m128d lo = _mm_mul_pd(_mm_add_pd(_mm_cvtepi32_pd(ints), offset), scaleVec);
+      __m128d hi = _mm_mul_pd(_mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(ints, _MM_SHUFFLE(3,2,3,2))), offset), scaleVec);
+      return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+    }
+    inline void SimdStoreExpand3(float* p, SimdFloat4 v) // Stores (v0,v0,v0,v1,v1,v1,...)
+    {
+      _mm_storeu_ps(p, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1,0,0,0)));
+      _mm_storeu_ps(p+4, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2,2,1,1)));
+      _mm_storeu_ps(p+8, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3,3,3,2)));
+    }
+    inline void SimdStoreHalf(uint16_t* p, SimdFloat4 v)
+    {
+#if defined(__F16C__)
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+#else
+      // Same steps as FloatToHalf, evaluating all three cases and selecting per lane
+      __m128i bits = _mm_castps_si128(v);
+      __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(std::numeric_limits<int32_t>::min()));
+      bits = _mm_xor_si128(bits, sign);
+
+      __m128i mantOdd = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1));
+      const int32_t rebiasRound = static_cast<int32_t>(0xFFFu - ((127u - 15u) << 23)); // Wraps around, as the addition does
+      __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(rebiasRound)), mantOdd), 13);
+
+      __m128i denormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+      __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(denormMagic))), denormMagic);
+
+      __m128i special = _mm_or_si128(_mm_set1_epi32(0x7C00), _mm_and_si128(_mm_cmpgt_epi32(bits, _mm_set1_epi32(255 << 23)), _mm_set1_epi32(0x0200)));
+
+      __m128i isSpecial = _mm_cmpgt_epi32(bits, _mm_set1_epi32(((127 + 16) << 23) - 1));
+      __m128i isSubnormal = _mm_cmplt_epi32(bits, _mm_set1_epi32(113 << 23));
+      __m128i half = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+      half = _mm_or_si128(_mm_and_si128(isSpecial, special), _mm_andnot_si128(isSpecial, half));
+      half = _mm_or_si128(half, _mm_srli_epi32(sign, 16));
+
+      // Sign extend from 16 bits, so the saturating pack keeps the bit patterns
+      half = _mm_srai_epi32(_mm_slli_epi32(half, 16), 16);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packs_epi32(half, half));
+#endif
+    }
+#elif defined(USDBRIDGE_SIMD_NEON)
+    using SimdFloat4 = float32x4_t;
+
+    inline SimdFloat4 SimdLoad(const float* p) { return vld1q_f32(p); }
+    inline void SimdStore(float* p, SimdFloat4 v) { vst1q_f32(p, v); }
+    inline SimdFloat4 SimdSet(float x, float y, float z, float w) { float v[4] = {x, y, z, w}; return vld1q_f32(v); }
+    inline SimdFloat4 SimdSplat(float v) { return vdupq_n_f32(v); }
+    inline SimdFloat4 SimdMul(SimdFloat4 a, SimdFloat4 b) { return vmulq_f32(a, b); }
+    inline SimdFloat4 SimdDiv(SimdFloat4 a, SimdFloat4 b) { return vdivq_f32(a, b); }
+    inline SimdFloat4 SimdAdd(SimdFloat4 a, SimdFloat4 b) { return vaddq_f32(a, b); }
+    inline SimdFloat4 SimdSub(SimdFloat4 a, SimdFloat4 b) { return vsubq_f32(a, b); }
+    inline SimdFloat4 SimdSqrt(SimdFloat4 a) { return vsqrtq_f32(a); }
+    inline SimdFloat4 SimdMin(SimdFloat4 a, SimdFloat4 b) { return vbslq_f32(vcltq_f32(a, b), a, b); } // Same NaN behavior as SSE
+    inline SimdFloat4 SimdMax(SimdFloat4 a, SimdFloat4 b) { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+
+    using SimdMask4 = uint32x4_t;
+    inline SimdMask4 SimdLess(SimdFloat4 a, SimdFloat4 b) { return vcltq_f32(a, b); }
+    inline SimdFloat4 SimdSelect(SimdMask4 mask, SimdFloat4 a, SimdFloat4 b) { return vbslq_f32(mask, a, b); }
+
+    inline SimdFloat4 SimdConvert(const uint8_t* p)
+    {
+      uint32_t packed; std::memcpy(&packed, p, sizeof(packed));
+      uint16x8_t shorts = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packed)));
+      return vcvtq_f32_u32(vmovl_u16(vget_low_u16(shorts)));
+    }
+    inline SimdFloat4 SimdConvert(const uint16_t* p) { return vcvtq_f32_u32(vmovl_u16(vld1_u16(p))); }
+    inline SimdFloat4 SimdConvert(const double* p) { return vcombine_f32(vcvt_f32_f64(vld1q_f64(p)), vcvt_f32_f64(vld1q_f64(p+2))); }
+    inline SimdFloat4 SimdConvertScaled(const uint32_t* p, double scale)
+    {
+      uint32x4_t ints = vld1q_u32(p);
+      float64x2_t lo = vmulq_n_f64(vcvtq_f64_u64(vmovl_u32(vget_low_u32(ints))), scale);
+      float64x2_t hi = vmulq_n_f64(vcvtq_f64_u64(vmovl_u32(vget_high_u32(ints))), scale);
+      return vcombine_f32(vcvt_f32_f64(lo), vcvt_f32_f64(hi));
+    }
+    inline void SimdStoreExpand3(float* p, SimdFloat4 v)
+    {
+      float32x4x3_t triple = {{v, v, v}};
+      vst3q_f32(p, triple);
+    }
+    inline void SimdStoreHalf(uint16_t* p, SimdFloat4 v) { vst1_u16(p, vreinterpret_u16_f16(vcvt_f16_f32(v))); }
+#else
+    struct SimdFloat4 { float v[4]; };
+
+    inline SimdFloat4 SimdLoad(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+    inline void SimdStore(float* p, SimdFloat4 v) { std::memcpy(p, v.v, sizeof(v.v)); }
+    inline SimdFloat4 SimdSet(float x, float y, float z, float w) { return {{x, y, z, w}}; }
+    inline SimdFloat4 SimdSplat(float v) { return {{v, v, v, v}}; }
+    inline SimdFloat4 SimdMul(SimdFloat4 a, SimdFloat4 b) { return {{a.v[0]*b.v[0], a.v[1]*b.v[1], a.v[2]*b.v[2], a.v[3]*b.v[3]}}; }
+    inline SimdFloat4 SimdDiv(SimdFloat4 a, SimdFloat4 b) { return {{a.v[0]/b.v[0], a.v[1]/b.v[1], a.v[2]/b.v[2], a.v[3]/b.v[3]}}; }
+    inline SimdFloat4 SimdAdd(SimdFloat4 a, SimdFloat4 b) { return {{a.v[0]+b.v[0], a.v[1]+b.v[1], a.v[2]+b.v[2], a.v[3]+b.v[3]}}; }
+    inline SimdFloat4 SimdSub(SimdFloat4 a, SimdFloat4 b) { return {{a.v[0]-b.v[0], a.v[1]-b.v[1], a.v[2]-b.v[2], a.v[3]-b.v[3]}}; }
+    inline SimdFloat4 SimdSqrt(SimdFloat4 a) { return {{sqrtf(a.v[0]), sqrtf(a.v[1]), sqrtf(a.v[2]), sqrtf(a.v[3])}}; }
+    inline SimdFloat4 SimdMin(SimdFloat4 a, SimdFloat4 b) { SimdFloat4 r; for(int i = 0; i < 4; ++i) r.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return r; }
+    inline SimdFloat4 SimdMax(SimdFloat4 a, SimdFloat4 b) { SimdFloat4 r; for(int i = 0; i < 4; ++i) r.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return r; }
+
+    struct SimdMask4 { bool v[4]; };
+    inline SimdMask4 SimdLess(SimdFloat4 a, SimdFloat4 b) { return {{a.v[0] < b.v[0], a.v[1] < b.v[1], a.v[2] < b.v[2], a.v[3] < b.v[3]}}; }
+    inline SimdFloat4 SimdSelect(SimdMask4 mask, SimdFloat4 a, SimdFloat4 b) { SimdFloat4 r; for(int i = 0; i < 4; ++i) r.v[i] = mask.v[i] ? a.v[i] : b.v[i]; return r; }
+
+    template<typename InputType>
+    inline SimdFloat4 SimdConvert(const InputType* p) { return {{(float)p[0], (float)p[1], (float)p[2], (float)p[3]}}; }
+    inline SimdFloat4 SimdConvertScaled(const uint32_t* p, double scale) { return {{(float)(p[0]*scale), (float)(p[1]*scale), (float)(p[2]*scale), (float)(p[3]*scale)}}; }
+    inline void SimdStoreExpand3(float* p, SimdFloat4 v)
+    {
+      for(int i = 0; i < 4; ++i)
+        p[i*3] = p[i*3+1] = p[i*3+2] = v.v[i];
+    }
+    inline void SimdStoreHalf(uint16_t* p, SimdFloat4 v)
+    {
+      for(int i = 0; i < 4; ++i)
+        p[i] = FloatToHalf(v.v[i]);
+    }
+#endif
+
+    // Copies a tuple of numComponents into 4 lanes, padded with (0,0,fill)
+    template<int numComponents, typename InputType>
+    inline const InputType* PadTo4(const InputType* input, InputType fill, InputType* padded)
+    {
+      if(numComponents == 4)
+        return input;
+      padded[0] = input[0];
+      padded[1] = (numComponents > 1) ? input[1] : InputType(0);
+      padded[2] = (numComponents > 2) ? input[2] : InputType(0);
+      padded[3] = fill;
+      return padded;
+    }
+
+    template<int numComponents, typename InputType, typename ConvertFunc>
+    void ExpandToFloat4Kernel(const InputType* input, size_t numElements, float* output, InputType fill, const ConvertFunc& convert4)
+    {
+      InputType padded[4];
+      size_t i = 0;
+      if(numComponents < 4)
+      {
+        // Convert 4 consecutive values directly from the input and replace the lanes past the tuple by the converted padding,
+        // as lanes convert independently; avoids reloading the padded copy, which stalls on store forwarding.
+        // The last elements would read past the input and take the padded path.
+        InputType zeros[4] = {};
+        SimdFloat4 convertedPad = convert4(PadTo4<1>(zeros, fill, padded));
+        SimdMask4 tupleLanes = SimdLess(SimdSet(0.0f, 1.0f, 2.0f, 3.0f), SimdSplat((float)numComponents));
+        size_t numDirect = (numElements*numComponents >= 4) ? (numElements*numComponents - 4) / numComponents + 1 : 0;
+        for(; i < numDirect; ++i, input += numComponents, output += 4)
+          SimdStore(output, SimdSelect(tupleLanes, convert4(input), convertedPad));
+      }
+      for(; i < numElements; ++i, input += numComponents, output += 4)
+        SimdStore(output, convert4(PadTo4<numComponents>(input, fill, padded)));
+    }
+
+    template<typename InputType, typename ConvertFunc>
+    void ExpandToFloat4Dispatch(const InputType* input, int numComponents, size_t numElements, float* output, InputType fill, const ConvertFunc& convert4)
+    {
+      switch(numComponents)
+      {
+        case 1: ExpandToFloat4Kernel<1>(input, numElements, output, fill, convert4); break;
+        case 2: ExpandToFloat4Kernel<2>(input, numElements, output, fill, convert4); break;
+        case 3: ExpandToFloat4Kernel<3>(input, numElements, output, fill, convert4); break;
+        case 4: ExpandToFloat4Kernel<4>(input, numElements, output, fill, convert4); break;
+        default: break;
+      }
+    }
+
+    template<typename InputType>
+    void ExpandToFloat4NormalizedImpl(const InputType* input, int numComponents, size_t numElements, float* output)
+    {
+      // Division by max in float gives the same results as multiplying with a double-precision reciprocal for 8/16 bit input
+      SimdFloat4 normDivisor = SimdSplat((float)std::numeric_limits<InputType>::max());
+      ExpandToFloat4Dispatch(input, numComponents, numElements, output, std::numeric_limits<InputType>::max(),
+        [normDivisor](const InputType* p) { return SimdDiv(SimdConvert(p), normDivisor); });
+    }
+
+    template<typename InputType>
+    void ExpandToFloat3Impl(const InputType* input, size_t numElements, float* output)
+    {
+      size_t i = 0;
+      for(; i + 4 <= numElements; i += 4)
+      {
+        const InputType* in = input + i;
+        SimdFloat4 values;
+        if constexpr (std::is_same<InputType, float>::value)
+          values = SimdLoad(in);
+        else
+          values = SimdConvert(in);
+        SimdStoreExpand3(output + i*3, values);
+      }
+      for(; i < numElements; ++i)
+        output[i*3] = output[i*3+1] = output[i*3+2] = (float)input[i];
+    }
+    inline SimdFloat4 SimdLoadAsFloat(const float* p) { return SimdLoad(p); }
+    inline SimdFloat4 SimdLoadAsFloat(const double* p) { return SimdConvert(p); }
+
+    struct Float3Bounds
+    {
+      float Min[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+      float Max[3] = { -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max() };
+
+      void Union(const float* minPt, const float* maxPt) // NaN components are ignored
+      {
+        for(int c = 0; c < 3; ++c)
+        {
+          Min[c] = (minPt[c] < Min[c]) ? minPt[c] : Min[c];
+          Max[c] = (maxPt[c] > Max[c]) ? maxPt[c] : Max[c];
+        }
+      }
+    };
+
+    template<typename InputType>
+    Float3Bounds ConvertToFloat3WithBoundsRange(const InputType* input, size_t begin, size_t end, float* output)
+    {
+      // Four xyz points form three full vectors, so that vector lanes cycle through the components (xyzx, yzxy, zxyz)
+      SimdFloat4 minVec[3], maxVec[3];
+      for(int v = 0; v < 3; ++v)
+      {
+        minVec[v] = SimdSplat(std::numeric_limits<float>::max());
+        maxVec[v] = SimdSplat(-std::numeric_limits<float>::max());
+      }
+
+      size_t i = begin;
+      for(; i + 4 <= end; i += 4)
+      {
+        for(int v = 0; v < 3; ++v)
+        {
+          SimdFloat4 pts = SimdLoadAsFloat(input + i*3 + v*4);
+          if(output)
+            SimdStore(output + i*3 + v*4, pts);
+          minVec[v] = SimdMin(pts, minVec[v]);
+          maxVec[v] = SimdMax(pts, maxVec[v]);
+        }
+      }
+
+      // Stored consecutively, the lanes are xyz triples again
+      float minLanes[12], maxLanes[12];
+      for(int v = 0; v < 3; ++v)
+      {
+        SimdStore(minLanes + v*4, minVec[v]);
+        SimdStore(maxLanes + v*4, maxVec[v]);
+      }
+      Float3Bounds bounds;
+      for(int l = 0; l < 12; l += 3)
+        bounds.Union(minLanes + l, maxLanes + l);
+
+      for(; i < end; ++i)
+      {
+        float pt[3] = { (float)input[i*3], (float)input[i*3+1], (float)input[i*3+2] };
+        if(output)
+          std::memcpy(output + i*3, pt, sizeof(pt));
+        bounds.Union(pt, pt);
+      }
+      return bounds;
+    }
+
+    template<typename InputType>
+    void ConvertToFloat3WithBoundsImpl(const InputType* input, size_t numPoints, float* output, float* boundsMin, float* boundsMax, unsigned int numThreads)
+    {
+      constexpr size_t chunkSize = 1 << 16;
+      constexpr size_t parallelThreshold = 4 * chunkSize;
+
+      numThreads = ResolveNumThreads(numThreads);
+      Float3Bounds bounds;
+      if(numPoints < parallelThreshold || numThreads == 1)
+      {
+        bounds = ConvertToFloat3WithBoundsRange(input, 0, numPoints, output);
+      }
+      else
+      {
+        size_t numChunks = (numPoints + chunkSize - 1) / chunkSize;
+        std::vector<Float3Bounds> chunkBounds(numChunks);
+        ParallelFor(numChunks, numThreads, [input, numPoints, output, &chunkBounds](size_t chunkIdx)
+        {
+          size_t begin = chunkIdx * chunkSize;
+          chunkBounds[chunkIdx] = ConvertToFloat3WithBoundsRange(input, begin, std::min(begin + chunkSize, numPoints), output);
+        });
+        for(const Float3Bounds& chunk : chunkBounds)
+          bounds.Union(chunk.Min, chunk.Max);
+      }
+      std::memcpy(boundsMin, bounds.Min, sizeof(bounds.Min));
+      std::memcpy(boundsMax, bounds.Max, sizeof(bounds.Max));
+    }
+
+    // Interleaves the lower 21 bits of value with two zero bits each
+    uint64_t SpreadMortonBits(uint64_t value)
+    {
+      value &= 0x1FFFFFULL;
+      value = (value | value << 32) & 0x1F00000000FFFFULL;
+      value = (value | value << 16) & 0x1F0000FF0000FFULL;
+      value = (value | value << 8) & 0x100F00F00F00F00FULL;
+      value = (value | value << 4) & 0x10C30C30C30C30C3ULL;
+      value = (value | value << 2) & 0x1249249249249249ULL;
+      return value;
+    }
+
+    template<typename InputType>
+    void MortonOrderImpl(const InputType* points, size_t numPoints, std::vector<uint64_t>& order, unsigned int numThreads)
+    {
+      static constexpr size_t maxChunkSize = 1 << 16;
+      static constexpr int radixBits = 8;
+      static constexpr size_t numBuckets = size_t(1) << radixBits;
+      static constexpr int numCodeBits = 63;
+      static constexpr double maxCell = double((1 << 21) - 1);
+
+      order.resize(numPoints);
+      if(!numPoints)
+        return;
+
+      float boundsMin[3], boundsMax[3];
+      ConvertToFloat3WithBoundsImpl(points, numPoints, nullptr, boundsMin, boundsMax, numThreads);
+      double cellScale[3];
+      for(int c = 0; c < 3; ++c)
+      {
+        double extent = double(boundsMax[c]) - double(boundsMin[c]);
+        cellScale[c] = (extent > 0.0) ? maxCell / extent : 0.0;
+      }
+
+      // Without worker threads, a single chunk saves the per-chunk histograms
+      numThreads = ResolveNumThreads(numThreads);
+      size_t chunkSize = (numThreads > 1) ? maxChunkSize : numPoints;
+      size_t numChunks = (numPoints + chunkSize - 1) / chunkSize;
+      std::vector<uint64_t> codes(numPoints);
+      ParallelFor(numChunks, numThreads, [points, numPoints, chunkSize, &boundsMin, &cellScale, &codes, &order](size_t chunkIdx)
+      {
+        size_t begin = chunkIdx * chunkSize;
+        size_t end = std::min(begin + chunkSize, numPoints);
+        for(size_t i = begin; i < end; ++i)
+        {
+          uint64_t code = 0;
+          for(int c = 0; c < 3; ++c)
+          {
+            double cell = (double(points[i*3+c]) - double(boundsMin[c])) * cellScale[c];
+            uint64_t cellIdx = (cell > 0.0) ? static_cast<uint64_t>(std::min(cell, maxCell)) : 0; // Also maps NaN to 0
+            code |= SpreadMortonBits(cellIdx) << c;
+          }
+          codes[i] = code;
+          order[i] = i;
+        }
+      });
+
+      // LSD radix sort of (code, index) pairs; each chunk scatters to its own range per digit, which keeps the sort stable
+      std::vector<uint64_t> tempCodes(numPoints), tempOrder(numPoints);
+      std::vector<size_t> chunkOffsets(numChunks*numBuckets);
+      for(int shift = 0; shift < numCodeBits; shift += radixBits)
+      {
+        ParallelFor(numChunks, numThreads, [numPoints, chunkSize, shift, &codes, &chunkOffsets](size_t chunkIdx)
+        {
+          size_t* histogram = chunkOffsets.data() + chunkIdx*numBuckets;
+          std::fill(histogram, histogram + numBuckets, size_t(0));
+          size_t begin = chunkIdx * chunkSize;
+          size_t end = std::min(begin + chunkSize, numPoints);
+          for(size_t i = begin; i < end; ++i)
+            ++histogram[(codes[i] >> shift) & (numBuckets-1)];
+        });
+
+        bool singleDigit = false;
+        size_t offset = 0;
+        for(size_t bucket = 0; bucket < numBuckets; ++bucket)
+        {
+          size_t bucketBegin = offset;
+          for(size_t chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx)
+          {
+            size_t& chunkOffset = chunkOffsets[chunkIdx*numBuckets + bucket];
+            size_t count = chunkOffset;
+            chunkOffset = offset;
+            offset += count;
+          }
+          singleDigit = singleDigit || (offset - bucketBegin == numPoints);
+        }
+        if(singleDigit)
+          continue; // The pass would not change the order
+
+        ParallelFor(numChunks, numThreads, [numPoints, chunkSize, shift, &codes, &order, &tempCodes, &tempOrder, &chunkOffsets](size_t chunkIdx)
+        {
+          size_t* offsets = chunkOffsets.data() + chunkIdx*numBuckets;
+          size_t begin = chunkIdx * chunkSize;
+          size_t end = std::min(begin + chunkSize, numPoints);
+          for(size_t i = begin; i < end; ++i)
+          {
+            size_t dest = offsets[(codes[i] >> shift) & (numBuckets-1)]++;
+            tempCodes[dest] = codes[i];
+            tempOrder[dest] = order[i];
+          }
+        });
+        codes.swap(tempCodes);
+        order.swap(tempOrder);
+      }
+    }
+
+    template<typename InputType>
+    void DirectionsToQuaternionsZImpl(const InputType* dirs, size_t numDirs, float* quats)
+    {
+      const SimdFloat4 zero = SimdSplat(0.0f);
+      const SimdFloat4 one = SimdSplat(1.0f);
+      // GfRotation::SetRotateInto treats directions with |cos| > 0.9999999 (with z) as parallel; in terms of sin^2 = 1 - cos^2,
+      // which unlike the cosine is precise in float this close to the axis
+      const SimdFloat4 parallelSin2 = SimdSplat((float)(1.0 - 0.9999999*0.9999999));
+
+      for(size_t dirIdx = 0; dirIdx < numDirs; dirIdx += 4)
+      {
+        // Four directions at a time in SoA form; unused lanes are zero-length
+        size_t numLanes = std::min<size_t>(4, numDirs - dirIdx);
+        float x[4] = {0.0f, 0.0f, 0.0f, 0.0f}, y[4] = {0.0f, 0.0f, 0.0f, 0.0f}, z[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        for(size_t lane = 0; lane < numLanes; ++lane)
+        {
+          const InputType* dir = dirs + (dirIdx + lane)*3;
+          x[lane] = (float)dir[0]; y[lane] = (float)dir[1]; z[lane] = (float)dir[2];
+        }
+        SimdFloat4 dirX = SimdLoad(x), dirY = SimdLoad(y), dirZ = SimdLoad(z);
+
+        // Scale by the largest component, so squares neither overflow nor underflow
+        SimdFloat4 maxComp = SimdMax(SimdMax(SimdMax(dirX, SimdSub(zero, dirX)), SimdMax(dirY, SimdSub(zero, dirY))), SimdMax(dirZ, SimdSub(zero, dirZ)));
+        SimdFloat4 invMaxComp = SimdDiv(one, maxComp);
+        dirX = SimdMul(dirX, invMaxComp);
+        dirY = SimdMul(dirY, invMaxComp);
+        dirZ = SimdMul(dirZ, invMaxComp);
+
+        SimdFloat4 dirXY2 = SimdAdd(SimdMul(dirX, dirX), SimdMul(dirY, dirY));
+        SimdFloat4 dirLength2 = SimdAdd(dirXY2, SimdMul(dirZ, dirZ));
+        SimdFloat4 dirLength = SimdSqrt(dirLength2);
+
+        // The rotation from z to n is the normalized (cross(z, n), |n| + dot(z, n)), which halves the angle.
+        // Towards -z, |n| + n.z cancels out; (n.x^2 + n.y^2) / (|n| - n.z) is equal and keeps precision.
+        SimdMask4 negativeZ = SimdLess(dirZ, zero);
+        SimdFloat4 quatI = SimdSub(zero, dirY);
+        SimdFloat4 quatJ = dirX;
+        SimdFloat4 quatR = SimdSelect(negativeZ, SimdDiv(dirXY2, SimdSub(dirLength, dirZ)), SimdAdd(dirLength, dirZ));
+        SimdFloat4 quatLength2 = SimdAdd(SimdAdd(SimdMul(quatI, quatI), SimdMul(quatJ, quatJ)), SimdMul(quatR, quatR));
+        SimdFloat4 invQuatLength = SimdDiv(one, SimdSqrt(quatLength2));
+        quatI = SimdMul(quatI, invQuatLength);
+        quatJ = SimdMul(quatJ, invQuatLength);
+        quatR = SimdMul(quatR, invQuatLength);
+
+        // (Nearly) opposite to z: half a turn around the y axis, (nearly) along z: identity, as chosen by GfRotation
+        SimdMask4 parallel = SimdLess(dirXY2, SimdMul(parallelSin2, dirLength2));
+        quatI = SimdSelect(parallel, zero, quatI);
+        quatJ = SimdSelect(parallel, SimdSelect(negativeZ, one, zero), quatJ);
+        quatR = SimdSelect(parallel, SimdSelect(negativeZ, zero, one), quatR);
+
+        // Zero-length or invalid directions: identity as well
+        SimdMask4 valid = SimdLess(zero, dirLength2);
+        quatI = SimdSelect(valid, quatI, zero);
+        quatJ = SimdSelect(valid, quatJ, zero);
+        quatR = SimdSelect(valid, quatR, one);
+
+        float outI[4], outJ[4], outR[4];
+        SimdStore(outI, quatI);
+        SimdStore(outJ, quatJ);
+        SimdStore(outR, quatR);
+        for(size_t lane = 0; lane < numLanes; ++lane)
+        {
+          float* quat = quats + (dirIdx + lane)*4;
+          quat[0] = outI[lane]; quat[1] = outJ[lane]; quat[2] = 0.0f; quat[3] = outR[lane];
+        }
+      }
+    }
+
+    // Symmetric 4x4 matrix of the summed squared distances to a set of weighted planes (a,b,c,d), in double precision
+    struct DecimationQuadric
+    {
+      double Coeffs[10] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}; // aa ab ac ad bb bc bd cc cd dd
+
+      void AddPlane(double a, double b, double c, double d, double weight)
+      {
+        Coeffs[0] += weight*a*a; Coeffs[1] += weight*a*b; Coeffs[2] += weight*a*c; Coeffs[3] += weight*a*d;
+        Coeffs[4] += weight*b*b; Coeffs[5] += weight*b*c; Coeffs[6] += weight*b*d;
+        Coeffs[7] += weight*c*c; Coeffs[8] += weight*c*d;
+        Coeffs[9] += weight*d*d;
+      }
+
+      void Add(const DecimationQuadric& other)
+      {
+        for(int i = 0; i < 10; ++i)
+          Coeffs[i] += other.Coeffs[i];
+      }
+
+      double GetWeight() const { return Coeffs[0] + Coeffs[4] + Coeffs[7]; } // Sum of the plane weights
+
+      double Evaluate(const double* p) const
+      {
+        const double* q = Coeffs;
+        return q[0]*p[0]*p[0] + 2.0*q[1]*p[0]*p[1] + 2.0*q[2]*p[0]*p[2] + 2.0*q[3]*p[0]
+          + q[4]*p[1]*p[1] + 2.0*q[5]*p[1]*p[2] + 2.0*q[6]*p[1]
+          + q[7]*p[2]*p[2] + 2.0*q[8]*p[2]
+          + q[9];
+      }
+    };
+
+    struct DecimationCollapse
+    {
+      float Cost;
+      uint32_t From; // Vertex that is merged into To
+      uint32_t To;
+
+      bool operator<(const DecimationCollapse& rhs) const { return Cost < rhs.Cost; }
+    };
+
+    struct DecimationNeighbor
+    {
+      uint32_t Vertex;
+      uint32_t NumTriangles; // Number of triangles sharing the edge to Vertex
+      uint32_t Triangle; // Last of those triangles
+
+      bool operator<(const DecimationNeighbor& rhs) const { return Vertex < rhs.Vertex; }
+    };
+
+    // Quadric error metric simplification (Garland-Heckbert) by half-edge collapses, ie. every collapse merges a vertex into one of its neighbors,
+    // so the remaining vertices are a subset of the source vertices. Instead of a priority queue, collapses are performed in passes over all edges
+    // sorted by cost, where a vertex can only be involved in one collapse per pass. Collapses which would flip a triangle or make the mesh
+    // non-manifold are rejected, and boundaries are preserved by additional planes perpendicular to their triangles.
+    template<typename InputType>
+    void DecimateTrianglesImpl(const InputType* points, size_t numPoints, const uint64_t* indices, size_t numTriangles, size_t targetTriangles,
+      std::vector<uint64_t>& keptTriangles, std::vector<uint64_t>& outIndices)
+    {
+      static constexpr double boundaryWeight = 10.0;
+      static constexpr double edgeLengthWeight = 1e-3;
+      static constexpr double minFlipCosine = 0.2; // Minimum cosine between a triangle's normals before and after a collapse
+
+      keptTriangles.resize(0);
+      outIndices.resize(0);
+      if(numPoints >= std::numeric_limits<uint32_t>::max() || numTriangles >= std::numeric_limits<uint32_t>::max())
+        return;
+
+      auto getPos = [points](uint32_t vertIdx, double* pos)
+      {
+        const InputType* point = points + size_t(vertIdx)*3;
+        pos[0] = (double)point[0]; pos[1] = (double)point[1]; pos[2] = (double)point[2];
+      };
+      auto cross = [](const double* e1, const double* e2, double* result)
+      {
+        result[0] = e1[1]*e2[2] - e1[2]*e2[1];
+        result[1] = e1[2]*e2[0] - e1[0]*e2[2];
+        result[2] = e1[0]*e2[1] - e1[1]*e2[0];
+      };
+      auto getTriangleNormal = [&cross](const double* p0, const double* p1, const double* p2, double* normal)
+      {
+        double e1[3] = {p1[0]-p0[0], p1[1]-p0[1], p1[2]-p0[2]};
+        double e2[3] = {p2[0]-p0[0], p2[1]-p0[1], p2[2]-p0[2]};
+        cross(e1, e2, normal);
+      };
+
+      std::vector<uint32_t> triVerts(numTriangles*3);
+      std::vector<bool> triRemoved(numTriangles, false);
+      size_t numLiveTriangles = numTriangles;
+      for(size_t triIdx = 0; triIdx < numTriangles; ++triIdx)
+      {
+        uint32_t* tri = triVerts.data() + triIdx*3;
+        for(int corner = 0; corner < 3; ++corner)
+          tri[corner] = static_cast<uint32_t>(indices[triIdx*3 + corner]);
+        if(tri[0] == tri[1] || tri[1] == tri[2] || tri[2] == tri[0])
+        {
+          triRemoved[triIdx] = true; // Degenerate triangles are left out
+          --numLiveTriangles;
+        }
+      }
+
+      // Triangles around each vertex, as ranges into triPool. After a collapse, the merged vertex gets a new range appended to the pool.
+      std::vector<size_t> vertTriBegin(numPoints + 1, 0);
+      for(uint32_t vertIdx : triVerts)
+        ++vertTriBegin[vertIdx + 1];
+      for(size_t vertIdx = 0; vertIdx < numPoints; ++vertIdx)
+        vertTriBegin[vertIdx + 1] += vertTriBegin[vertIdx];
+      std::vector<uint32_t> vertTriCount(numPoints);
+      for(size_t vertIdx = 0; vertIdx < numPoints; ++vertIdx)
+        vertTriCount[vertIdx] = static_cast<uint32_t>(vertTriBegin[vertIdx + 1] - vertTriBegin[vertIdx]);
+      std::vector<uint32_t> triPool(triVerts.size());
+      {
+        std::vector<size_t> fillPos(vertTriBegin.begin(), vertTriBegin.end() - 1);
+        for(size_t i = 0; i < triVerts.size(); ++i)
+          triPool[fillPos[triVerts[i]]++] = static_cast<uint32_t>(i / 3);
+      }
+
+      auto forEachTriangle = [&](uint32_t vertIdx, const auto& func)
+      {
+        size_t triBegin = vertTriBegin[vertIdx], triEnd = triBegin + vertTriCount[vertIdx];
+        for(size_t i = triBegin; i < triEnd; ++i) // Indexed, as func may append to the pool
+        {
+          uint32_t triIdx = triPool[i];
+          if(!triRemoved[triIdx])
+            func(triIdx);
+        }
+      };
+
+      auto collectNeighbors = [&](uint32_t vertIdx, std::vector<DecimationNeighbor>& neighbors)
+      {
+        neighbors.resize(0);
+        forEachTriangle(vertIdx, [&](uint32_t triIdx)
+        {
+          const uint32_t* tri = triVerts.data() + size_t(triIdx)*3;
+          for(int corner = 0; corner < 3; ++corner)
+            if(tri[corner] != vertIdx)
+              neighbors.push_back({tri[corner], 1, triIdx});
+        });
+        std::sort(neighbors.begin(), neighbors.end());
+        size_t numUnique = 0;
+        for(size_t i = 0; i < neighbors.size(); ++i)
+        {
+          if(numUnique && neighbors[numUnique-1].Vertex == neighbors[i].Vertex)
+          {
+            ++neighbors[numUnique-1].NumTriangles;
+            neighbors[numUnique-1].Triangle = neighbors[i].Triangle;
+          }
+          else
+            neighbors[numUnique++] = neighbors[i];
+        }
+        neighbors.resize(numUnique);
+      };
+
+      // Area weighted triangle planes
+      std::vector<DecimationQuadric> quadrics(numPoints);
+      for(size_t triIdx = 0; triIdx < numTriangles; ++triIdx)
+      {
+        if(triRemoved[triIdx])
+          continue;
+        const uint32_t* tri = triVerts.data() + triIdx*3;
+        double p0[3], p1[3], p2[3], normal[3];
+        getPos(tri[0], p0); getPos(tri[1], p1); getPos(tri[2], p2);
+        getTriangleNormal(p0, p1, p2, normal);
+        double length = std::sqrt(normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2]);
+        if(length == 0.0)
+          continue;
+        double a = normal[0]/length, b = normal[1]/length, c = normal[2]/length;
+        double d = -(a*p0[0] + b*p0[1] + c*p0[2]);
+        for(int corner = 0; corner < 3; ++corner)
+          quadrics[tri[corner]].AddPlane(a, b, c, d, 0.5*length);
+      }
+
+      // Boundary edges (part of a single triangle) add the plane through the edge perpendicular to the triangle, half to each endpoint
+      std::vector<bool> vertBoundary(numPoints, false);
+      std::vector<DecimationNeighbor> neighbors, toNeighbors;
+      for(uint32_t vertIdx = 0; vertIdx < numPoints; ++vertIdx)
+      {
+        collectNeighbors(vertIdx, neighbors);
+        for(const DecimationNeighbor& neighbor : neighbors)
+        {
+          if(neighbor.NumTriangles != 1)
+            continue;
+          vertBoundary[vertIdx] = true;
+
+          const uint32_t* tri = triVerts.data() + size_t(neighbor.Triangle)*3;
+          double p0[3], p1[3], p2[3], triNormal[3], edgeStart[3], edgeEnd[3], planeNormal[3];
+          getPos(tri[0], p0); getPos(tri[1], p1); getPos(tri[2], p2);
+          getTriangleNormal(p0, p1, p2, triNormal);
+          getPos(vertIdx, edgeStart); getPos(neighbor.Vertex, edgeEnd);
+          double edgeDir[3] = {edgeEnd[0]-edgeStart[0], edgeEnd[1]-edgeStart[1], edgeEnd[2]-edgeStart[2]};
+          cross(edgeDir, triNormal, planeNormal);
+          double length = std::sqrt(planeNormal[0]*planeNormal[0] + planeNormal[1]*planeNormal[1] + planeNormal[2]*planeNormal[2]);
+          if(length == 0.0)
+            continue;
+          double a = planeNormal[0]/length, b = planeNormal[1]/length, c = planeNormal[2]/length;
+          double d = -(a*edgeStart[0] + b*edgeStart[1] + c*edgeStart[2]);
+          double weight = 0.5*boundaryWeight*(edgeDir[0]*edgeDir[0] + edgeDir[1]*edgeDir[1] + edgeDir[2]*edgeDir[2]);
+          quadrics[vertIdx].AddPlane(a, b, c, d, weight);
+        }
+      }
+
+      std::vector<bool> vertRemoved(numPoints, false);
+      std::vector<uint32_t> vertLockPass(numPoints, 0); // Last pass in which the neighborhood of a vertex has changed
+      std::vector<DecimationCollapse> collapses;
+      for(uint32_t pass = 1; numLiveTriangles > targetTriangles; ++pass)
+      {
+        // Cheapest collapse direction of every edge
+        collapses.resize(0);
+        for(uint32_t vertIdx = 0; vertIdx < numPoints; ++vertIdx)
+        {
+          if(vertRemoved[vertIdx])
+            continue;
+          collectNeighbors(vertIdx, neighbors);
+          for(const DecimationNeighbor& neighbor : neighbors)
+          {
+            uint32_t v0 = vertIdx, v1 = neighbor.Vertex;
+            if(v1 < v0)
+              continue;
+
+            DecimationQuadric edgeQuadric = quadrics[v0];
+            edgeQuadric.Add(quadrics[v1]);
+            double p0[3], p1[3];
+            getPos(v0, p0); getPos(v1, p1);
+            // Edge length term (at the scale of the area weights) as tie breaker for flat regions, avoiding slivers and high valences
+            double edgeLength2 = (p1[0]-p0[0])*(p1[0]-p0[0]) + (p1[1]-p0[1])*(p1[1]-p0[1]) + (p1[2]-p0[2])*(p1[2]-p0[2]);
+            double lengthCost = edgeLengthWeight*edgeLength2*edgeQuadric.GetWeight();
+            double cost0 = edgeQuadric.Evaluate(p0) + lengthCost, cost1 = edgeQuadric.Evaluate(p1) + lengthCost;
+
+            // Merge into the endpoint with the lowest error, where boundary vertices cannot move onto interior ones
+            bool intoV0 = (vertBoundary[v0] != vertBoundary[v1]) ? vertBoundary[v0] : (cost0 <= cost1);
+            collapses.push_back({static_cast<float>(intoV0 ? cost0 : cost1), intoV0 ? v1 : v0, intoV0 ? v0 : v1});
+          }
+        }
+        std::sort(collapses.begin(), collapses.end());
+
+        size_t numPassTriangles = numLiveTriangles;
+        for(const DecimationCollapse& collapse : collapses)
+        {
+          if(numLiveTriangles <= targetTriangles)
+            break;
+
+          uint32_t from = collapse.From, to = collapse.To;
+          if(vertLockPass[from] == pass || vertLockPass[to] == pass)
+            continue;
+
+          // Link condition: the only vertices adjacent to both endpoints are the ones opposite the collapsed edge
+          collectNeighbors(from, neighbors);
+          collectNeighbors(to, toNeighbors);
+          size_t numCommonNeighbors = 0;
+          for(size_t i = 0, j = 0; i < neighbors.size() && j < toNeighbors.size();)
+          {
+            if(neighbors[i].Vertex < toNeighbors[j].Vertex) ++i;
+            else if(toNeighbors[j].Vertex < neighbors[i].Vertex) ++j;
+            else { ++numCommonNeighbors; ++i; ++j; }
+          }
+
+          size_t numSharedTriangles = 0;
+          bool flips = false;
+          double fromPos[3], toPos[3];
+          getPos(from, fromPos);
+          getPos(to, toPos);
+          forEachTriangle(from, [&](uint32_t triIdx)
+          {
+            const uint32_t* tri = triVerts.data() + size_t(triIdx)*3;
+            if(tri[0] == to || tri[1] == to || tri[2] == to)
+            {
+              ++numSharedTriangles;
+              return;
+            }
+            int fromCorner = (tri[0] == from) ? 0 : ((tri[1] == from) ? 1 : 2);
+            double p1[3], p2[3], oldNormal[3], newNormal[3];
+            getPos(tri[(fromCorner + 1) % 3], p1);
+            getPos(tri[(fromCorner + 2) % 3], p2);
+            getTriangleNormal(fromPos, p1, p2, oldNormal);
+            getTriangleNormal(toPos, p1, p2, newNormal);
+            double dotNormals = oldNormal[0]*newNormal[0] + oldNormal[1]*newNormal[1] + oldNormal[2]*newNormal[2];
+            double lengths2 = (oldNormal[0]*oldNormal[0] + oldNormal[1]*oldNormal[1] + oldNormal[2]*oldNormal[2])
+              * (newNormal[0]*newNormal[0] + newNormal[1]*newNormal[1] + newNormal[2]*newNormal[2]);
+            if(dotNormals <= 0.0 || dotNormals*dotNormals < minFlipCosine*minFlipCosine*lengths2)
+              flips = true;
+          });
+          if(flips || numSharedTriangles == 0 || numCommonNeighbors > numSharedTriangles)
+            continue;
+
+          // Merge from into to; the triangles containing both disappear
+          size_t newTriBegin = triPool.size();
+          forEachTriangle(to, [&triPool](uint32_t triIdx) { triPool.push_back(triIdx); });
+          forEachTriangle(from, [&](uint32_t triIdx)
+          {
+            uint32_t* tri = triVerts.data() + size_t(triIdx)*3;
+            if(tri[0] == to || tri[1] == to || tri[2] == to)
+            {
+              triRemoved[triIdx] = true;
+              --numLiveTriangles;
+              return;
+            }
+            for(int corner = 0; corner < 3; ++corner)
+              if(tri[corner] == from)
+                tri[corner] = to;
+            triPool.push_back(triIdx);
+          });
+          vertTriBegin[to] = newTriBegin;
+          vertTriCount[to] = static_cast<uint32_t>(triPool.size() - newTriBegin);
+
+          quadrics[to].Add(quadrics[from]);
+          vertBoundary[to] = vertBoundary[to] || vertBoundary[from];
+          vertRemoved[from] = true;
+
+          // The costs computed at the start of the pass are outdated for all vertices whose triangles have changed
+          vertLockPass[to] = pass;
+          for(const DecimationNeighbor& neighbor : neighbors)
+            vertLockPass[neighbor.Vertex] = pass;
+        }
+
+        if(numLiveTriangles == numPassTriangles)
+          break; // No valid collapses left
+      }
+
+      for(size_t triIdx = 0; triIdx < numTriangles; ++triIdx)
+      {
+        if(triRemoved[triIdx])
+          continue;
+        keptTriangles.push_back(triIdx);
+        for(int corner = 0; corner < 3; ++corner)
+          outIndices.push_back(triVerts[triIdx*3 + corner]);
+      }
+    }
+
+    // Open addressing set of the distinct values among fixed-size elements, compared bitwise. Holds the element index of the first occurrence
+    // of every value, which also gives the values their ids (in order of insertion). A nonzero FixedSize lets the compares be inlined.
+    template<size_t FixedSize>
+    class DistinctValueTable
+    {
+      public:
+        DistinctValueTable(const uint8_t* data, size_t elementSize)
+          : Data(data)
+          , ElementSize(FixedSize ? FixedSize : elementSize)
+        {
+          Slots.resize(64, 0);
+        }
+
+        // Returns the id of the value of element elementIdx with the given hash of its bytes, adding the value if it isn't present yet
+        uint32_t Insert(size_t elementIdx, uint64_t hash)
+        {
+          const uint8_t* element = Data + elementIdx*ElementSize;
+          size_t slotId = FindSlot(element, hash);
+          if(Slots[slotId])
+            return static_cast<uint32_t>(Slots[slotId]) - 1;
+
+          uint32_t valueId = static_cast<uint32_t>(FirstElements.size());
+          FirstElements.push_back(elementIdx);
+          Hashes.push_back(hash);
+          Slots[slotId] = (hash & SlotHashMask) | (valueId + 1);
+          if(FirstElements.size()*2 > Slots.size())
+            Grow();
+          return valueId;
+        }
+
+        size_t NumValues() const { return FirstElements.size(); }
+
+        std::vector<size_t> FirstElements;
+        std::vector<uint64_t> Hashes; // Per value
+
+      protected:
+        static constexpr uint64_t SlotHashMask = 0xFFFFFFFF00000000ULL;
+
+        size_t FindSlot(const uint8_t* element, uint64_t hash) const
+        {
+          size_t mask = Slots.size() - 1;
+          size_t slotId = hash & mask;
+          for(uint64_t slot = Slots[slotId]; slot; slot = Slots[slotId])
+          {
+            if((slot & SlotHashMask) == (hash & SlotHashMask)
+              && std::memcmp(Data + FirstElements[static_cast<uint32_t>(slot) - 1]*ElementSize, element, FixedSize ? FixedSize : ElementSize) == 0)
+              break;
+            slotId = (slotId + 1) & mask;
+          }
+          return slotId;
+        }
+
+        void Grow()
+        {
+          std::vector<uint64_t> oldSlots(Slots.size()*2, 0);
+          Slots.swap(oldSlots);
+          size_t mask = Slots.size() - 1;
+          for(uint64_t slot : oldSlots)
+          {
+            if(slot)
+            {
+              size_t slotId = Hashes[static_cast<uint32_t>(slot) - 1] & mask;
+              while(Slots[slotId])
+                slotId = (slotId + 1) & mask;
+              Slots[slotId] = slot;
+            }
+          }
+        }
+
+        const uint8_t* Data;
+        size_t ElementSize;
+        std::vector<uint64_t> Slots; // Upper half of the value's hash and its id + 1, 0 if empty
+    };
+
+    template<size_t FixedSize>
+    bool IndexDistinctValuesImpl(const void* data, size_t elementSize, size_t numElements, size_t maxDistinct, int* indices, std::vector<size_t>& firstElements,
+      unsigned int numThreads)
+    {
+      static constexpr size_t maxChunkSize = 1 << 16;
+
+      firstElements.clear();
+      if(maxDistinct >= static_cast<size_t>(std::numeric_limits<int>::max()))
+        maxDistinct = static_cast<size_t>(std::numeric_limits<int>::max()) - 1;
+
+      // Each chunk finds its own distinct values and writes the chunk-local value ids to indices.
+      // Without worker threads, a single chunk needs no merge.
+      const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+      numThreads = ResolveNumThreads(numThreads);
+      size_t chunkSize = (numThreads > 1) ? maxChunkSize : std::max(numElements, size_t(1));
+      size_t numChunks = (numElements + chunkSize - 1) / chunkSize;
+      std::vector<std::vector<size_t>> chunkFirstElements(numChunks);
+      std::vector<std::vector<uint64_t>> chunkHashes(numChunks);
+      std::atomic<bool> exceeded(false);
+      ParallelFor(numChunks, numThreads, [bytes, elementSize, numElements, chunkSize, maxDistinct, indices, &chunkFirstElements, &chunkHashes, &exceeded](size_t chunkIdx)
+      {
+        DistinctValueTable<FixedSize> chunkTable(bytes, elementSize);
+        size_t begin = chunkIdx * chunkSize;
+        size_t end = std::min(begin + chunkSize, numElements);
+        for(size_t elementIdx = begin; elementIdx < end; ++elementIdx)
+        {
+          const uint8_t* element = bytes + elementIdx*elementSize;
+          if(elementIdx != begin && std::memcmp(element - elementSize, element, FixedSize ? FixedSize : elementSize) == 0)
+          {
+            indices[elementIdx] = indices[elementIdx-1]; // Runs of equal values are common
+            continue;
+          }
+
+          indices[elementIdx] = static_cast<int>(chunkTable.Insert(elementIdx, HashData(element, elementSize)));
+          if(chunkTable.NumValues() > maxDistinct || ((elementIdx & 0x3FF) == 0 && exceeded.load(std::memory_order_relaxed)))
+          {
+            exceeded = true;
+            return;
+          }
+        }
+        chunkFirstElements[chunkIdx].swap(chunkTable.FirstElements);
+        chunkHashes[chunkIdx].swap(chunkTable.Hashes);
+      });
+      if(exceeded)
+        return false;
+      if(numChunks == 1)
+      {
+        firstElements.swap(chunkFirstElements[0]);
+        return true;
+      }
+
+      // Merge the chunk values in order, so ids follow the order of first occurrence in the whole array
+      DistinctValueTable<FixedSize> table(bytes, elementSize);
+      std::vector<std::vector<int>> chunkRemaps(numChunks);
+      for(size_t chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx)
+      {
+        const std::vector<size_t>& firstElements = chunkFirstElements[chunkIdx];
+        for(size_t valueIdx = 0; valueIdx < firstElements.size(); ++valueIdx)
+        {
+          chunkRemaps[chunkIdx].push_back(static_cast<int>(table.Insert(firstElements[valueIdx], chunkHashes[chunkIdx][valueIdx])));
+          if(table.NumValues() > maxDistinct)
+            return false;
+        }
+      }
+
+      ParallelFor(numChunks, numThreads, [numElements, chunkSize, indices, &chunkRemaps](size_t chunkIdx)
+      {
+        const std::vector<int>& remap = chunkRemaps[chunkIdx];
+        size_t end = std::min((chunkIdx + 1) * chunkSize, numElements);
+        for(size_t elementIdx = chunkIdx * chunkSize; elementIdx < end; ++elementIdx)
+          indices[elementIdx] = remap[indices[elementIdx]];
+      });
+
+      firstElements.swap(table.FirstElements);
+      return true;
+    }
+  }
+
+  void ExpandToFloat4(const float* input, int numComponents, size_t numElements, float* output)
+  {
+    ExpandToFloat4Dispatch(input, numComponents, numElements, output, 1.0f,
+      [](const float* p) { return SimdLoad(p); });
+  }
+
+  void ExpandToFloat4(const double* input, int numComponents, size_t numElements, float* output)
+  {
+    ExpandToFloat4Dispatch(input, numComponents, numElements, output, 1.0,
+      [](const double* p) { return SimdConvert(p); });
+  }
+
+  void ExpandToFloat4Normalized(const uint8_t* input, int numComponents, size_t numElements, float* output)
+  {
+    ExpandToFloat4NormalizedImpl(input, numComponents, numElements, output);
+  }
+
+  void ExpandToFloat4Normalized(const uint16_t* input, int numComponents, size_t numElements, float* output)
+  {
+    ExpandToFloat4NormalizedImpl(input, numComponents, numElements, output);
+  }
+
+  void ExpandToFloat4Normalized(const uint32_t* input, int numComponents, size_t numElements, float* output)
+  {
+    double normFactor = 1.0 / (double)std::numeric_limits<uint32_t>::max(); // float is not enough for uint32_t
+    ExpandToFloat4Dispatch(input, numComponents, numElements, output, std::numeric_limits<uint32_t>::max(),
+      [normFactor](const uint32_t* p) { return SimdConvertScaled(p, normFactor); });
+  }
+
+  void ExpandSrgbToFloat4(const uint8_t* input, int numComponents, size_t numElements, float* output)
+  {
+    // No gather instructions in SSE2/NEON, so table lookups are scalar; the linear alpha is scaled in the vector unit
+    const float* srgbTable = SrgbToLinearTable();
+    const float alphaNorm = 1.0f / 255.0f;
+    switch(numComponents)
+    {
+      case 1:
+        for(size_t i = 0; i < numElements; ++i)
+          SimdStore(output + i*4, SimdSet(srgbTable[input[i]], 0.0f, 0.0f, 1.0f));
+        break;
+      case 2:
+      {
+        SimdFloat4 scale = SimdSet(1.0f, 1.0f, 1.0f, alphaNorm);
+        for(size_t i = 0; i < numElements; ++i)
+          SimdStore(output + i*4, SimdMul(SimdSet(srgbTable[input[i*2]], 0.0f, 0.0f, (float)input[i*2+1]), scale));
+        break;
+      }
+      case 3:
+        for(size_t i = 0; i < numElements; ++i)
+          SimdStore(output + i*4, SimdSet(srgbTable[input[i*3]], srgbTable[input[i*3+1]], srgbTable[input[i*3+2]], 1.0f));
+        break;
+      case 4:
+      {
+        SimdFloat4 scale = SimdSet(1.0f, 1.0f, 1.0f, alphaNorm);
+        for(size_t i = 0; i < numElements; ++i)
+          SimdStore(output + i*4, SimdMul(SimdSet(srgbTable[input[i*4]], srgbTable[input[i*4+1]], srgbTable[input[i*4+2]], (float)input[i*4+3]), scale));
+        break;
+      }
+      default: break;
+    }
+  }
+
+  void ExpandToFloat3(const float* input, size_t numElements, float* output)
+  {
+    ExpandToFloat3Impl(input, numElements, output);
+  }
+
+  void ExpandToFloat3(const double* input, size_t numElements, float* output)
+  {
+    ExpandToFloat3Impl(input, numElements, output);
+  }
+
+  void ConvertToFloat(const double* input, size_t numValues, float* output)
+  {
+    size_t i = 0;
+    for(; i + 4 <= numValues; i += 4)
+      SimdStore(output + i, SimdConvert(input + i));
+    for(; i < numValues; ++i)
+      output[i] = (float)input[i];
+  }
+
+  void ConvertToHalf(const float* input, size_t numValues, uint16_t* output)
+  {
+    size_t i = 0;
+    for(; i + 4 <= numValues; i += 4)
+      SimdStoreHalf(output + i, SimdLoad(input + i));
+    for(; i < numValues; ++i)
+      output[i] = FloatToHalf(input[i]);
+  }
+
+  void ConvertToHalf(const double* input, size_t numValues, uint16_t* output)
+  {
+    size_t i = 0;
+    for(; i + 4 <= numValues; i += 4)
+      SimdStoreHalf(output + i, SimdConvert(input + i));
+    for(; i < numValues; ++i)
+      output[i] = FloatToHalf((float)input[i]);
+  }
+
+  void ConvertToFloat3WithBounds(const float* input, size_t numPoints, float* output, float* boundsMin, float* boundsMax, unsigned int numThreads)
+  {
+    ConvertToFloat3WithBoundsImpl(input, numPoints, output, boundsMin, boundsMax, numThreads);
+  }
+
+  void ConvertToFloat3WithBounds(const double* input, size_t numPoints, float* output, float* boundsMin, float* boundsMax, unsigned int numThreads)
+  {
+    ConvertToFloat3WithBoundsImpl(input, numPoints, output, boundsMin, boundsMax, numThreads);
+  }
+
+  void DirectionsToQuaternionsZ(const float* dirs, size_t numDirs, float* quats)
+  {
+    DirectionsToQuaternionsZImpl(dirs, numDirs, quats);
+  }
+
+  void DirectionsToQuaternionsZ(const double* dirs, size_t numDirs, float* quats)
+  {
+    DirectionsToQuaternionsZImpl(dirs, numDirs, quats);
+  }
+
+  void DecomposeTransforms(const float* transforms, const uint64_t* indices, size_t numTransforms, float* positions, float* quats, float* scales)
+  {
+    // Branch-free per transform, so the loop can be vectorized
+    for(size_t i = 0; i < numTransforms; ++i)
+    {
+      const float* m = transforms + indices[i]*16;
+
+      // Rows 0-2 hold the scaled rotation axes, row 3 the translation
+      float scaleX = std::sqrt(m[0]*m[0] + m[1]*m[1] + m[2]*m[2]);
+      float scaleY = std::sqrt(m[4]*m[4] + m[5]*m[5] + m[6]*m[6]);
+      float scaleZ = std::sqrt(m[8]*m[8] + m[9]*m[9] + m[10]*m[10]);
+      float det = m[0]*(m[5]*m[10] - m[6]*m[9]) - m[1]*(m[4]*m[10] - m[6]*m[8]) + m[2]*(m[4]*m[9] - m[5]*m[8]);
+      scaleZ = (det < 0.0f) ? -scaleZ : scaleZ;
+
+      float invX = (scaleX != 0.0f) ? 1.0f / scaleX : 0.0f;
+      float invY = (scaleY != 0.0f) ? 1.0f / scaleY : 0.0f;
+      float invZ = (scaleZ != 0.0f) ? 1.0f / scaleZ : 0.0f;
+      float r00 = m[0]*invX, r01 = m[1]*invX, r02 = m[2]*invX;
+      float r10 = m[4]*invY, r11 = m[5]*invY, r12 = m[6]*invY;
+      float r20 = m[8]*invZ, r21 = m[9]*invZ, r22 = m[10]*invZ;
+
+      // Quaternion of the row-vector rotation matrix, taken as the normalized row of 4*q*q^T of its largest component (as selected by the diagonal)
+      float t0 = 1.0f + r00 + r11 + r22, t1 = 1.0f + r00 - r11 - r22, t2 = 1.0f - r00 + r11 - r22, t3 = 1.0f - r00 - r11 + r22;
+      float dI = r12 - r21, dJ = r20 - r02, dK = r01 - r10;
+      float sIJ = r01 + r10, sIK = r02 + r20, sJK = r12 + r21;
+      bool caseR = (t0 >= t1) && (t0 >= t2) && (t0 >= t3);
+      bool caseI = !caseR && (t1 >= t2) && (t1 >= t3);
+      bool caseJ = !caseR && !caseI && (t2 >= t3);
+      float quatI = caseR ? dI : (caseI ? t1 : (caseJ ? sIJ : sIK));
+      float quatJ = caseR ? dJ : (caseI ? sIJ : (caseJ ? t2 : sJK));
+      float quatK = caseR ? dK : (caseI ? sIK : (caseJ ? sJK : t3));
+      float quatR = caseR ? t0 : (caseI ? dI : (caseJ ? dJ : dK));
+      float quatLength2 = quatI*quatI + quatJ*quatJ + quatK*quatK + quatR*quatR;
+      float invQuatLength = (quatLength2 > 0.0f) ? 1.0f / std::sqrt(quatLength2) : 0.0f;
+
+      float* pos = positions + i*3;
+      pos[0] = m[12]; pos[1] = m[13]; pos[2] = m[14];
+      float* quat = quats + i*4;
+      quat[0] = quatI*invQuatLength; quat[1] = quatJ*invQuatLength; quat[2] = quatK*invQuatLength;
+      quat[3] = (quatLength2 > 0.0f) ? quatR*invQuatLength : 1.0f;
+      float* scale = scales + i*3;
+      scale[0] = scaleX; scale[1] = scaleY; scale[2] = scaleZ;
+    }
+  }
+
+  void MortonOrder(const float* points, size_t numPoints, std::vector<uint64_t>& order, unsigned int numThreads)
+  {
+    MortonOrderImpl(points, numPoints, order, numThreads);
+  }
+
+  void MortonOrder(const double* points, size_t numPoints, std::vector<uint64_t>& order, unsigned int numThreads)
+  {
+    MortonOrderImpl(points, numPoints, order, numThreads);
+  }
+
+  void DecimateTriangles(const float* points, size_t numPoints, const uint64_t* indices, size_t numTriangles, size_t targetTriangles,
+    std::vector<uint64_t>& keptTriangles, std::vector<uint64_t>& outIndices)
+  {
+    DecimateTrianglesImpl(points, numPoints, indices, numTriangles, targetTriangles, keptTriangles, outIndices);
+  }
+
+  void DecimateTriangles(const double* points, size_t numPoints, const uint64_t* indices, size_t numTriangles, size_t targetTriangles,
+    std::vector<uint64_t>& keptTriangles, std::vector<uint64_t>& outIndices)
+  {
+    DecimateTrianglesImpl(points, numPoints, indices, numTriangles, targetTriangles, keptTriangles, outIndices);
+  }
+
+
+  bool IndexDistinctValues(const void* data, size_t elementSize, size_t numElements, size_t maxDistinct, int* indices, std::vector<size_t>& firstElements,
+    unsigned int numThreads)
+  {
+    switch(elementSize)
+    {
+      case 8: return IndexDistinctValuesImpl<8>(data, elementSize, numElements, maxDistinct, indices, firstElements, numThreads);
+      case 12: return IndexDistinctValuesImpl<12>(data, elementSize, numElements, maxDistinct, indices, firstElements, numThreads);
+      case 16: return IndexDistinctValuesImpl<16>(data, elementSize, numElements, maxDistinct, indices, firstElements, numThreads);
+      case 24: return IndexDistinctValuesImpl<24>(data, elementSize, numElements, maxDistinct, indices, firstElements, numThreads);
+      case 32: return IndexDistinctValuesImpl<32>(data, elementSize, numElements, maxDistinct, indices, firstElements, numThreads);
+      default: return IndexDistinctValuesImpl<0>(data, elementSize, numElements, maxDistinct, indices, firstElements, numThreads);
+    }
+  }
+}
@@ -6,6 +6,8 @@
 
 #include "UsdBridgeData.h"
 
+#include <vector>
+
 // USD-independent utils for the UsdBridge
 
 #define UsdBridgeLogMacro(obj, level, message) \
@@ -22,6 +24,75 @@ namespace ubutils
   const float* SrgbToLinearTable(); // returns a float[256] array
   float SrgbToLinear(float val);
   void SrgbToLinear3(float* color); // expects a float[3]
+
+  // Fast 64-bit (non-cryptographic) content hash, following the xxHash64 algorithm
+  uint64_t HashData(const void* data, size_t numBytes, uint64_t seed = 0);
+  inline uint64_t HashCombine(uint64_t hash, uint64_t value) { return hash ^ (value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2)); }
+
+  // Primvar conversion kernels (vectorized where SSE2/NEON is available), writing tightly packed float tuples into output.
+  // Results are identical to per-element scalar conversion; missing color components are filled in with (0,0,1).
+  void ExpandToFloat4(const float* input, int numComponents, size_t numElements, float* output);
+  void ExpandToFloat4(const double* input, int numComponents, size_t numElements, float* output);
+  void ExpandToFloat4Normalized(const uint8_t* input, int numComponents, size_t numElements, float* output); // Divides by the max of the input type
+  void ExpandToFloat4Normalized(const uint16_t* input, int numComponents, size_t numElements, float* output);
+  void ExpandToFloat4Normalized(const uint32_t* input, int numComponents, size_t numElements, float* output);
+  void ExpandSrgbToFloat4(const uint8_t* input, int numComponents, size_t numElements, float* output); // Alpha (2nd component of 2) is linear
+  void ExpandToFloat3(const float* input, size_t numElements, float* output); // Replicates each value into 3 components
+  void ExpandToFloat3(const double* input, size_t numElements, float* output);
+  void ConvertToFloat(const double* input, size_t numValues, float* output);
+  // Writes IEEE half precision bit patterns (as used by GfHalf), rounding to nearest even. Doubles are rounded to float first.
+  void ConvertToHalf(const float* input, size_t numValues, uint16_t* output);
+  void ConvertToHalf(const double* input, size_t numValues, uint16_t* output);
+  // Single pass over numPoints xyz tuples, writing them to output as float (unless output is null) and reducing their component-wise bounds
+  // into boundsMin/boundsMax (float[3] each). Empty input gives an empty range (min > max). Large inputs are processed in parallel, over numThreads as passed to ParallelFor.
+  void ConvertToFloat3WithBounds(const float* input, size_t numPoints, float* output, float* boundsMin, float* boundsMax, unsigned int numThreads);
+  void ConvertToFloat3WithBounds(const double* input, size_t numPoints, float* output, float* boundsMin, float* boundsMax, unsigned int numThreads);
+  // Writes the (i,j,k,real) unit quaternions rotating (0,0,1) onto each of the (not necessarily normalized) xyz directions.
+  // Like GfRotation, directions with a cosine beyond -0.9999999 with (0,0,1) give half a turn around the y axis, those beyond 0.9999999 the identity;
+  // zero-length ones give the identity as well.
+  void DirectionsToQuaternionsZ(const float* dirs, size_t numDirs, float* quats);
+  void DirectionsToQuaternionsZ(const double* dirs, size_t numDirs, float* quats);
+  // Decomposes the 4x4 transforms (ANARI's column-major layout, equal in memory to USD's row-vector matrices) at transforms + 16*indices[i]
+  // into xyz translations, (i,j,k,real) unit quaternions and xyz scales, which reproduce the transform by scaling, rotating and translating.
+  // A negative determinant flips the z scale; shear cannot be represented and only approximated.
+  void DecomposeTransforms(const float* transforms, const uint64_t* indices, size_t numTransforms, float* positions, float* quats, float* scales);
+  // Writes the permutation into order that sorts the numPoints xyz points along a Z-order (Morton) curve through their bounds,
+  // with a (parallel over numThreads, for large inputs) radix sort on 63-bit codes. Points with equal codes keep their relative order.
+  void MortonOrder(const float* points, size_t numPoints, std::vector<uint64_t>& order, unsigned int numThreads);
+  void MortonOrder(const double* points, size_t numPoints, std::vector<uint64_t>& order, unsigned int numThreads);
+  // Simplifies the numTriangles triangles (indexing the numPoints xyz points) to at most targetTriangles, or as close as topology allows.
+  // Remaining vertices are a subset of the input points; writes the source index of every kept triangle and its (3 per triangle) point indices.
+  void DecimateTriangles(const float* points, size_t numPoints, const uint64_t* indices, size_t numTriangles, size_t targetTriangles,
+    std::vector<uint64_t>& keptTriangles, std::vector<uint64_t>& outIndices);
+  void DecimateTriangles(const double* points, size_t numPoints, const uint64_t* indices, size_t numTriangles, size_t targetTriangles,
+    std::vector<uint64_t>& keptTriangles, std::vector<uint64_t>& outIndices);
+  // Finds the distinct values (compared bitwise) among the numElements elements of elementSize bytes in data, with a hash-based pass parallel over numThreads.
+  // Returns false as soon as more than maxDistinct values are found. Otherwise writes the value id of every element to indices (numElements ints)
+  // and the index of the first element holding each value to firstElements, ids being given in order of first occurrence.
+  bool IndexDistinctValues(const void* data, size_t elementSize, size_t numElements, size_t maxDistinct, int* indices, std::vector<size_t>& firstElements,
+    unsigned int numThreads);
+
+  // Number of threads a numThreads argument of ParallelFor stands for: numThreads itself, or the hardware concurrency (at least 1) if 0.
+  // The pool has no default of its own; users such as the device pass their configured count (usd::flush.threads) with every call.
+  unsigned int ResolveNumThreads(unsigned int numThreads);
+
+  // The worker threads of ParallelFor are started on first use and kept alive in between calls.
+  // They are joined once the last holder of the pool (eg. a device) releases it, or at exit if the pool has never been acquired.
+  void AcquireThreadPool();
+  void ReleaseThreadPool();
+
+  void ParallelForImpl(size_t numJobs, unsigned int numThreads, void (*jobFunc)(const void*, size_t), const void* jobFuncData);
+
+  // Calls func(jobIdx) for every jobIdx in [0, numJobs), distributed over the calling thread and at most numThreads-1 workers of a persistent pool.
+  // A numThreads of 0 selects the hardware concurrency; jobs are picked up dynamically, so their order of execution is undefined.
+  // Calls from within a job or from multiple threads share the same workers, so nesting never adds threads on top of the pool.
+  template<typename FuncType>
+  void ParallelFor(size_t numJobs, unsigned int numThreads, const FuncType& func)
+  {
+    ParallelForImpl(numJobs, numThreads,
+      [](const void* funcData, size_t jobIdx) { (*reinterpret_cast<const FuncType*>(funcData))(jobIdx); },
+      &func);
+  }
 }
 
 #endif
\ No newline at end of file
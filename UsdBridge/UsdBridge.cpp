@@ -6,9 +6,16 @@
 #include "UsdBridgeUsdWriter.h"
 #include "UsdBridgeCaches.h"
 #include "UsdBridgeDiagnosticMgrDelegate.h"
+#include "UsdBridgeUtils.h"
 
 #include <string>
 #include <memory>
+#include <algorithm>
+#include <deque>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #define BRIDGE_CACHE Internals->Cache
 #define BRIDGE_USDWRITER Internals->UsdWriter
@@ -37,6 +44,7 @@ namespace
   const char* const samplerPathRp = "samplers"; // created in material parent class (separation from other UsdShader prims in material)
   const char* const protoShapePathRp = "protoshapes"; // created in geometry parent class
   const char* const protoGeometryPathRp = "protogeometries"; // created in geometry parent class
+  const char* const instancerPathRp = "instancers"; // point instancers per group, alternative to instancePathRp
 
   // Postfixes for prim stage names, also used for manifests
   const char* const geomPrimStagePf = "_Geom";
@@ -52,6 +60,24 @@ namespace
   {
     return !createResult.first.first && !createResult.first.second;
   }
+
+  // Tracks the dirty state of a layer like the default delegate, but can also mark the layer clean without saving it
+  class LayerSnapshotStateDelegate : public SdfSimpleLayerStateDelegate
+  {
+    public:
+      // To be called once the content of the layer has been captured by a snapshot which is going to be written
+      static void MarkClean(const SdfLayerRefPtr& layer)
+      {
+        TfWeakPtr<LayerSnapshotStateDelegate> delegate = TfDynamic_cast<TfWeakPtr<LayerSnapshotStateDelegate>>(layer->GetStateDelegate());
+        if(!delegate)
+        {
+          TfRefPtr<LayerSnapshotStateDelegate> newDelegate = TfCreateRefPtr(new LayerSnapshotStateDelegate());
+          layer->SetStateDelegate(newDelegate);
+          delegate = newDelegate;
+        }
+        delegate->_MarkCurrentStateAsClean();
+      }
+  };
 }
 
 typedef UsdBridgePrimCacheManager::PrimCacheIterator PrimCacheIterator;
@@ -74,6 +100,8 @@ struct UsdBridgeInternals
 
   ~UsdBridgeInternals()
   {
+    StopSaveThread();
+
     if(DiagRemoveFunc)
       DiagRemoveFunc(DiagnosticDelegate.get());
   }
@@ -86,6 +114,13 @@ struct UsdBridgeInternals
 
   const UsdBridgePrimCacheList& ToCacheList(UsdBridgePrimCache* primCache);
 
+  uint64_t QueueSceneSave(const std::vector<SdfLayerRefPtr>& layers, uint32_t maxPendingSaves); // Scene root layer (if any) last
+  bool SaveIsPending(uint64_t saveId) const; // Requires SaveMutex to be locked
+  void WaitForPendingSaves();
+  void StopSaveThread();
+  void SaveThreadFunc();
+  void FlushDiagnostics();
+
   UsdGeomPrimvarsAPI GetBoundGeomPrimvars(const UsdBridgeHandle& material) const;
 
   // Cache
@@ -104,13 +139,178 @@ struct UsdBridgeInternals
   std::unique_ptr<UsdBridgeDiagnosticMgrDelegate> DiagnosticDelegate;
   std::function<void (UsdBridgeDiagnosticMgrDelegate*)> DiagRemoveFunc;
 
+  // Background scene saving; queued snapshots are written in order by SaveThread
+  struct LayerSnapshot
+  {
+    SdfLayerRefPtr Snapshot;
+    std::string Identifier;
+    SdfLayer::FileFormatArguments FormatArgs;
+  };
+  struct PendingSave
+  {
+    uint64_t SaveId;
+    std::vector<LayerSnapshot> Snapshots; // Scene root layer (if any) last
+    std::vector<SdfLayerRefPtr> Layers; // Keeps the saved layers open until written, so reopening one finds it in memory instead of the file being written
+    unsigned int NumThreads = 0; // Of the writer at the time the save was queued
+  };
+  void MergeIntoNextSave(PendingSave& save, PendingSave& nextSave); // Requires SaveMutex to be locked
+  std::thread SaveThread;
+  std::mutex SaveMutex;
+  std::condition_variable SaveCondition;
+  std::deque<PendingSave> PendingSaves;
+  uint64_t LastQueuedSaveId = 0;
+  uint64_t ActiveSaveId = 0; // Save currently being written by SaveThread, 0 if none
+  bool StopSaving = false;
+
   // Temp arrays
   UsdBridgePrimCacheList TempPrimCaches;
   SdfPrimPathList TempPrimPaths;
   SdfPrimPathList ProtoPrimPaths;
+  UsdBridgePrimCacheList InstancerGroups;
+  std::unordered_map<UsdBridgePrimCache*, uint64_t> InstancerGroupIndices;
+  std::vector<uint64_t> InstanceGroupIndices;
+  std::vector<uint64_t> InstancerGroupOffsets;
+  std::vector<uint64_t> InstancerInstanceIndices;
 };
 
 
+uint64_t UsdBridgeInternals::QueueSceneSave(const std::vector<SdfLayerRefPtr>& layers, uint32_t maxPendingSaves)
+{
+  // Take snapshots of the layers on the calling thread, so the live stages can be modified while the snapshots are written.
+  // The layers are marked clean, so the next save only contains the layers modified after this one.
+  PendingSave save;
+  save.Snapshots.resize(layers.size());
+  for(size_t layerIdx = 0; layerIdx < layers.size(); ++layerIdx)
+  {
+    const SdfLayerRefPtr& layer = layers[layerIdx];
+    LayerSnapshot& snapshot = save.Snapshots[layerIdx];
+    snapshot.Snapshot = SdfLayer::CreateAnonymous();
+    snapshot.Snapshot->TransferContent(layer);
+    snapshot.Identifier = layer->GetIdentifier();
+    snapshot.FormatArgs = layer->GetFileFormatArguments();
+    LayerSnapshotStateDelegate::MarkClean(layer);
+  }
+  save.Layers = layers;
+  save.NumThreads = UsdWriter.NumThreads;
+
+  std::unique_lock<std::mutex> lock(SaveMutex);
+
+  // Backpressure: block until the number of saves in flight drops below the maximum
+  size_t maxPending = std::max(maxPendingSaves, 1u);
+  SaveCondition.wait(lock, [this, maxPending]{ 
+    return PendingSaves.size() + (ActiveSaveId ? 1 : 0) < maxPending; });
+
+  save.SaveId = ++LastQueuedSaveId;
+  uint64_t saveId = save.SaveId;
+  PendingSaves.emplace_back(std::move(save));
+
+  if(!SaveThread.joinable())
+  {
+    StopSaving = false;
+    SaveThread = std::thread(&UsdBridgeInternals::SaveThreadFunc, this);
+  }
+
+  lock.unlock();
+  SaveCondition.notify_all();
+
+  return saveId;
+}
+
+bool UsdBridgeInternals::SaveIsPending(uint64_t saveId) const
+{
+  // Saves are written in queue order, so only the oldest pending and active saves have to be checked
+  return (ActiveSaveId && ActiveSaveId <= saveId)
+    || (!PendingSaves.empty() && PendingSaves.front().SaveId <= saveId);
+}
+
+void UsdBridgeInternals::MergeIntoNextSave(PendingSave& save, PendingSave& nextSave)
+{
+  // The snapshots of nextSave are newer, those of layers it doesn't contain are still the latest content of those layers
+  std::unordered_set<std::string> nextIdentifiers;
+  for(const LayerSnapshot& snapshot : nextSave.Snapshots)
+    nextIdentifiers.insert(snapshot.Identifier);
+
+  for(size_t layerIdx = 0; layerIdx < save.Snapshots.size(); ++layerIdx)
+  {
+    if(nextIdentifiers.count(save.Snapshots[layerIdx].Identifier))
+      continue;
+    nextSave.Snapshots.emplace_back(std::move(save.Snapshots[layerIdx]));
+    nextSave.Layers.emplace_back(std::move(save.Layers[layerIdx]));
+  }
+
+  // Keep the scene root layer last
+  const std::string& rootIdentifier = UsdWriter.GetSceneStage()->GetRootLayer()->GetIdentifier();
+  auto rootIt = std::find_if(nextSave.Snapshots.begin(), nextSave.Snapshots.end(),
+    [&rootIdentifier](const LayerSnapshot& snapshot) { return snapshot.Identifier == rootIdentifier; });
+  if(rootIt != nextSave.Snapshots.end())
+  {
+    size_t rootIdx = rootIt - nextSave.Snapshots.begin();
+    std::rotate(rootIt, rootIt + 1, nextSave.Snapshots.end());
+    std::rotate(nextSave.Layers.begin() + rootIdx, nextSave.Layers.begin() + rootIdx + 1, nextSave.Layers.end());
+  }
+}
+
+void UsdBridgeInternals::WaitForPendingSaves()
+{
+  std::unique_lock<std::mutex> lock(SaveMutex);
+  SaveCondition.wait(lock, [this]{ return PendingSaves.empty() && !ActiveSaveId; });
+}
+
+void UsdBridgeInternals::StopSaveThread()
+{
+  if(!SaveThread.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(SaveMutex);
+    StopSaving = true;
+  }
+  SaveCondition.notify_all();
+
+  SaveThread.join(); // Pending saves are still written before the thread exits
+}
+
+void UsdBridgeInternals::FlushDiagnostics()
+{
+  if(DiagnosticDelegate)
+    DiagnosticDelegate->FlushDeferredMessages();
+}
+
+void UsdBridgeInternals::SaveThreadFunc()
+{
+  std::unique_lock<std::mutex> lock(SaveMutex);
+  while(true)
+  {
+    SaveCondition.wait(lock, [this]{ return StopSaving || !PendingSaves.empty(); });
+    if(PendingSaves.empty())
+      break;
+
+    PendingSave save = std::move(PendingSaves.front());
+    PendingSaves.pop_front();
+    ActiveSaveId = save.SaveId;
+    lock.unlock();
+
+    // Errors are reported through the diagnostic delegate, which passes them on from the calling thread
+    auto exportSnapshot = [](LayerSnapshot& snapshot)
+    {
+      snapshot.Snapshot->Export(snapshot.Identifier, std::string(), snapshot.FormatArgs);
+      snapshot.Snapshot.Reset();
+    };
+    // The root layer is written after all the layers it refers to
+    size_t numOtherLayers = save.Snapshots.size() - 1;
+    ubutils::ParallelFor(numOtherLayers, save.NumThreads, [&save, &exportSnapshot](size_t layerIdx)
+    {
+      exportSnapshot(save.Snapshots[layerIdx]);
+    });
+    exportSnapshot(save.Snapshots.back());
+    save.Layers.clear();
+
+    lock.lock();
+    ActiveSaveId = 0;
+    SaveCondition.notify_all();
+  }
+}
+
 BoolEntryPair UsdBridgeInternals::FindOrCreatePrim(const char* category, const char* name, ResourceCollectFunc collectFunc)
 {
   assert(TfIsValidIdentifier(name));
@@ -205,6 +405,32 @@ void UsdBridge::SetEnableSaving(bool enableSaving)
   BRIDGE_USDWRITER.SetEnableSaving(enableSaving);
 }
 
+void UsdBridge::SetScratchMemoryLimit(uint64_t numBytes)
+{
+  BRIDGE_USDWRITER.ScratchArena.SetRetainedBytesLimit(numBytes);
+}
+
+void UsdBridge::SetLodSettings(const float* ratios, uint32_t numRatios, uint64_t minPrimitives)
+{
+  BRIDGE_USDWRITER.SetLodSettings(ratios, numRatios, minPrimitives);
+}
+
+void UsdBridge::SetKeepTimeSteps(uint32_t numTimeSteps)
+{
+  BRIDGE_USDWRITER.SetKeepTimeSteps(numTimeSteps);
+}
+
+void UsdBridge::SetNumThreads(uint32_t numThreads)
+{
+  BRIDGE_USDWRITER.SetNumThreads(numThreads);
+}
+
+void UsdBridge::GetScratchMemoryUsage(uint64_t& currentBytes, uint64_t& peakBytes) const
+{
+  currentBytes = BRIDGE_USDWRITER.ScratchArena.GetCurrentBytes();
+  peakBytes = BRIDGE_USDWRITER.ScratchArena.GetPeakBytes();
+}
+
 bool UsdBridge::OpenSession(UsdBridgeLogCallback logCallback, void* logUserData)
 {
   BRIDGE_USDWRITER.LogObject = {logUserData, logCallback};
@@ -222,6 +448,27 @@ bool UsdBridge::OpenSession(UsdBridgeLogCallback logCallback, void* logUserData)
 
 void UsdBridge::CloseSession()
 {
+  // Levels of detail still being generated and any changes since the last frame are written out before the session ends
+  if(SessionValid)
+  {
+    BRIDGE_USDWRITER.UpdateUsdGeometryLods(true);
+#ifdef VALUE_CLIP_RETIMING
+    BRIDGE_USDWRITER.FlushClipMetaData();
+#endif
+    if(this->EnableSaving)
+    {
+      Internals->WaitForPendingSaves();
+      BRIDGE_USDWRITER.SaveDirtyStages();
+      BRIDGE_USDWRITER.SaveTimestepLayers();
+      UsdStageRefPtr sceneStage = BRIDGE_USDWRITER.GetSceneStage();
+      if(sceneStage->GetRootLayer()->IsDirty())
+        sceneStage->Save();
+    }
+    BRIDGE_USDWRITER.RemoveSavedFiles([](uint64_t) { return true; });
+  }
+
+  Internals->StopSaveThread();
+  Internals->FlushDiagnostics();
   BRIDGE_USDWRITER.ResetSession();
 }
 
@@ -455,7 +702,7 @@ bool UsdBridge::CreateCamera(const char* name, UsdCameraHandle& handle)
   {
     const char* layerId = nullptr;
 #ifdef VALUE_CLIP_RETIMING
-    const UsdStagePair& stagePair = BRIDGE_USDWRITER.FindOrCreatePrimStage(cacheEntry, cameraPrimStagePf);
+    UsdStagePair stagePair = BRIDGE_USDWRITER.FindOrCreatePrimStage(cacheEntry, cameraPrimStagePf);
     layerId = stagePair.first.c_str();
     UsdStageRefPtr camStage = stagePair.second;
 #else
@@ -573,9 +820,60 @@ void UsdBridge::SetNoClipRefs(ParentHandleType parentHandle, const ChildHandleTy
 
 void UsdBridge::SetInstanceRefs(UsdWorldHandle world, const UsdInstanceHandle* instances, uint64_t numInstances, bool timeVarying, double timeStep, const int* instanceableValues)
 {
+  if (world.value == nullptr) return;
+
+  // Instancers of a previous SetInstancerRefs()
+  UsdBridgePrimCache* worldCache = BRIDGE_CACHE.ConvertToPrimCache(world);
+  BRIDGE_USDWRITER.ManageUnusedRefs(worldCache, UsdBridgePrimCacheList(), instancerPathRp, timeVarying, timeStep, Internals->RefModCallbacks.AtRemoveRef);
+
   SetNoClipRefs(world, instances, numInstances, instancePathRp, timeVarying, timeStep, instanceableValues);
 }
 
+void UsdBridge::SetInstancerRefs(UsdWorldHandle world, const UsdGroupHandle* groups, const float* transforms, uint64_t numInstances, bool timeVarying, double timeStep)
+{
+  if (world.value == nullptr) return;
+  if(HasNullHandles(groups, numInstances)) return;
+
+  UsdBridgePrimCache* worldCache = BRIDGE_CACHE.ConvertToPrimCache(world);
+
+  // References to individual instances of a previous SetInstanceRefs()
+  BRIDGE_USDWRITER.ManageUnusedRefs(worldCache, UsdBridgePrimCacheList(), instancePathRp, timeVarying, timeStep, Internals->RefModCallbacks.AtRemoveRef);
+
+  // Bucket the instances by group (in order of first occurrence) with a counting sort
+  UsdBridgePrimCacheList& instancerGroups = Internals->InstancerGroups;
+  std::unordered_map<UsdBridgePrimCache*, uint64_t>& groupIndices = Internals->InstancerGroupIndices;
+  std::vector<uint64_t>& instanceGroupIndices = Internals->InstanceGroupIndices;
+  instancerGroups.clear();
+  groupIndices.clear();
+  instanceGroupIndices.resize(numInstances);
+  for (uint64_t i = 0; i < numInstances; ++i)
+  {
+    UsdBridgePrimCache* groupCache = BRIDGE_CACHE.ConvertToPrimCache(groups[i]);
+    auto groupIt = groupIndices.emplace(groupCache, instancerGroups.size()).first;
+    if (groupIt->second == instancerGroups.size())
+      instancerGroups.push_back(groupCache);
+    instanceGroupIndices[i] = groupIt->second;
+  }
+
+  std::vector<uint64_t>& groupOffsets = Internals->InstancerGroupOffsets;
+  std::vector<uint64_t>& instanceIndices = Internals->InstancerInstanceIndices;
+  groupOffsets.assign(instancerGroups.size() + 1, 0);
+  for (uint64_t i = 0; i < numInstances; ++i)
+    ++groupOffsets[instanceGroupIndices[i] + 1];
+  for (size_t groupIdx = 0; groupIdx < instancerGroups.size(); ++groupIdx)
+    groupOffsets[groupIdx + 1] += groupOffsets[groupIdx];
+
+  instanceIndices.resize(numInstances);
+  for (uint64_t i = 0; i < numInstances; ++i)
+    instanceIndices[groupOffsets[instanceGroupIndices[i]]++] = i;
+  for (size_t groupIdx = instancerGroups.size(); groupIdx > 0; --groupIdx) // Restore the offsets moved by the fill
+    groupOffsets[groupIdx] = groupOffsets[groupIdx - 1];
+  groupOffsets[0] = 0;
+
+  BRIDGE_USDWRITER.UpdateUsdPointInstancers(worldCache, instancerPathRp, instancerGroups, groupOffsets.data(), instanceIndices.data(), transforms,
+    timeVarying, timeStep, Internals->RefModCallbacks);
+}
+
 void UsdBridge::SetGroupRef(UsdInstanceHandle instance, UsdGroupHandle group, bool timeVarying, double timeStep)
 {
   if (instance.value == nullptr) return;
@@ -708,8 +1006,7 @@ void UsdBridge::SetSamplerRefs(UsdMaterialHandle material, const UsdSamplerHandl
   BRIDGE_USDWRITER.ConnectSamplersToMaterial(materialStage, matPrimPath, Internals->TempPrimPaths, samplerCaches, samplerRefData, numSamplers, timeStep); // requires world timestep, see implementation
 
 #ifdef VALUE_CLIP_RETIMING
-  if(this->EnableSaving)
-    materialStage->Save();
+  BRIDGE_USDWRITER.MarkStageDirty(materialStage);
 #endif
 }
 
@@ -749,6 +1046,7 @@ void UsdBridge::DeleteAllRefs(ParentHandleType parentHandle, const char* refPath
 void UsdBridge::DeleteInstanceRefs(UsdWorldHandle world, bool timeVarying, double timeStep)
 {
   DeleteAllRefs(world, instancePathRp, timeVarying, timeStep);
+  DeleteAllRefs(world, instancerPathRp, timeVarying, timeStep);
 }
 
 void UsdBridge::DeleteGroupRef(UsdInstanceHandle instance, bool timeVarying, double timeStep)
@@ -842,11 +1140,10 @@ void UsdBridge::SetGeometryDataTemplate(UsdGeometryHandle geometry, const GeomDa
 #endif
   );
   
-  BRIDGE_USDWRITER.UpdateUsdGeometry(geomStage, geomPath, geomData, timeStep);
+  BRIDGE_USDWRITER.UpdateUsdGeometry(geomStage, cache, geomData, timeStep);
 
 #ifdef VALUE_CLIP_RETIMING
-  if(this->EnableSaving)
-    geomStage->Save();
+  BRIDGE_USDWRITER.MarkStageDirty(geomStage);
 #endif
 }
 
@@ -882,8 +1179,7 @@ void UsdBridge::SetSpatialFieldData(UsdSpatialFieldHandle field, const UsdBridge
   BRIDGE_USDWRITER.UpdateUsdVolume(volumeStage, cache, volumeData, timeStep);
 
 #ifdef VALUE_CLIP_RETIMING
-  if(this->EnableSaving)
-    volumeStage->Save();
+  BRIDGE_USDWRITER.MarkStageDirty(volumeStage);
 #endif
 }
 
@@ -905,8 +1201,7 @@ void UsdBridge::SetMaterialData(UsdMaterialHandle material, const UsdBridgeMater
   BRIDGE_USDWRITER.UpdateUsdMaterial(materialStage, matPrimPath, matData, boundGeomPrimvars, timeStep);
 
 #ifdef VALUE_CLIP_RETIMING
-  if(this->EnableSaving)
-    materialStage->Save();
+  BRIDGE_USDWRITER.MarkStageDirty(materialStage);
 #endif
 }
 
@@ -926,8 +1221,7 @@ void UsdBridge::SetSamplerData(UsdSamplerHandle sampler, const UsdBridgeSamplerD
   BRIDGE_USDWRITER.UpdateUsdSampler(samplerStage, cache, samplerData, timeStep);
 
 #ifdef VALUE_CLIP_RETIMING
-  if(this->EnableSaving)
-    samplerStage->Save();
+  BRIDGE_USDWRITER.MarkStageDirty(samplerStage);
 #endif
 }
 
@@ -950,8 +1244,7 @@ void UsdBridge::SetCameraData(UsdCameraHandle camera, const UsdBridgeCameraData&
   BRIDGE_USDWRITER.UpdateUsdCamera(cameraStage, cameraPath, cameraData, timeStep, timeVarHasChanged);
 
 #ifdef VALUE_CLIP_RETIMING
-  if(this->EnableSaving)
-    cameraStage->Save();
+  BRIDGE_USDWRITER.MarkStageDirty(cameraStage);
 #endif
 }
 
@@ -997,8 +1290,7 @@ void UsdBridge::ChangeInAttribute(UsdSamplerHandle sampler, const char* newName,
   BRIDGE_USDWRITER.UpdateInAttribute(samplerStage, samplerPrimPath, newName, timeStep, timeVarying);
 
 #ifdef VALUE_CLIP_RETIMING
-  if(this->EnableSaving)
-    samplerStage->Save();
+  BRIDGE_USDWRITER.MarkStageDirty(samplerStage);
 #endif
 }
 
@@ -1006,8 +1298,120 @@ void UsdBridge::SaveScene()
 {
   if (!SessionValid) return;
 
+  BRIDGE_USDWRITER.UpdateUsdGeometryLods();
+#ifdef VALUE_CLIP_RETIMING
+  BRIDGE_USDWRITER.FlushClipMetaData(); // Clip metadata changed during this frame
+#endif
+
   if(this->EnableSaving)
+  {
+    // Make sure an older snapshot cannot overwrite the result
+    Internals->WaitForPendingSaves();
+
+    BRIDGE_USDWRITER.SaveDirtyStages();
+    BRIDGE_USDWRITER.SaveTimestepLayers();
     BRIDGE_USDWRITER.GetSceneStage()->Save();
+  }
+  BRIDGE_USDWRITER.RemoveSavedFiles([](uint64_t) { return true; }); // Earlier background saves have finished as well
+
+  BRIDGE_USDWRITER.ScratchArena.Release();
+  Internals->FlushDiagnostics();
+}
+
+uint64_t UsdBridge::SaveSceneAsync(uint32_t maxPendingSaves)
+{
+  if (SessionValid)
+  {
+    BRIDGE_USDWRITER.UpdateUsdGeometryLods(); // Levels of detail finished in the background become part of this snapshot
+#ifdef VALUE_CLIP_RETIMING
+    BRIDGE_USDWRITER.FlushClipMetaData();
+#endif
+  }
+
+  BRIDGE_USDWRITER.ScratchArena.Release(); // Conversion for this frame is done
+
+  Internals->FlushDiagnostics(); // Messages of earlier background saves
+
+  if (!SessionValid) return 0;
+
+  if (!this->EnableSaving)
+  {
+    BRIDGE_USDWRITER.RemoveSavedFiles([](uint64_t) { return true; });
+    return 0;
+  }
+
+  // Files of removed prims can go once the background save that doesn't refer to them anymore has been written
+  BRIDGE_USDWRITER.RemoveSavedFiles([this](uint64_t saveId)
+  {
+    std::lock_guard<std::mutex> lock(Internals->SaveMutex);
+    return saveId && !Internals->SaveIsPending(saveId);
+  });
+
+  // All layers that SaveScene() would write are saved in the background: prim, clip and manifest stages, timestep layers
+  // and the layer stack of the scene, with its root layer last. As with SaveScene(), only modified layers are written.
+  std::vector<SdfLayerRefPtr> dirtyLayers;
+  BRIDGE_USDWRITER.CollectDirtyLayers(dirtyLayers);
+
+  UsdStageRefPtr sceneStage = BRIDGE_USDWRITER.GetSceneStage();
+  SdfLayerHandle rootLayer = sceneStage->GetRootLayer();
+
+  for(const SdfLayerHandle& layer : sceneStage->GetLayerStack(false))
+  {
+    if(layer != rootLayer && !layer->IsAnonymous() && layer->IsDirty())
+      dirtyLayers.emplace_back(layer);
+  }
+
+  if(!rootLayer->IsAnonymous() && rootLayer->IsDirty())
+    dirtyLayers.emplace_back(rootLayer);
+
+  if(dirtyLayers.empty())
+    return 0;
+
+  uint64_t saveId = Internals->QueueSceneSave(dirtyLayers, maxPendingSaves);
+  BRIDGE_USDWRITER.AssignFileRemovalsToSave(saveId);
+  return saveId;
+}
+
+bool UsdBridge::IsSaveFinished(uint64_t saveId, bool wait)
+{
+  if (saveId == 0) return true;
+
+  bool finished;
+  {
+    std::unique_lock<std::mutex> lock(Internals->SaveMutex);
+    if(wait)
+      Internals->SaveCondition.wait(lock, [this, saveId]{ return !Internals->SaveIsPending(saveId); });
+    finished = !Internals->SaveIsPending(saveId);
+  }
+
+  Internals->FlushDiagnostics();
+  return finished;
+}
+
+void UsdBridge::CancelSave(uint64_t saveId)
+{
+  if (saveId == 0) return;
+
+  // Snapshots only contain the layers modified since the previous save, so a save which hasn't started yet can only be dropped
+  // by merging it into the next queued save. Without a next save (or once started), it is still written.
+  uint64_t nextSaveId = 0;
+  {
+    std::lock_guard<std::mutex> lock(Internals->SaveMutex);
+    auto& pendingSaves = Internals->PendingSaves;
+    auto it = std::find_if(pendingSaves.begin(), pendingSaves.end(),
+      [saveId](const UsdBridgeInternals::PendingSave& save) { return save.SaveId == saveId; });
+    if(it == pendingSaves.end() || std::next(it) == pendingSaves.end())
+      return;
+
+    auto nextIt = std::next(it);
+    Internals->MergeIntoNextSave(*it, *nextIt);
+    nextSaveId = nextIt->SaveId;
+    pendingSaves.erase(it);
+  }
+  Internals->SaveCondition.notify_all();
+
+  // Files removed before the dropped snapshot can only go once the merged save has been written
+  BRIDGE_USDWRITER.AssignFileRemovalsToSave(nextSaveId, saveId);
 }
 
 void UsdBridge::ResetResourceUpdateState()
@@ -1017,8 +1421,9 @@ void UsdBridge::ResetResourceUpdateState()
   BRIDGE_USDWRITER.ResetSharedResourceModified();
 }
 
-void UsdBridge::GarbageCollect()
+void UsdBridge::GarbageCollect(double timeBudget)
 {
+  // Only visits the caches that became unreferenced since the last call, so collecting every frame is cheap when nothing changed
   BRIDGE_CACHE.RemoveUnreferencedPrimCaches(
     [this](UsdBridgePrimCache* cacheEntry) 
     { 
@@ -1026,10 +1431,10 @@ void UsdBridge::GarbageCollect()
         cacheEntry->ResourceCollect(cacheEntry, BRIDGE_USDWRITER);
 
       BRIDGE_USDWRITER.DeletePrim(cacheEntry);
-    }
+    },
+    timeBudget
   );
-  if(this->EnableSaving)
-    BRIDGE_USDWRITER.GetSceneStage()->Save();
+  // The scene stage is saved along with the next frame (or at the end of the session)
 }
 
 const char* UsdBridge::GetPrimPath(UsdBridgeHandle* handle)
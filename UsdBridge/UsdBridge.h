@@ -21,6 +21,11 @@ class UsdBridge
 
     void SetExternalSceneStage(SceneStagePtr sceneStage);
     void SetEnableSaving(bool enableSaving);
+    void SetScratchMemoryLimit(uint64_t numBytes); // Memory for intermediate conversion arrays that is kept after saving the scene
+    void GetScratchMemoryUsage(uint64_t& currentBytes, uint64_t& peakBytes) const;
+    void SetLodSettings(const float* ratios, uint32_t numRatios, uint64_t minPrimitives); // Ratios of the primitive count per generated level of detail, empty disables
+    void SetKeepTimeSteps(uint32_t numTimeSteps); // Clip stages per object kept in memory after saving, 0 keeps all
+    void SetNumThreads(uint32_t numThreads); // Threads for the conversion and saving of large data, 0 for the hardware concurrency
   
     bool OpenSession(UsdBridgeLogCallback logCallback, void* logUserData);
     bool GetSessionValid() const { return SessionValid; }
@@ -51,6 +56,8 @@ class UsdBridge
     void DeleteCamera(UsdCameraHandle handle);
   
     void SetInstanceRefs(UsdWorldHandle world, const UsdInstanceHandle* instances, uint64_t numInstances, bool timeVarying, double timeStep, const int* instanceableValues);
+    // Alternative to SetInstanceRefs(), writing the instances as one point instancer per group; transforms holds a 4x4 matrix per instance
+    void SetInstancerRefs(UsdWorldHandle world, const UsdGroupHandle* groups, const float* transforms, uint64_t numInstances, bool timeVarying, double timeStep);
     void SetGroupRef(UsdInstanceHandle instance, UsdGroupHandle group, bool timeVarying, double timeStep);
     void SetSurfaceRefs(UsdWorldHandle world, const UsdSurfaceHandle* surfaces, uint64_t numSurfaces, bool timeVarying, double timeStep, const int* instanceableValues);
     void SetSurfaceRefs(UsdGroupHandle group, const UsdSurfaceHandle* surfaces, uint64_t numSurfaces, bool timeVarying, double timeStep, const int* instanceableValues);
@@ -89,10 +96,13 @@ class UsdBridge
     void ChangeInAttribute(UsdSamplerHandle sampler, const char* newName, double timeStep, SamplerDMI timeVarying);
   
     void SaveScene();
+    uint64_t SaveSceneAsync(uint32_t maxPendingSaves); // Writes a snapshot of the scene in the background, blocks while maxPendingSaves saves are still in flight. Returns an id for IsSaveFinished/CancelSave, 0 if nothing is saved.
+    bool IsSaveFinished(uint64_t saveId, bool wait);
+    void CancelSave(uint64_t saveId); // Merges the save into the next queued one if it hasn't started yet, otherwise it is still written
 
     void ResetResourceUpdateState(); // Eg. clears all dirty flags on shared resources
 
-    void GarbageCollect(); // Deletes all handles without parents (from Set<X>Refs) 
+    void GarbageCollect(double timeBudget = 0.0); // Deletes all handles without parents (from Set<X>Refs), within timeBudget milliseconds if nonzero (the remainder is deleted by later calls)
 
     const char* GetPrimPath(UsdBridgeHandle* handle);
 
@@ -7,6 +7,8 @@ PXR_NAMESPACE_USING_DIRECTIVE
 #include "UsdBridgeCaches.h"
 #include "UsdBridgeUtils.h"
 
+#include <chrono>
+
 #ifdef VALUE_CLIP_RETIMING
 constexpr double UsdBridgePrimCache::PrimStageTimeCode;
 #endif
@@ -32,44 +34,145 @@ UsdBridgePrimCache* UsdBridgePrimCache::GetChildCache(const TfToken& nameToken)
 }
 
 #ifdef TIME_BASED_CACHING
-void UsdBridgePrimCache::SetChildVisibleAtTime(const UsdBridgePrimCache* childCache, double timeCode)
+UsdBridgePrimCache::ChildVisibility* UsdBridgePrimCache::GetChildVisibility(const UsdBridgePrimCache* childCache)
 {
-  auto childIt = std::find(this->Children.begin(), this->Children.end(), childCache);
-  if(childIt == this->Children.end())
-    return;
-  std::vector<double>& visibleTimes = ChildVisibleAtTimes[childIt - this->Children.begin()];
+  auto it = this->ChildVisibilities.find(childCache);
+  return (it == this->ChildVisibilities.end()) ? nullptr : &it->second;
+}
+#endif
+
+#ifdef VALUE_CLIP_RETIMING
+const UsdStagePair& UsdBridgePrimCache::GetPrimStagePair() const
+{
+  auto it = ClipStages.find(PrimStageTimeCode);
+  assert(it != ClipStages.end());
+  return it->second;
+}
+
+void UsdBridgePrimCache::RefClipMetaData::Reset(const SdfAssetPath& assetPath, double parentTimeStep, double childTimeStep)
+{
+  AssetPaths.assign(1, assetPath);
+  ClipActives.assign(1, GfVec2d(parentTimeStep, 0));
+  ClipTimes.assign(1, GfVec2d(parentTimeStep, childTimeStep));
 
-  auto timeIt = std::find(visibleTimes.begin(), visibleTimes.end(), timeCode);
-  if(timeIt == visibleTimes.end())
-    visibleTimes.push_back(timeCode);
+  AssetIndices.clear();
+  AssetIndices.emplace(assetPath.GetAssetPath(), 0);
+  AssetNumActives.assign(1, 1);
+  ActiveIndices.clear();
+  ActiveIndices.emplace(parentTimeStep, 0);
+  TimeIndices.clear();
+  TimeIndices.emplace(parentTimeStep, 0);
+
+  ActivesModified = true;
+  TimesModified = true;
 }
 
-bool UsdBridgePrimCache::SetChildInvisibleAtTime(const UsdBridgePrimCache* childCache, double timeCode)
+void UsdBridgePrimCache::RefClipMetaData::Load(const UsdClipsAPI& clipsApi)
 {
-  auto childIt = std::find(this->Children.begin(), this->Children.end(), childCache);
-  if(childIt == this->Children.end())
-    return false;
-  std::vector<double>& visibleTimes = ChildVisibleAtTimes[childIt - this->Children.begin()];
+  AssetPaths.clear();
+  ClipActives.clear();
+  ClipTimes.clear();
+  clipsApi.GetClipAssetPaths(&AssetPaths);
+  clipsApi.GetClipActive(&ClipActives);
+  clipsApi.GetClipTimes(&ClipTimes);
+
+  // The first of any duplicate entries is updated, as before indexing
+  AssetIndices.clear();
+  for(size_t assetIdx = 0; assetIdx < AssetPaths.size(); ++assetIdx)
+    AssetIndices.emplace(AssetPaths[assetIdx].GetAssetPath(), assetIdx);
 
-  auto timeIt = std::find(visibleTimes.begin(), visibleTimes.end(), timeCode);
-  if(timeIt != visibleTimes.end())
+  AssetNumActives.assign(AssetPaths.size(), 0);
+  ActiveIndices.clear();
+  for(size_t activeIdx = 0; activeIdx < ClipActives.size(); ++activeIdx)
   {
-    // Remove the time at visibleTimeIdx
-    size_t visibleTimeIdx = timeIt - visibleTimes.begin();
-    visibleTimes[visibleTimeIdx] = visibleTimes.back();
-    visibleTimes.pop_back();
-    return visibleTimes.size() == 0; // Return child removed && empty
+    const GfVec2d& active = ClipActives[activeIdx];
+    ActiveIndices.emplace(active[0], activeIdx);
+    size_t assetIdx = size_t(active[1]);
+    if(assetIdx < AssetNumActives.size())
+      ++AssetNumActives[assetIdx];
   }
-  return false;
+
+  TimeIndices.clear();
+  for(size_t timeIdx = 0; timeIdx < ClipTimes.size(); ++timeIdx)
+    TimeIndices.emplace(ClipTimes[timeIdx][0], timeIdx);
+
+  ActivesModified = false;
+  TimesModified = false;
 }
-#endif
 
-#ifdef VALUE_CLIP_RETIMING
-const UsdStagePair& UsdBridgePrimCache::GetPrimStagePair() const
+void UsdBridgePrimCache::RefClipMetaData::SetActiveAsset(double parentTimeStep, const SdfAssetPath& assetPath)
 {
-  auto it = ClipStages.find(PrimStageTimeCode);
-  assert(it != ClipStages.end());
-  return it->second;
+  auto assetIt = AssetIndices.find(assetPath.GetAssetPath());
+  bool newAsset = (assetIt == AssetIndices.end());
+  size_t assetIdx = newAsset ? AssetPaths.size() : assetIt->second;
+
+  auto activeIt = ActiveIndices.find(parentTimeStep);
+  if(activeIt == ActiveIndices.end())
+  {
+    // If timestep not found, just add (time, asset ref idx) to actives
+    ActiveIndices.emplace(parentTimeStep, ClipActives.size());
+    ClipActives.push_back(GfVec2d(parentTimeStep, double(assetIdx)));
+  }
+  else
+  {
+    size_t prevAssetIdx = size_t(ClipActives[activeIt->second][1]);
+    if(prevAssetIdx == assetIdx)
+      return;
+
+    if(newAsset && prevAssetIdx < AssetPaths.size() && AssetNumActives[prevAssetIdx] == 1)
+    {
+      // The previous asset isn't active at any other timestep, so replace the asset itself and leave the active entry unchanged
+      AssetIndices.erase(AssetPaths[prevAssetIdx].GetAssetPath());
+      AssetIndices.emplace(assetPath.GetAssetPath(), prevAssetIdx);
+      AssetPaths[prevAssetIdx] = assetPath;
+      ActivesModified = true;
+      return;
+    }
+
+    if(prevAssetIdx < AssetNumActives.size())
+      --AssetNumActives[prevAssetIdx];
+    ClipActives[activeIt->second][1] = double(assetIdx);
+  }
+
+  if(newAsset)
+  {
+    AssetIndices.emplace(assetPath.GetAssetPath(), assetIdx);
+    AssetPaths.push_back(assetPath);
+    AssetNumActives.push_back(0);
+  }
+  ++AssetNumActives[assetIdx];
+
+  ActivesModified = true;
+}
+
+void UsdBridgePrimCache::RefClipMetaData::SetClipTime(double parentTimeStep, double childTimeStep)
+{
+  auto timeIt = TimeIndices.find(parentTimeStep);
+  if(timeIt == TimeIndices.end())
+  {
+    TimeIndices.emplace(parentTimeStep, ClipTimes.size());
+    ClipTimes.push_back(GfVec2d(parentTimeStep, childTimeStep));
+  }
+  else if(ClipTimes[timeIt->second][1] != childTimeStep)
+    ClipTimes[timeIt->second][1] = childTimeStep;
+  else
+    return;
+
+  TimesModified = true;
+}
+
+void UsdBridgePrimCache::RefClipMetaData::Author(UsdClipsAPI& clipsApi)
+{
+  if(ActivesModified)
+  {
+    clipsApi.SetClipAssetPaths(AssetPaths);
+    clipsApi.SetClipActive(ClipActives);
+  }
+  if(TimesModified)
+    clipsApi.SetClipTimes(ClipTimes);
+
+  ActivesModified = false;
+  TimesModified = false;
 }
 #endif
 
@@ -82,7 +185,7 @@ void UsdBridgePrimCache::AddChild(UsdBridgePrimCache* child)
   child->IncRef();
 
 #ifdef TIME_BASED_CACHING
-  this->ChildVisibleAtTimes.resize(this->Children.size());
+  this->ChildVisibilities.emplace(child, ChildVisibility());
 #endif
 }
 
@@ -94,10 +197,7 @@ void UsdBridgePrimCache::RemoveChild(UsdBridgePrimCache* child)
   if(it != this->Children.end())
   {
 #ifdef TIME_BASED_CACHING
-    size_t foundIdx = it - this->Children.begin();
-    if(foundIdx != this->ChildVisibleAtTimes.size()-1)
-      this->ChildVisibleAtTimes[foundIdx] = std::move(this->ChildVisibleAtTimes.back());
-    this->ChildVisibleAtTimes.pop_back();
+    this->ChildVisibilities.erase(child);
 #endif
 
     child->DecRef();
@@ -106,16 +206,17 @@ void UsdBridgePrimCache::RemoveChild(UsdBridgePrimCache* child)
   }
 }
 
-void UsdBridgePrimCache::RemoveUnreferencedChildTree(AtRemoveFunc atRemove)
+void UsdBridgePrimCache::RemoveUnreferencedChildTree(AtRemoveFunc atRemove, UsdBridgePrimCacheList& removedCaches)
 {
   assert(this->RefCount == 0);
   atRemove(this);
+  removedCaches.push_back(this);
 
   for (UsdBridgePrimCache* child : this->Children)
   {
     child->DecRef();
     if(child->RefCount == 0)
-      child->RemoveUnreferencedChildTree(atRemove);
+      child->RemoveUnreferencedChildTree(atRemove, removedCaches);
   }
   this->Children.clear();
 }
@@ -147,6 +248,7 @@ UsdBridgePrimCacheManager::ConstPrimCacheIterator UsdBridgePrimCacheManager::Cre
 
   // Create new cache entry
   std::unique_ptr<UsdBridgePrimCache> cacheEntry = std::make_unique<UsdBridgePrimCache>(primPath, nameSuffix, collectFunc);
+  UnreferencedCaches.insert(cacheEntry.get()); // Collected if not referenced by the next garbage collect
   return UsdPrimCaches.emplace(name, std::move(cacheEntry)).first;
 }
 
@@ -158,6 +260,8 @@ void UsdBridgePrimCacheManager::AttachTopLevelPrim(UsdBridgePrimCache* primCache
 void UsdBridgePrimCacheManager::DetachTopLevelPrim(UsdBridgePrimCache* primCache)
 {
   primCache->DecRef();
+  if(primCache->RefCount == 0)
+    UnreferencedCaches.insert(primCache);
 }
 
 void UsdBridgePrimCacheManager::AddChild(UsdBridgePrimCache* parent, UsdBridgePrimCache* child)
@@ -168,6 +272,8 @@ void UsdBridgePrimCacheManager::AddChild(UsdBridgePrimCache* parent, UsdBridgePr
 void UsdBridgePrimCacheManager::RemoveChild(UsdBridgePrimCache* parent, UsdBridgePrimCache* child)
 {
   parent->RemoveChild(child);
+  if(child->RefCount == 0)
+    UnreferencedCaches.insert(child);
 }
 
 void UsdBridgePrimCacheManager::RemovePrimCache(ConstPrimCacheIterator it, UsdBridgeLogObject& LogObject) 
@@ -176,31 +282,42 @@ void UsdBridgePrimCacheManager::RemovePrimCache(ConstPrimCacheIterator it, UsdBr
   {
     UsdBridgeLogMacro(LogObject, UsdBridgeLogLevel::WARNING, "Primcache removed for object named: " << it->first << ", but refs still exist");
   }
+  UnreferencedCaches.erase(it->second.get());
   UsdPrimCaches.erase(it); 
 }
 
-void UsdBridgePrimCacheManager::RemoveUnreferencedPrimCaches(AtRemoveFunc atRemove)
+size_t UsdBridgePrimCacheManager::RemoveUnreferencedPrimCaches(AtRemoveFunc atRemove, double timeBudget)
 {
-  // First recursively remove all the child references for unreferenced prims
+  // Recursively remove all the child references for unreferenced prims, starting from the caches that dropped to zero refs
   // Can only be performed at garbage collect.
   // If this is done during RemoveChild, an unreferenced parent cannot subsequently be revived with an AddChild.
-  PrimCacheContainer::iterator it = UsdPrimCaches.begin();
-  while (it != UsdPrimCaches.end())
+  auto startTime = std::chrono::steady_clock::now();
+  size_t numRemoved = 0;
+
+  while (!UnreferencedCaches.empty())
   {
-    if (it->second->RefCount == 0)
+    auto candidateIt = UnreferencedCaches.begin();
+    UsdBridgePrimCache* primCache = *candidateIt;
+    UnreferencedCaches.erase(candidateIt);
+    if (primCache->RefCount != 0)
+      continue; // Revived since it became unreferenced
+
+    RemovedCaches.clear();
+    primCache->RemoveUnreferencedChildTree(atRemove, RemovedCaches);
+
+    // Now delete the removed prims from the cache
+    for (UsdBridgePrimCache* removedCache : RemovedCaches)
     {
-      it->second->RemoveUnreferencedChildTree(atRemove);
+      UnreferencedCaches.erase(removedCache);
+      UsdPrimCaches.erase(removedCache->Name.GetString());
     }
-    ++it;
-  }
+    numRemoved += RemovedCaches.size();
 
-  // Now delete all prims without references from the cache
-  it = UsdPrimCaches.begin();
-  while (it != UsdPrimCaches.end())
-  {
-    if (it->second->RefCount == 0)
-      it = UsdPrimCaches.erase(it);
-    else
-      ++it;
+    if (timeBudget > 0.0 &&
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() >= timeBudget)
+      break;
   }
+  RemovedCaches.clear();
+
+  return numRemoved;
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <list>
+#include <unordered_set>
 
 #include "UsdBridgeData.h"
 #include "UsdBridgeUtils_Internal.h"
@@ -82,9 +84,37 @@ public:
 
   std::unique_ptr<ResourceContainer> ResourceKeys; // Referenced resources
 
+  // Last authored array value per attribute name, along with a key identifying the source data it was converted from
+  struct ArrayValueEntry
+  {
+    uint64_t ValueKey = 0;
+    VtValue Value;
+  };
+  std::unordered_map<TfToken, ArrayValueEntry, TfToken::HashFunctor> ArrayValues;
+  // Time codes at which a topology sample has been left out, as the attribute already held the same value there
+  std::unordered_map<TfToken, std::vector<double>, TfToken::HashFunctor> HeldArrayTimes;
+  // Caches of the child prims holding the data of a geometry too large for a single prim (mesh parts or instancer tiles), in order of their index
+  std::vector<std::unique_ptr<UsdBridgePrimCache>> GeometryParts;
+  // Caches of the child prims holding the levels of detail of a geometry, the full resolution first
+  std::vector<std::unique_ptr<UsdBridgePrimCache>> LodLevels;
+  uint64_t LodSourceKey = 0; // Identifies the source data of the last submitted level of detail job, 0 if unknown
+  bool LodEnabled = false;
+
+  // Names of the referencing prims in the scene stage per base path of this prim (its own path, or extended with a ref path).
+  // Initialized from the stage on first use and kept in sync with the references added and removed by the writer,
+  // so the references that are no longer in use can be found without comparing against every prim below the base path.
+  typedef std::unordered_set<TfToken, TfToken::HashFunctor> RefNameSet;
+  std::unordered_map<SdfPath, RefNameSet, SdfPath::Hash> RefNames;
+
 #ifdef TIME_BASED_CACHING
-  void SetChildVisibleAtTime(const UsdBridgePrimCache* childCache, double timeCode);
-  bool SetChildInvisibleAtTime(const UsdBridgePrimCache* childCache, double timeCode); // Returns whether timeCode has been removed AND the visible timeset is empty.
+  // Visibility of a child (mimicks visibility attribute on the referencing prim) at the timesteps it has been set, in sorted order.
+  // Only the first timestep of every run of equal states holds a visibility sample, so a child visible over many timesteps is authored as a single interval (unless the scene uses timestep layers, see UsdBridgeUsdWriter::SetVisibilityAtTime()).
+  struct ChildVisibility
+  {
+    std::map<double, bool> States;
+    size_t NumVisible = 0; // Number of visible states
+  };
+  ChildVisibility* GetChildVisibility(const UsdBridgePrimCache* childCache); // Returns null if childCache is not a child
 #endif
 
 #ifdef VALUE_CLIP_RETIMING
@@ -95,9 +125,35 @@ public:
   bool TimeVarBitsUpdate(DataMemberType newTimeVarBits);
 
   UsdStagePair ManifestStage; // Holds the manifest
-  std::unordered_map<double, UsdStagePair> ClipStages; // Holds the stage(s) to the timevarying data
+  std::unordered_map<double, UsdStagePair> ClipStages; // Holds the stage(s) to the timevarying data, a released clip stage only keeps its filename
+#ifdef TIME_CLIP_STAGES
+  std::list<double> LoadedClipTimeSteps; // Timesteps of the clip stages held in memory, least recently used first
+  std::unordered_map<double, std::list<double>::iterator> LoadedClipPositions; // Entries of LoadedClipTimeSteps by timestep
+#endif
 
   uint32_t LastTimeVaryingBits = 0; // Used to detect changes in timevarying status of parameters
+
+  // Clip metadata of a prim referencing a child through value clips, indexed by parent timestep and asset path so updates don't search the authored arrays.
+  // Changes are authored once per frame, see UsdBridgeUsdWriter::FlushClipMetaData()
+  struct RefClipMetaData
+  {
+    void Reset(const SdfAssetPath& assetPath, double parentTimeStep, double childTimeStep);
+    void Load(const UsdClipsAPI& clipsApi); // Indexes the metadata authored on a prim of a reopened scene
+    void SetActiveAsset(double parentTimeStep, const SdfAssetPath& assetPath);
+    void SetClipTime(double parentTimeStep, double childTimeStep);
+    void Author(UsdClipsAPI& clipsApi);
+
+    VtArray<SdfAssetPath> AssetPaths;
+    VtVec2dArray ClipActives;
+    VtVec2dArray ClipTimes;
+    std::unordered_map<std::string, size_t> AssetIndices; // Index in AssetPaths per asset path
+    std::vector<size_t> AssetNumActives; // Number of entries in ClipActives per asset
+    std::unordered_map<double, size_t> ActiveIndices; // Index in ClipActives per parent timestep
+    std::unordered_map<double, size_t> TimeIndices; // Index in ClipTimes per parent timestep
+    bool ActivesModified = false;
+    bool TimesModified = false;
+  };
+  std::unordered_map<SdfPath, RefClipMetaData, SdfPath::Hash> RefClipMetaDatas; // By path of the referencing prim
 #endif
 
 #ifndef NDEBUG
@@ -107,13 +163,12 @@ public:
   protected:
     void AddChild(UsdBridgePrimCache* child);
     void RemoveChild(UsdBridgePrimCache* child);
-    void RemoveUnreferencedChildTree(AtRemoveFunc atRemove);
+    void RemoveUnreferencedChildTree(AtRemoveFunc atRemove, UsdBridgePrimCacheList& removedCaches);
 
     std::vector<UsdBridgePrimCache*> Children;
 
 #ifdef TIME_BASED_CACHING
-    // For each child, hold a vector of timesteps where it's visible (mimicks visibility attribute on the referencing prim)
-    std::vector<std::vector<double>> ChildVisibleAtTimes;
+    std::unordered_map<const UsdBridgePrimCache*, ChildVisibility> ChildVisibilities;
 #endif
 };
 
@@ -140,7 +195,9 @@ public:
 
   ConstPrimCacheIterator CreatePrimCache(const std::string& name, const std::string& fullPath, ResourceCollectFunc collectFunc = nullptr);
   void RemovePrimCache(ConstPrimCacheIterator it, UsdBridgeLogObject& LogObject);
-  void RemoveUnreferencedPrimCaches(AtRemoveFunc atRemove);
+  // Removes the caches that have become unreferenced since the last call, along with their descendants that become unreferenced as a result.
+  // Stops once timeBudget milliseconds have passed (0 for no limit), leaving the remaining caches for the next call. Returns the number of removed caches.
+  size_t RemoveUnreferencedPrimCaches(AtRemoveFunc atRemove, double timeBudget = 0.0);
 
   void AddChild(UsdBridgePrimCache* parent, UsdBridgePrimCache* child);
   void RemoveChild(UsdBridgePrimCache* parent, UsdBridgePrimCache* child);
@@ -151,6 +208,8 @@ public:
 protected:
 
   PrimCacheContainer UsdPrimCaches;
+  std::unordered_set<UsdBridgePrimCache*> UnreferencedCaches; // Caches created or dropped to a refcount of zero, to be visited at garbage collect
+  UsdBridgePrimCacheList RemovedCaches; // Temporary
 };
 
 #ifdef VALUE_CLIP_RETIMING
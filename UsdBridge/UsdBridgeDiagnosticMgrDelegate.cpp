@@ -4,11 +4,13 @@
 
 #include "UsdBridgeDiagnosticMgrDelegate.h"
 
-bool UsdBridgeDiagnosticMgrDelegate::OutputEnabled = false;
+std::atomic<bool> UsdBridgeDiagnosticMgrDelegate::OutputEnabled(false);
+thread_local bool UsdBridgeDiagnosticMgrDelegate::OutputSuppressed = false;
 
 UsdBridgeDiagnosticMgrDelegate::UsdBridgeDiagnosticMgrDelegate(void* logUserData, UsdBridgeLogCallback logCallback)
     : LogUserData(logUserData)
     , LogCallback(logCallback)
+    , CallingThread(std::this_thread::get_id())
 {}
 
 void UsdBridgeDiagnosticMgrDelegate::IssueError(TfError const& err)
@@ -52,6 +54,30 @@ void UsdBridgeDiagnosticMgrDelegate::LogTfMessage(UsdBridgeLogLevel level, TfDia
 
 void UsdBridgeDiagnosticMgrDelegate::LogMessage(UsdBridgeLogLevel level, const std::string& message)
 {
-    if(OutputEnabled)
+    if(!OutputEnabled || OutputSuppressed)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(DeferredMutex);
+        if(std::this_thread::get_id() != CallingThread)
+        {
+            DeferredMessages.emplace_back(level, message);
+            return;
+        }
+    }
+
     LogCallback(level, LogUserData, message.c_str());
+}
+
+void UsdBridgeDiagnosticMgrDelegate::FlushDeferredMessages()
+{
+    std::vector<std::pair<UsdBridgeLogLevel, std::string>> messages;
+    {
+        std::lock_guard<std::mutex> lock(DeferredMutex);
+        CallingThread = std::this_thread::get_id();
+        messages.swap(DeferredMessages);
+    }
+
+    for(const auto& message : messages)
+        LogCallback(message.first, LogUserData, message.second.c_str());
 }
\ No newline at end of file
@@ -9,6 +9,11 @@
 #include "usd.h"
 PXR_NAMESPACE_USING_DIRECTIVE
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 class UsdBridgeDiagnosticMgrDelegate : public TfDiagnosticMgr::Delegate
 {
   public:
@@ -24,7 +29,12 @@ class UsdBridgeDiagnosticMgrDelegate : public TfDiagnosticMgr::Delegate
 
     void IssueWarning(TfWarning const& warning) override;
 
-    static void SetOutputEnabled(bool enable){ OutputEnabled = enable; }
+    // Output stays disabled until first enabled. Disabling only applies to the current thread, so it doesn't drop the messages of other threads (background saves).
+    static void SetOutputEnabled(bool enable){ OutputSuppressed = !enable; if(enable) OutputEnabled = true; }
+
+    // Messages issued on other threads than the calling thread (background saves, parallel writes) are deferred until this is called,
+    // so the log callback is only invoked from the thread using the bridge. The calling thread is the last one to call this function.
+    void FlushDeferredMessages();
 
   protected:
 
@@ -34,7 +44,12 @@ class UsdBridgeDiagnosticMgrDelegate : public TfDiagnosticMgr::Delegate
 
     void* LogUserData;
     UsdBridgeLogCallback LogCallback;
-    static bool OutputEnabled;
+    static std::atomic<bool> OutputEnabled;
+    static thread_local bool OutputSuppressed;
+
+    std::thread::id CallingThread;
+    std::mutex DeferredMutex;
+    std::vector<std::pair<UsdBridgeLogLevel, std::string>> DeferredMessages;
 };
 
 #endif
\ No newline at end of file
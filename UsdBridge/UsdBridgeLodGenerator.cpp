@@ -0,0 +1,114 @@
+// Copyright 2020 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UsdBridgeLodGenerator.h"
+
+#include <algorithm>
+
+UsdBridgeLodGenerator::~UsdBridgeLodGenerator()
+{
+  Stop();
+}
+
+void UsdBridgeLodGenerator::DropJobs(const UsdBridgePrimCache* cacheEntry, bool matchTimeStep, double timeStep)
+{
+  auto matchesJob = [cacheEntry, matchTimeStep, timeStep](const std::unique_ptr<Job>& job)
+    { return job->CacheEntry == cacheEntry && (!matchTimeStep || job->TimeStep == timeStep); };
+
+  QueuedJobs.erase(std::remove_if(QueuedJobs.begin(), QueuedJobs.end(), matchesJob), QueuedJobs.end());
+  FinishedJobs.erase(std::remove_if(FinishedJobs.begin(), FinishedJobs.end(), matchesJob), FinishedJobs.end());
+  if(ActiveJob && ActiveJob->CacheEntry == cacheEntry && (!matchTimeStep || ActiveJob->TimeStep == timeStep))
+    ActiveJobDropped = true;
+}
+
+void UsdBridgeLodGenerator::Submit(std::unique_ptr<Job> job)
+{
+  {
+    std::lock_guard<std::mutex> lock(JobMutex);
+
+    DropJobs(job->CacheEntry, true, job->TimeStep);
+    QueuedJobs.emplace_back(std::move(job));
+
+    if(!Worker.joinable())
+    {
+      StopWorker = false;
+      Worker = std::thread(&UsdBridgeLodGenerator::WorkerFunc, this);
+    }
+  }
+  JobCondition.notify_all();
+}
+
+void UsdBridgeLodGenerator::Cancel(const UsdBridgePrimCache* cacheEntry)
+{
+  std::lock_guard<std::mutex> lock(JobMutex);
+  DropJobs(cacheEntry, false, 0.0);
+}
+
+void UsdBridgeLodGenerator::TakeFinishedJobs(std::vector<std::unique_ptr<Job>>& finishedJobs)
+{
+  std::vector<std::unique_ptr<Job>> takenJobs;
+  {
+    std::lock_guard<std::mutex> lock(JobMutex);
+    takenJobs.swap(FinishedJobs);
+  }
+
+  for(std::unique_ptr<Job>& job : takenJobs)
+    finishedJobs.emplace_back(std::move(job));
+}
+
+void UsdBridgeLodGenerator::WaitForJobs()
+{
+  std::unique_lock<std::mutex> lock(JobMutex);
+  JobCondition.wait(lock, [this]{ return QueuedJobs.empty() && !ActiveJob; });
+}
+
+void UsdBridgeLodGenerator::Stop()
+{
+  std::vector<std::unique_ptr<Job>> droppedJobs; // Destructed outside of the lock
+  {
+    std::lock_guard<std::mutex> lock(JobMutex);
+    for(std::unique_ptr<Job>& job : QueuedJobs)
+      droppedJobs.emplace_back(std::move(job));
+    QueuedJobs.clear();
+    for(std::unique_ptr<Job>& job : FinishedJobs)
+      droppedJobs.emplace_back(std::move(job));
+    FinishedJobs.clear();
+    ActiveJobDropped = true;
+    StopWorker = true;
+  }
+  JobCondition.notify_all();
+
+  if(Worker.joinable())
+    Worker.join();
+}
+
+void UsdBridgeLodGenerator::WorkerFunc()
+{
+  std::unique_lock<std::mutex> lock(JobMutex);
+  while(true)
+  {
+    JobCondition.wait(lock, [this]{ return StopWorker || !QueuedJobs.empty(); });
+    if(StopWorker)
+      break;
+
+    std::unique_ptr<Job> job = std::move(QueuedJobs.front());
+    QueuedJobs.pop_front();
+    ActiveJob = job.get();
+    ActiveJobDropped = false;
+    lock.unlock();
+
+    job->Build();
+
+    lock.lock();
+    if(ActiveJobDropped)
+    {
+      lock.unlock();
+      job.reset(); // Releases the retained source data
+      lock.lock();
+    }
+    else
+      FinishedJobs.emplace_back(std::move(job));
+    ActiveJob = nullptr;
+    JobCondition.notify_all();
+  }
+}
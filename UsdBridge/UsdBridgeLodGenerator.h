@@ -0,0 +1,62 @@
+// Copyright 2020 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UsdBridgeLodGenerator_h
+#define UsdBridgeLodGenerator_h
+
+#include "UsdBridgeData.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct UsdBridgePrimCache;
+
+// Computes the levels of detail of geometry on a background thread, so their generation does not add to the latency of geometry updates.
+// Jobs are built in order of submission, after which the writer picks them up with TakeFinishedJobs() to author their results.
+class UsdBridgeLodGenerator
+{
+public:
+  struct Job
+  {
+    virtual ~Job() = default;
+    virtual void Build() = 0; // Runs on the generator thread, so it may only access data owned or retained by the job
+
+    UsdBridgePrimCache* CacheEntry = nullptr; // Geometry the levels are generated for, only used as identifier by the generator
+    double TimeStep = 0.0;
+    UsdBridgeGeomType GeomType = UsdBridgeGeomType::MESH;
+    unsigned int NumThreads = 0; // Threads Build() distributes its work over, as passed to ubutils::ParallelFor
+  };
+
+  ~UsdBridgeLodGenerator();
+
+  // Queues the job, superseding any job for the same cache entry and timestep that hasn't been taken yet (a running job is dropped once finished).
+  // The thread is started on first use.
+  void Submit(std::unique_ptr<Job> job);
+  // Drops all jobs for cacheEntry, eg. when the geometry is deleted or its levels of detail are disabled
+  void Cancel(const UsdBridgePrimCache* cacheEntry);
+  // Moves the jobs finished since the last call into finishedJobs, in order of submission
+  void TakeFinishedJobs(std::vector<std::unique_ptr<Job>>& finishedJobs);
+  // Blocks until all submitted jobs have finished
+  void WaitForJobs();
+  // Discards all jobs that haven't been taken and stops the thread
+  void Stop();
+
+protected:
+  void DropJobs(const UsdBridgePrimCache* cacheEntry, bool matchTimeStep, double timeStep); // Requires JobMutex to be locked
+  void WorkerFunc();
+
+  std::thread Worker;
+  std::mutex JobMutex;
+  std::condition_variable JobCondition;
+  std::deque<std::unique_ptr<Job>> QueuedJobs;
+  std::vector<std::unique_ptr<Job>> FinishedJobs;
+  Job* ActiveJob = nullptr; // Job currently being built by Worker, null if none
+  bool ActiveJobDropped = false;
+  bool StopWorker = false;
+};
+
+#endif
@@ -0,0 +1,75 @@
+// Copyright 2020 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UsdBridgeScratchArena.h"
+
+#include <algorithm>
+#include <vector>
+
+UsdBridgeScratchArena::ScratchSlotBase& UsdBridgeScratchArena::FindOrCreateSlot(const std::type_index& arrayType, std::unique_ptr<ScratchSlotBase>(*createSlot)())
+{
+  std::lock_guard<std::mutex> lock(ArenaMutex);
+
+  std::unique_ptr<ScratchSlotBase>& slotPtr = Slots[arrayType];
+  if(!slotPtr)
+    slotPtr = createSlot();
+  ScratchSlotBase& slot = *slotPtr;
+
+  // The content from the slot's previous use counts towards the peak, the capacity left after clearing towards the current bytes
+  UpdateSlotBytes(slot, slot.GetNumBytes());
+  slot.Clear();
+  UpdateSlotBytes(slot, slot.GetNumBytes());
+
+  return slot;
+}
+
+void UsdBridgeScratchArena::UpdateSlotBytes(ScratchSlotBase& slot, size_t numBytes)
+{
+  CurrentBytes = CurrentBytes - slot.AccountedBytes + numBytes;
+  slot.AccountedBytes = numBytes;
+  PeakBytes = std::max(PeakBytes, CurrentBytes);
+}
+
+void UsdBridgeScratchArena::Release()
+{
+  std::lock_guard<std::mutex> lock(ArenaMutex);
+
+  CurrentBytes = 0;
+  std::vector<ScratchSlotBase*> slots;
+  for(auto& typeSlot : Slots)
+  {
+    ScratchSlotBase* slot = typeSlot.second.get();
+    slot->Clear();
+    slot->AccountedBytes = slot->GetNumBytes();
+    CurrentBytes += slot->AccountedBytes;
+    slots.push_back(slot);
+  }
+
+  std::sort(slots.begin(), slots.end(),
+    [](const ScratchSlotBase* lhs, const ScratchSlotBase* rhs) { return lhs->AccountedBytes > rhs->AccountedBytes; });
+  for(size_t i = 0; i < slots.size() && CurrentBytes > RetainedBytesLimit; ++i)
+  {
+    ScratchSlotBase* slot = slots[i];
+    CurrentBytes -= slot->AccountedBytes;
+    slot->Free();
+    slot->AccountedBytes = 0;
+  }
+}
+
+void UsdBridgeScratchArena::SetRetainedBytesLimit(size_t numBytes)
+{
+  std::lock_guard<std::mutex> lock(ArenaMutex);
+  RetainedBytesLimit = numBytes;
+}
+
+size_t UsdBridgeScratchArena::GetCurrentBytes() const
+{
+  std::lock_guard<std::mutex> lock(ArenaMutex);
+  return CurrentBytes;
+}
+
+size_t UsdBridgeScratchArena::GetPeakBytes() const
+{
+  std::lock_guard<std::mutex> lock(ArenaMutex);
+  return PeakBytes;
+}
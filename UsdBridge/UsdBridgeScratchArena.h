@@ -0,0 +1,76 @@
+// Copyright 2020 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UsdBridgeScratchArena_h
+#define UsdBridgeScratchArena_h
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+// Temporary arrays for intermediate results of the conversion of bridge data into USD values, one per array type.
+// Arrays are handed out empty but keep their capacity between uses, until Release() trims the retained memory down to a limit.
+// Arrays that are set as attribute values are shared with the layer (VtArray is copy-on-write), so their memory can't be reused;
+// only arrays that stay private to the writer should be taken from the arena. The arena belongs to a writer, which converts
+// on a single thread (parallel kernels write into the arrays, but never take them), so it isn't keyed per thread.
+class UsdBridgeScratchArena
+{
+public:
+  static constexpr size_t DefaultRetainedBytesLimit = size_t(64) << 20;
+
+  // Returns the scratch array of ArrayType, resized to 0.
+  // The array stays valid until the next GetArray<ArrayType>(), or Release().
+  template<typename ArrayType>
+  ArrayType& GetArray();
+
+  // Frees the largest arrays until at most the retained bytes limit remains.
+  // Should only be called while no scratch arrays are in use, eg. after a save.
+  void Release();
+
+  void SetRetainedBytesLimit(size_t numBytes);
+  size_t GetCurrentBytes() const; // Memory held by the arrays, as of their last use
+  size_t GetPeakBytes() const; // Highest value of the memory held by the arrays, including their content when in use
+
+protected:
+  struct ScratchSlotBase
+  {
+    virtual ~ScratchSlotBase() = default;
+    virtual size_t GetNumBytes() const = 0;
+    virtual void Clear() = 0;
+    virtual void Free() = 0;
+
+    size_t AccountedBytes = 0;
+  };
+
+  template<typename ArrayType>
+  struct ScratchSlot : public ScratchSlotBase
+  {
+    size_t GetNumBytes() const override { return Array.capacity()*sizeof(typename ArrayType::value_type); }
+    void Clear() override { Array.resize(0); }
+    void Free() override { Array = ArrayType(); }
+
+    ArrayType Array;
+  };
+
+
+  ScratchSlotBase& FindOrCreateSlot(const std::type_index& arrayType, std::unique_ptr<ScratchSlotBase>(*createSlot)());
+  void UpdateSlotBytes(ScratchSlotBase& slot, size_t numBytes);
+
+  mutable std::mutex ArenaMutex; // The byte counts may be queried from other threads
+  std::unordered_map<std::type_index, std::unique_ptr<ScratchSlotBase>> Slots;
+  size_t CurrentBytes = 0;
+  size_t PeakBytes = 0;
+  size_t RetainedBytesLimit = DefaultRetainedBytesLimit;
+};
+
+template<typename ArrayType>
+ArrayType& UsdBridgeScratchArena::GetArray()
+{
+  ScratchSlotBase& slot = FindOrCreateSlot(std::type_index(typeid(ArrayType)),
+    []() -> std::unique_ptr<ScratchSlotBase> { return std::make_unique<ScratchSlot<ArrayType>>(); });
+  return static_cast<ScratchSlot<ArrayType>&>(slot).Array;
+}
+
+#endif
@@ -0,0 +1,498 @@
+// Copyright 2020 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UsdBridgeTimestepLayers.h"
+#include "UsdBridgeConnection.h"
+#include "UsdBridgeDiagnosticMgrDelegate.h"
+#include "UsdBridgeUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace
+{
+  const char* const clipSetName = "timestepLayers";
+  const char* const manifestName = "manifest";
+
+  void RemovePrimSpec(const SdfLayerHandle& layer, const SdfPath& primPath)
+  {
+    SdfPrimSpecHandle primSpec = layer->GetPrimAtPath(primPath);
+    if(primSpec)
+    {
+      SdfPrimSpecHandle parentSpec = primSpec->GetRealNameParent();
+      if(parentSpec)
+        parentSpec->RemoveNameChild(primSpec);
+    }
+  }
+
+  void RemovePropertySpec(const SdfLayerHandle& layer, const SdfPath& propertyPath)
+  {
+    SdfPrimSpecHandle primSpec = layer->GetPrimAtPath(propertyPath.GetPrimPath());
+    SdfPropertySpecHandle propertySpec = layer->GetPropertyAtPath(propertyPath);
+    if(primSpec && propertySpec)
+      primSpec->RemoveProperty(propertySpec);
+  }
+}
+
+void UsdBridgeTimestepLayers::Initialize(const UsdStageRefPtr& sceneStage, const std::vector<SdfPath>& anchorPaths, const UsdBridgeConnection* connect,
+  const UsdBridgeLogObject& logObj, const std::string& sessionDirectory, const std::string& layerPrefix, uint32_t timestepsPerLayer, bool binary)
+{
+  Reset();
+
+  // Clip asset paths are relative to the scene layer, so it has to exist on disk
+  if(timestepsPerLayer == 0 || anchorPaths.empty() || sceneStage->GetRootLayer()->IsAnonymous())
+    return;
+
+  TimestepsPerLayer = timestepsPerLayer;
+  SceneStage = sceneStage;
+  SceneLayer = sceneStage->GetRootLayer();
+  AnchorPaths = anchorPaths;
+  Connect = connect;
+  LogObject = logObj;
+  SessionDirectory = sessionDirectory;
+  LayerPrefix = layerPrefix;
+  LayerExtension = binary ? ".usd" : ".usda";
+
+  Manifest = FindOrCreateLayer(GetLayerPath(manifestName));
+  if(!Manifest)
+    return;
+
+  // Continue the chunks of a reopened session, if they have been written with the same number of timesteps per layer
+  UsdClipsAPI clipsApi(SceneStage->GetPrimAtPath(AnchorPaths[0]));
+  double stride = 0.0, startTime = 0.0, endTime = 0.0;
+  if(clipsApi.GetClipTemplateStride(&stride, clipSetName) && stride == timestepsPerLayer
+    && clipsApi.GetClipTemplateStartTime(&startTime, clipSetName) && clipsApi.GetClipTemplateEndTime(&endTime, clipSetName))
+  {
+    FirstChunkIdx = static_cast<int64_t>(startTime) / timestepsPerLayer;
+    LastChunkIdx = static_cast<int64_t>(endTime) / timestepsPerLayer;
+    ClipMetaDataValid = true;
+  }
+  else
+  {
+    Manifest->Clear();
+    ManifestModified = true;
+  }
+
+  // Only the attributes changed in the scene layer have to be visited by Flush(), apart from the samples the layer is opened with
+  LayersChangedKey = TfNotice::Register(TfCreateWeakPtr(this), &UsdBridgeTimestepLayers::LayersChanged, SceneLayer);
+  FullScanPending = true;
+}
+
+void UsdBridgeTimestepLayers::Reset()
+{
+  TimestepsPerLayer = 0;
+  LayerError = false;
+  SceneStage = UsdStagePtr();
+  SceneLayer = SdfLayerHandle();
+  AnchorPaths.clear();
+  Connect = nullptr;
+
+  TfNotice::Revoke(LayersChangedKey);
+  DirtyAttributes.clear();
+  FullScanPending = false;
+
+  Manifest = nullptr;
+  ManifestModified = false;
+
+  Chunks.clear();
+  FirstChunkIdx = 0;
+  LastChunkIdx = -1;
+  ClipMetaDataValid = false;
+
+  AttribChunks.clear();
+  RemovedPrims.clear();
+}
+
+void UsdBridgeTimestepLayers::LayersChanged(const SdfNotice::LayersDidChangeSentPerLayer& notice)
+{
+  for(const auto& layerChanges : notice.GetChangeListVec())
+  {
+    if(layerChanges.first != SceneLayer)
+      continue;
+
+    for(const auto& entry : layerChanges.second.GetEntryList())
+    {
+      const SdfPath& path = entry.first;
+      const SdfChangeList::Entry& changes = entry.second;
+
+      if(changes.flags.didReplaceContent || changes.flags.didReloadContent)
+        FullScanPending = true;
+      else if(changes.flags.didChangeAttributeTimeSamples)
+        DirtyAttributes.insert(path);
+      else
+      {
+        for(const auto& infoChange : changes.infoChanged)
+        {
+          if(infoChange.first == SdfFieldKeys->Default)
+            DirtyAttributes.insert(path);
+        }
+      }
+    }
+  }
+}
+
+bool UsdBridgeTimestepLayers::IsMovableAttribute(const SdfPath& path) const
+{
+  // Clip layers cannot hold variant opinions, so samples inside variants stay in the scene layer
+  if(!path.IsPrimPropertyPath() || path.ContainsPrimVariantSelection() || SceneLayer->GetSpecType(path) != SdfSpecTypeAttribute)
+    return false;
+
+  for(const SdfPath& anchorPath : AnchorPaths)
+  {
+    if(path.HasPrefix(anchorPath))
+      return true;
+  }
+  return false;
+}
+
+void UsdBridgeTimestepLayers::PrimRemoved(const SdfPath& primPath)
+{
+  if(IsEnabled())
+    RemovedPrims.push_back(primPath);
+}
+
+void UsdBridgeTimestepLayers::Flush(unsigned int numThreads, std::vector<SdfLayerRefPtr>* modifiedLayers)
+{
+  if(!IsEnabled())
+    return;
+
+  // Samples of removed prims are removed first, as the prim may have been recreated since
+  RemoveMovedPrims();
+
+  // Collect the attributes first, as the layer cannot be edited during traversal
+  std::vector<SdfPath> attribPaths;
+  if(FullScanPending)
+  {
+    for(const SdfPath& anchorPath : AnchorPaths)
+    {
+      SceneLayer->Traverse(anchorPath, [this, &attribPaths](const SdfPath& path)
+      {
+        if(IsMovableAttribute(path))
+          attribPaths.push_back(path);
+      });
+    }
+    FullScanPending = false;
+  }
+  else
+  {
+    for(const SdfPath& path : DirtyAttributes)
+    {
+      if(IsMovableAttribute(path))
+        attribPaths.push_back(path);
+    }
+  }
+
+  for(const SdfPath& attribPath : attribPaths)
+  {
+    if(LayerError)
+      break; // The remaining samples stay in the scene layer, which is stronger than the clips
+
+    if(SceneLayer->GetNumTimeSamplesForPath(attribPath) != 0)
+      MoveTimeSamples(attribPath);
+    else if(SceneLayer->HasField(attribPath, SdfFieldKeys->Default) && Manifest->GetAttributeAtPath(attribPath))
+      RemoveMovedAttribute(attribPath); // A moved attribute which has been set to a default value instead of samples has become uniform
+  }
+
+  // Includes the changes made by the moves themselves
+  DirtyAttributes.clear();
+
+  UpdateClipMetaData();
+  SaveChunks(numThreads, modifiedLayers);
+}
+
+std::string UsdBridgeTimestepLayers::GetLayerPath(const std::string& name) const
+{
+  return LayerPrefix + name + LayerExtension;
+}
+
+SdfLayerRefPtr UsdBridgeTimestepLayers::FindOrCreateLayer(const std::string& relativePath)
+{
+  std::string absoluteFileName = Connect->GetUrl((SessionDirectory + relativePath).c_str());
+
+  UsdBridgeDiagnosticMgrDelegate::SetOutputEnabled(false);
+  SdfLayerRefPtr layer = SdfLayer::FindOrOpen(absoluteFileName);
+  UsdBridgeDiagnosticMgrDelegate::SetOutputEnabled(true);
+
+  if(!layer)
+    layer = SdfLayer::CreateNew(absoluteFileName);
+
+  if(!layer)
+  {
+    UsdBridgeLogMacro(LogObject, UsdBridgeLogLevel::ERR, "Timestep layer " << relativePath << " cannot be created or opened, time samples remain in the scene layer.");
+    LayerError = true;
+  }
+
+  return layer;
+}
+
+int64_t UsdBridgeTimestepLayers::GetChunkIndex(double timeCode) const
+{
+  // Timesteps before 0 are held by the first chunk, which the clip template makes active for all earlier times
+  return std::max(int64_t(0), static_cast<int64_t>(std::floor(timeCode / TimestepsPerLayer)));
+}
+
+UsdBridgeTimestepLayers::Chunk* UsdBridgeTimestepLayers::FindChunk(int64_t chunkIdx)
+{
+  auto chunkIt = Chunks.find(chunkIdx);
+  if(chunkIt != Chunks.end())
+    return &chunkIt->second;
+
+  if(chunkIdx < FirstChunkIdx || chunkIdx > LastChunkIdx)
+    return nullptr;
+
+  // Loaded for reading only, so it is released again with the next flush unless it is modified
+  SdfLayerRefPtr layer = FindOrCreateLayer(GetLayerPath(std::to_string(chunkIdx * TimestepsPerLayer)));
+  if(!layer)
+    return nullptr;
+
+  Chunk& chunk = Chunks[chunkIdx];
+  chunk.Layer = layer;
+  return &chunk;
+}
+
+UsdBridgeTimestepLayers::Chunk* UsdBridgeTimestepLayers::FindOrCreateChunk(int64_t chunkIdx)
+{
+  auto chunkIt = Chunks.find(chunkIdx);
+  if(chunkIt != Chunks.end())
+  {
+    chunkIt->second.Modified = true;
+    return &chunkIt->second;
+  }
+
+  // Chunks in between the existing ones and chunkIdx are created as well (empty), so the clip template covers existing layers only
+  bool hasChunks = (LastChunkIdx >= FirstChunkIdx);
+  int64_t firstChunkIdx = hasChunks ? std::min(FirstChunkIdx, chunkIdx) : chunkIdx;
+  int64_t lastChunkIdx = hasChunks ? std::max(LastChunkIdx, chunkIdx) : chunkIdx;
+
+  for(int64_t idx = firstChunkIdx; idx <= lastChunkIdx; ++idx)
+  {
+    bool isNew = !hasChunks || idx < FirstChunkIdx || idx > LastChunkIdx;
+    if(idx != chunkIdx && !isNew)
+      continue;
+
+    SdfLayerRefPtr layer = FindOrCreateLayer(GetLayerPath(std::to_string(idx * TimestepsPerLayer)));
+    if(!layer)
+      return nullptr;
+    if(isNew)
+      layer->Clear(); // Could hold the samples of an earlier session, if written folder is reused
+
+    Chunk& chunk = Chunks[idx];
+    chunk.Layer = layer;
+    chunk.Modified = true;
+  }
+
+  FirstChunkIdx = firstChunkIdx;
+  LastChunkIdx = lastChunkIdx;
+
+  return &Chunks[chunkIdx];
+}
+
+void UsdBridgeTimestepLayers::RemoveMovedPrims()
+{
+  for(const SdfPath& removedPath : RemovedPrims)
+  {
+    // Entries of the attributes of the removed prim and its descendants directly follow the removed path
+    std::vector<int64_t> chunkIdxs;
+    auto attribIt = AttribChunks.lower_bound(removedPath);
+    while(attribIt != AttribChunks.end() && attribIt->first.HasPrefix(removedPath))
+    {
+      for(const auto& attribChunk : attribIt->second)
+        chunkIdxs.push_back(attribChunk.first);
+      attribIt = AttribChunks.erase(attribIt);
+    }
+
+    if(chunkIdxs.empty())
+      continue;
+
+    std::sort(chunkIdxs.begin(), chunkIdxs.end());
+    chunkIdxs.erase(std::unique(chunkIdxs.begin(), chunkIdxs.end()), chunkIdxs.end());
+
+    for(int64_t chunkIdx : chunkIdxs)
+    {
+      Chunk* chunk = FindOrCreateChunk(chunkIdx);
+      if(!chunk)
+        return;
+      RemovePrimSpec(chunk->Layer, removedPath);
+    }
+
+    RemovePrimSpec(Manifest, removedPath);
+    ManifestModified = true;
+  }
+
+  RemovedPrims.clear();
+}
+
+void UsdBridgeTimestepLayers::RemoveMovedAttribute(const SdfPath& attribPath)
+{
+  auto attribIt = AttribChunks.find(attribPath);
+  if(attribIt != AttribChunks.end())
+  {
+    for(const auto& attribChunk : attribIt->second)
+    {
+      Chunk* chunk = FindOrCreateChunk(attribChunk.first);
+      if(!chunk)
+        return;
+      RemovePropertySpec(chunk->Layer, attribPath);
+    }
+    AttribChunks.erase(attribIt);
+  }
+
+  RemovePropertySpec(Manifest, attribPath);
+  ManifestModified = true;
+}
+
+void UsdBridgeTimestepLayers::MoveTimeSamples(const SdfPath& attribPath)
+{
+  SdfAttributeSpecHandle attribSpec = SceneLayer->GetAttributeAtPath(attribPath);
+  SdfValueTypeName typeName = attribSpec->GetTypeName();
+  SdfVariability variability = attribSpec->GetVariability();
+  bool isCustom = attribSpec->IsCustom();
+
+  if(!Manifest->GetAttributeAtPath(attribPath))
+  {
+    SdfJustCreatePrimAttributeInLayer(Manifest, attribPath, typeName, variability, isCustom);
+    ManifestModified = true;
+  }
+
+  AttribChunkMap& attribChunks = AttribChunks[attribPath];
+  std::vector<std::pair<int64_t, bool>> modifiedChunks; // Chunk index, whether the chunk didn't hold the attribute before
+
+  VtValue sampleValue;
+  for(double timeCode : SceneLayer->ListTimeSamplesForPath(attribPath)) // In ascending order
+  {
+    int64_t chunkIdx = GetChunkIndex(timeCode);
+    Chunk* chunk = FindOrCreateChunk(chunkIdx);
+    if(!chunk)
+      return; // Samples that have been copied already are still stronger in the scene layer
+
+    const SdfLayerRefPtr& chunkLayer = chunk->Layer;
+    if(!chunkLayer->HasSpec(attribPath))
+      SdfJustCreatePrimAttributeInLayer(chunkLayer, attribPath, typeName, variability, isCustom);
+    if(SceneLayer->QueryTimeSample(attribPath, timeCode, &sampleValue))
+      chunkLayer->SetTimeSample(attribPath, timeCode, sampleValue);
+
+    bool isStartSample = (timeCode == static_cast<double>(chunkIdx * TimestepsPerLayer));
+    auto inserted = attribChunks.emplace(chunkIdx, !isStartSample);
+    if(isStartSample)
+      inserted.first->second = false; // Replaces a held value
+
+    if(modifiedChunks.empty() || modifiedChunks.back().first != chunkIdx)
+      modifiedChunks.emplace_back(chunkIdx, inserted.second);
+  }
+
+  // A default value in the scene layer would compete with the clips at every time; it was only used for queries at the default time
+  SceneLayer->EraseField(attribPath, SdfFieldKeys->TimeSamples);
+  SceneLayer->EraseField(attribPath, SdfFieldKeys->Default);
+
+  UpdateHeldSamples(attribPath, attribChunks, modifiedChunks);
+}
+
+void UsdBridgeTimestepLayers::UpdateHeldSamples(const SdfPath& attribPath, const AttribChunkMap& attribChunks,
+  const std::vector<std::pair<int64_t, bool>>& modifiedChunks)
+{
+  // The active clip resolves times before its first sample to that sample instead of to the last sample of the preceding chunks,
+  // so each chunk without a sample at its start time gets a copy of the last sample in the preceding chunk holding the attribute.
+  // That copy only changes once the chunk starts holding the attribute, or if the preceding chunk has been modified (or inserted).
+  std::vector<int64_t> heldChunkIdxs;
+  for(const auto& modifiedChunk : modifiedChunks)
+  {
+    auto attribChunkIt = attribChunks.find(modifiedChunk.first);
+    if(modifiedChunk.second && attribChunkIt->second)
+      heldChunkIdxs.push_back(modifiedChunk.first);
+    auto nextChunkIt = std::next(attribChunkIt);
+    if(nextChunkIt != attribChunks.end() && nextChunkIt->second)
+      heldChunkIdxs.push_back(nextChunkIt->first);
+  }
+  heldChunkIdxs.erase(std::unique(heldChunkIdxs.begin(), heldChunkIdxs.end()), heldChunkIdxs.end());
+
+  VtValue heldValue;
+  for(int64_t chunkIdx : heldChunkIdxs)
+  {
+    auto attribChunkIt = attribChunks.find(chunkIdx);
+    if(attribChunkIt == attribChunks.begin())
+      continue; // No samples before the chunk
+
+    double startTime = static_cast<double>(chunkIdx * TimestepsPerLayer);
+    double lowerTime = 0.0, upperTime = 0.0;
+
+    Chunk* prevChunk = FindChunk(std::prev(attribChunkIt)->first);
+    if(!prevChunk || !prevChunk->Layer->GetBracketingTimeSamplesForPath(attribPath, startTime, &lowerTime, &upperTime)
+      || !prevChunk->Layer->QueryTimeSample(attribPath, lowerTime, &heldValue))
+      continue;
+
+    Chunk* chunk = FindOrCreateChunk(chunkIdx);
+    if(!chunk)
+      return;
+    chunk->Layer->SetTimeSample(attribPath, startTime, heldValue);
+  }
+}
+
+void UsdBridgeTimestepLayers::UpdateClipMetaData()
+{
+  if(LastChunkIdx < FirstChunkIdx)
+    return;
+
+  double startTime = static_cast<double>(FirstChunkIdx * TimestepsPerLayer);
+  double endTime = static_cast<double>(LastChunkIdx * TimestepsPerLayer);
+
+  for(const SdfPath& anchorPath : AnchorPaths)
+  {
+    UsdPrim anchorPrim = SceneStage->GetPrimAtPath(anchorPath);
+    if(!anchorPrim)
+      continue;
+
+    UsdClipsAPI clipsApi(anchorPrim);
+    if(!ClipMetaDataValid)
+    {
+      clipsApi.SetClipTemplateAssetPath(GetLayerPath("#"), clipSetName);
+      clipsApi.SetClipTemplateStride(static_cast<double>(TimestepsPerLayer), clipSetName);
+      clipsApi.SetClipPrimPath(anchorPath.GetString(), clipSetName);
+      clipsApi.SetClipManifestAssetPath(SdfAssetPath(GetLayerPath(manifestName)), clipSetName);
+      // Attributes without samples in a chunk take their value from the surrounding chunks, like they would from the surrounding samples
+      clipsApi.SetInterpolateMissingClipValues(true, clipSetName);
+    }
+
+    // Changing the clip range recomposes the prims below the anchor, so it is only authored once a chunk is added
+    double authoredTime = 0.0;
+    if(!clipsApi.GetClipTemplateStartTime(&authoredTime, clipSetName) || authoredTime != startTime)
+      clipsApi.SetClipTemplateStartTime(startTime, clipSetName);
+    if(!clipsApi.GetClipTemplateEndTime(&authoredTime, clipSetName) || authoredTime != endTime)
+      clipsApi.SetClipTemplateEndTime(endTime, clipSetName);
+  }
+
+  ClipMetaDataValid = true;
+}
+
+void UsdBridgeTimestepLayers::SaveChunks(unsigned int numThreads, std::vector<SdfLayerRefPtr>* modifiedLayers)
+{
+  std::vector<SdfLayerRefPtr> layers;
+  if(ManifestModified)
+    layers.push_back(Manifest);
+  ManifestModified = false;
+
+  for(auto chunkIt = Chunks.begin(); chunkIt != Chunks.end();)
+  {
+    Chunk& chunk = chunkIt->second;
+    if(chunk.Modified)
+    {
+      layers.push_back(chunk.Layer);
+      chunk.Modified = false;
+      ++chunkIt;
+    }
+    else
+      chunkIt = Chunks.erase(chunkIt); // Chunks which haven't received samples since the last flush are most likely finished
+  }
+
+  if(modifiedLayers)
+  {
+    modifiedLayers->insert(modifiedLayers->end(), layers.begin(), layers.end());
+    return;
+  }
+
+  // The layers are independent, so they can be saved in parallel
+  ubutils::ParallelFor(layers.size(), numThreads, [&layers](size_t layerIdx)
+  {
+    layers[layerIdx]->Save();
+  });
+}
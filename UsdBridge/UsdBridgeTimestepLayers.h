@@ -0,0 +1,98 @@
+// Copyright 2020 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UsdBridgeTimestepLayers_h
+#define UsdBridgeTimestepLayers_h
+
+#include "usd.h"
+PXR_NAMESPACE_USING_DIRECTIVE
+
+#include "UsdBridgeData.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+class UsdBridgeConnection;
+
+// Moves the time samples authored in the scene layer into layers that each hold a fixed range of timesteps (chunks), so saving the scene
+// only writes the scene layer without its sample history, plus the chunks that received new samples.
+// USD does not merge time samples over sublayers, so the chunks are composed as template value clips anchored on the root prims of the scene,
+// with a manifest listing the moved attributes and interpolation of missing clip values, which resolves to the same values as the moved samples.
+// A clip holds its first sample for the times before it, so every chunk also gets the held value of the preceding samples at its start time.
+class UsdBridgeTimestepLayers : public TfWeakBase
+{
+public:
+  // Moves samples of the prims below anchorPaths in the root layer of sceneStage into chunks of timestepsPerLayer timesteps (0 disables),
+  // written as files starting with layerPrefix, relative to the session directory. Chunks of a reopened session are continued.
+  void Initialize(const UsdStageRefPtr& sceneStage, const std::vector<SdfPath>& anchorPaths, const UsdBridgeConnection* connect,
+    const UsdBridgeLogObject& logObj, const std::string& sessionDirectory, const std::string& layerPrefix, uint32_t timestepsPerLayer, bool binary);
+  void Reset();
+
+  bool IsEnabled() const { return TimestepsPerLayer != 0 && !LayerError; }
+
+  // Has to be called for every prim removed from the scene stage, so its moved samples are removed with the next Flush() as well
+  void PrimRemoved(const SdfPath& primPath);
+
+  // Moves the time samples changed in the scene layer since the last flush into their chunks and saves the modified chunks in parallel over numThreads
+  // (as passed to ubutils::ParallelFor); should directly precede saving the scene layer.
+  // Chunks that have not been modified are released from memory. If modifiedLayers is given, the modified layers are appended to it instead of saved.
+  void Flush(unsigned int numThreads, std::vector<SdfLayerRefPtr>* modifiedLayers = nullptr);
+
+protected:
+  struct Chunk
+  {
+    SdfLayerRefPtr Layer;
+    bool Modified = false;
+  };
+
+  // Chunk indices holding samples of a moved attribute, with whether the sample at the chunk's start time is only a held copy of an earlier sample
+  using AttribChunkMap = std::map<int64_t, bool>;
+
+  void LayersChanged(const SdfNotice::LayersDidChangeSentPerLayer& notice);
+  bool IsMovableAttribute(const SdfPath& path) const;
+
+  std::string GetLayerPath(const std::string& name) const;
+  SdfLayerRefPtr FindOrCreateLayer(const std::string& relativePath);
+  int64_t GetChunkIndex(double timeCode) const;
+  Chunk* FindChunk(int64_t chunkIdx);
+  Chunk* FindOrCreateChunk(int64_t chunkIdx);
+
+  void RemoveMovedPrims();
+  void RemoveMovedAttribute(const SdfPath& attribPath);
+  void MoveTimeSamples(const SdfPath& attribPath);
+  void UpdateHeldSamples(const SdfPath& attribPath, const AttribChunkMap& attribChunks, const std::vector<std::pair<int64_t, bool>>& modifiedChunks);
+  void UpdateClipMetaData();
+  void SaveChunks(unsigned int numThreads, std::vector<SdfLayerRefPtr>* modifiedLayers);
+
+  uint32_t TimestepsPerLayer = 0;
+  bool LayerError = false; // Set once a layer cannot be created or opened, which stops any further moves
+  UsdStagePtr SceneStage;
+  SdfLayerHandle SceneLayer;
+  std::vector<SdfPath> AnchorPaths;
+  const UsdBridgeConnection* Connect = nullptr;
+  UsdBridgeLogObject LogObject = {};
+  std::string SessionDirectory;
+  std::string LayerPrefix; // Relative to the session directory
+  std::string LayerExtension;
+
+  SdfLayerRefPtr Manifest;
+  bool ManifestModified = false;
+
+  std::map<int64_t, Chunk> Chunks; // Chunks held in memory, by index
+  int64_t FirstChunkIdx = 0;
+  int64_t LastChunkIdx = -1; // Every chunk in between first and last exists on disk, as required by the clip template
+  bool ClipMetaDataValid = false;
+
+  TfNotice::Key LayersChangedKey;
+  std::unordered_set<SdfPath, SdfPath::Hash> DirtyAttributes; // Attributes of which samples or default values have changed in the scene layer since the last flush
+  bool FullScanPending = false; // Samples of a reopened or replaced scene layer are only found by traversing it
+
+  std::map<SdfPath, AttribChunkMap> AttribChunks; // Chunks of each moved attribute (attributes of a prim and its descendants directly follow the prim path)
+  std::vector<SdfPath> RemovedPrims;
+};
+
+#endif
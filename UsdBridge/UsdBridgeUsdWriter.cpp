@@ -31,6 +31,7 @@ namespace constring
   const char* const primStageFolder = "primstages/";
   const char* const imgFolder = "images/";
   const char* const volFolder = "volumes/";
+  const char* const timestepFolder = "timesteps/";
 
   const char* const texCoordReaderPrimPf = "texcoordreader";
   const char* const psShaderPrimPf = "psshader";
@@ -47,10 +48,16 @@ namespace constring
   const char* const mdlGraphWPrimPf = "_w";
   const char* const openVDBPrimPf = "ovdbfield";
   const char* const protoShapePf = "proto_";
+  const char* const meshPartPf = "part_";
+  const char* const tilePf = "tile_";
+  const char* const lodPf = "lod_";
+  const char* const lodVariantSetName = "lod";
 
   const char* const imageExtension = ".png";
   const char* const vdbExtension = ".vdb";
 
+  const char* const timestepLayerPf = "Timesteps."; // Followed by the first timestep, as required by the clip template
+
   const char* const fullSceneNameBin = "FullScene.usd";
   const char* const fullSceneNameAscii = "FullScene.usda";
 
@@ -129,6 +136,8 @@ bool UsdBridgeUsdWriter::CreateDirectories()
 #ifdef TIME_CLIP_STAGES
   valid = valid && Connect->CreateFolder((SessionDirectory + constring::clipFolder).c_str(), true, folderMayExist);
 #endif
+  if(Settings.TimestepsPerLayer)
+    valid = valid && Connect->CreateFolder((SessionDirectory + constring::timestepFolder).c_str(), true, folderMayExist);
 #ifdef CUSTOM_PBR_MDL
   if(Settings.EnableMdlShader)
   {
@@ -222,6 +231,13 @@ bool UsdBridgeUsdWriter::InitializeSession()
 
 void UsdBridgeUsdWriter::ResetSession()
 {
+  this->LodGenerator.Stop();
+  this->DirtyStages.clear();
+  this->PendingFileRemovals.clear();
+  this->TimestepLayers.Reset();
+#ifdef VALUE_CLIP_RETIMING
+  this->ClipMetaDataCaches.clear();
+#endif
   this->SessionNumber = -1;
   this->SceneStage = nullptr;
 }
@@ -286,6 +302,16 @@ bool UsdBridgeUsdWriter::OpenSceneStage()
     EndTime = this->SceneStage->GetEndTimeCode();
   }
 
+  uint32_t timestepsPerLayer = Settings.TimestepsPerLayer;
+#ifdef REPLACE_SCENE_BY_EXTERNAL_STAGE
+  if (this->ExternalSceneStage)
+    timestepsPerLayer = 0; // The clip asset paths would not be relative to the external stage's layer
+#endif
+  // Anchored on the root prims, so the clips cover the class prims with the object data as well as the scene graph
+  std::vector<SdfPath> anchorPaths = { SdfPath(this->RootClassName), SdfPath(this->RootName) };
+  this->TimestepLayers.Initialize(this->SceneStage, anchorPaths, this->Connect.get(), this->LogObject,
+    this->SessionDirectory, std::string(constring::timestepFolder) + constring::timestepLayerPf, timestepsPerLayer, binary);
+
   if(this->EnableSaving)
     this->SceneStage->Save();
 
@@ -297,12 +323,90 @@ UsdStageRefPtr UsdBridgeUsdWriter::GetSceneStage() const
   return this->SceneStage;
 }
 
+void UsdBridgeUsdWriter::MarkStageDirty(const UsdStageRefPtr& stage)
+{
+  if(this->EnableSaving && stage && stage != this->SceneStage)
+    DirtyStages.emplace(get_pointer(stage), stage);
+}
+
+void UsdBridgeUsdWriter::SaveDirtyStages()
+{
+  if(DirtyStages.empty())
+    return;
+
+  std::vector<UsdStageRefPtr> stages;
+  stages.reserve(DirtyStages.size());
+  for(auto& dirtyStage : DirtyStages)
+    stages.emplace_back(std::move(dirtyStage.second));
+  DirtyStages.clear();
+
+  // The stages don't share any layers, so they can be saved independently
+  ubutils::ParallelFor(stages.size(), NumThreads, [&stages](size_t stageIdx)
+  {
+    stages[stageIdx]->Save();
+  });
+}
+
+void UsdBridgeUsdWriter::SaveTimestepLayers()
+{
+  TimestepLayers.Flush(NumThreads);
+}
+
+void UsdBridgeUsdWriter::CollectDirtyLayers(std::vector<SdfLayerRefPtr>& dirtyLayers)
+{
+  // The prim, clip and manifest stages don't have any other contributing layers than their layer stack
+  for(auto& dirtyStage : DirtyStages)
+  {
+    for(const SdfLayerHandle& layer : dirtyStage.second->GetLayerStack(false))
+    {
+      if(layer->IsDirty() && !layer->IsAnonymous())
+        dirtyLayers.emplace_back(layer);
+    }
+  }
+  DirtyStages.clear();
+
+  TimestepLayers.Flush(NumThreads, &dirtyLayers);
+}
+
+void UsdBridgeUsdWriter::RemoveFileAfterSave(const std::string& relativeFileName)
+{
+  PendingFileRemovals[relativeFileName] = 0;
+}
+
+bool UsdBridgeUsdWriter::CancelFileRemoval(const std::string& relativeFileName)
+{
+  return PendingFileRemovals.erase(relativeFileName) != 0;
+}
+
+void UsdBridgeUsdWriter::AssignFileRemovalsToSave(uint64_t saveId, uint64_t prevSaveId)
+{
+  for(auto& fileRemoval : PendingFileRemovals)
+  {
+    if(fileRemoval.second == prevSaveId)
+      fileRemoval.second = saveId;
+  }
+}
+
+void UsdBridgeUsdWriter::RemoveSavedFiles(const std::function<bool (uint64_t)>& isSaveFinished)
+{
+  for(auto it = PendingFileRemovals.begin(); it != PendingFileRemovals.end();)
+  {
+    if(isSaveFinished(it->second))
+    {
+      Connect->RemoveFile((SessionDirectory + it->first).c_str(), true);
+      it = PendingFileRemovals.erase(it);
+    }
+    else
+      ++it;
+  }
+}
+
 UsdStageRefPtr UsdBridgeUsdWriter::GetTimeVarStage(UsdBridgePrimCache* cache
 #ifdef TIME_CLIP_STAGES
   , bool useClipStage, const char* clipPf, double timeStep
   , std::function<void (UsdStageRefPtr)> initFunc
 #endif
-  ) const
+  )
 {
 #ifdef VALUE_CLIP_RETIMING
 #ifdef TIME_CLIP_STAGES
@@ -335,12 +439,19 @@ void UsdBridgeUsdWriter::CreateManifestStage(const char* name, const char* primP
 
   std::string absoluteFileName = Connect->GetUrl((this->SessionDirectory + cacheEntry->ManifestStage.first).c_str());
 
+  // The file of a removed prim with the same name may still be waiting for deletion, its content is discarded
+  bool removalCancelled = CancelFileRemoval(cacheEntry->ManifestStage.first);
+
   UsdBridgeDiagnosticMgrDelegate::SetOutputEnabled(false);
   cacheEntry->ManifestStage.second = UsdStage::CreateNew(absoluteFileName);
   UsdBridgeDiagnosticMgrDelegate::SetOutputEnabled(true);
 
   if (!cacheEntry->ManifestStage.second)
+  {
     cacheEntry->ManifestStage.second = UsdStage::Open(absoluteFileName);
+    if (removalCancelled)
+      cacheEntry->ManifestStage.second->GetRootLayer()->Clear();
+  }
 
   assert(cacheEntry->ManifestStage.second);
 
@@ -352,32 +463,34 @@ void UsdBridgeUsdWriter::RemoveManifestAndClipStages(const UsdBridgePrimCache* c
   // May be superfluous
   if(cacheEntry->ManifestStage.second)
   {
+    DirtyStages.erase(get_pointer(cacheEntry->ManifestStage.second));
     cacheEntry->ManifestStage.second->RemovePrim(SdfPath(RootClassName));
 
-    // Remove ManifestStage file itself
+    // Remove ManifestStage file itself, once the scene without the prim has been saved
     assert(!cacheEntry->ManifestStage.first.empty());
-    Connect->RemoveFile((SessionDirectory + cacheEntry->ManifestStage.first).c_str(), true);
+    RemoveFileAfterSave(cacheEntry->ManifestStage.first);
   }
 
-  // remove all clipstage files
+  // remove all clipstage files, which the saved scene still refers to until then
   for (auto& x : cacheEntry->ClipStages)
   {
-    Connect->RemoveFile((SessionDirectory + x.second.first).c_str(), true);
+    DirtyStages.erase(get_pointer(x.second.second));
+    RemoveFileAfterSave(x.second.first);
   }
 }
 
-const UsdStagePair& UsdBridgeUsdWriter::FindOrCreatePrimStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix) const
+UsdStagePair UsdBridgeUsdWriter::FindOrCreatePrimStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix)
 {
   bool exists;
   return FindOrCreatePrimClipStage(cacheEntry, namePostfix, false, UsdBridgePrimCache::PrimStageTimeCode, exists);
 }
 
-const UsdStagePair& UsdBridgeUsdWriter::FindOrCreateClipStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix, double timeStep, bool& exists) const
+UsdStagePair UsdBridgeUsdWriter::FindOrCreateClipStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix, double timeStep, bool& exists)
 {
   return FindOrCreatePrimClipStage(cacheEntry, namePostfix, true, timeStep, exists);
 }
 
-const UsdStagePair& UsdBridgeUsdWriter::FindOrCreatePrimClipStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix, bool isClip, double timeStep, bool& exists) const
+UsdStagePair UsdBridgeUsdWriter::FindOrCreatePrimClipStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix, bool isClip, double timeStep, bool& exists)
 {
   exists = true;
   bool binary = this->Settings.BinaryOutput;
@@ -396,6 +509,9 @@ const UsdStagePair& UsdBridgeUsdWriter::FindOrCreatePrimClipStage(UsdBridgePrimC
     std::string relativeFileName = folder + cacheEntry->Name.GetString() + fullNamePostfix + (binary ? ".usd" : ".usda");
     std::string absoluteFileName = Connect->GetUrl((this->SessionDirectory + relativeFileName).c_str());
 
+    // The file of a removed prim with the same name may still be waiting for deletion, it is reused as if it were new
+    bool removalCancelled = CancelFileRemoval(relativeFileName);
+
     UsdBridgeDiagnosticMgrDelegate::SetOutputEnabled(false);
     UsdStageRefPtr primClipStage = UsdStage::CreateNew(absoluteFileName);
     UsdBridgeDiagnosticMgrDelegate::SetOutputEnabled(true);
@@ -406,15 +522,79 @@ const UsdStagePair& UsdBridgeUsdWriter::FindOrCreatePrimClipStage(UsdBridgePrimC
     if (exists)
     {
       primClipStage = UsdStage::Open(absoluteFileName); //Could happen if written folder is reused 
-      assert(primClipStage->GetPrimAtPath(rootPrimPath));
+      if (removalCancelled)
+      {
+        primClipStage->GetRootLayer()->Clear();
+        exists = false;
+      }
     }
+
+    if (exists)
+      assert(primClipStage->GetPrimAtPath(rootPrimPath));
     else
       primClipStage->DefinePrim(rootPrimPath);
 
     it = cacheEntry->ClipStages.emplace(timeStep, UsdStagePair(std::move(relativeFileName), primClipStage)).first;
   }
+  else if (!it->second.second)
+  {
+    // Reopen a clip stage that has been released after saving
+    std::string absoluteFileName = Connect->GetUrl((this->SessionDirectory + it->second.first).c_str());
+    it->second.second = UsdStage::Open(absoluteFileName);
+    assert(it->second.second);
+  }
+  else
+  {
+#ifdef TIME_CLIP_STAGES
+    if (isClip)
+    {
+      // Mark as most recently used
+      auto& loadedTimeSteps = cacheEntry->LoadedClipTimeSteps;
+      loadedTimeSteps.splice(loadedTimeSteps.end(), loadedTimeSteps, cacheEntry->LoadedClipPositions[timeStep]);
+    }
+#endif
+    return it->second;
+  }
+
+#ifdef TIME_CLIP_STAGES
+  if (isClip)
+  {
+    auto& loadedTimeSteps = cacheEntry->LoadedClipTimeSteps;
+    cacheEntry->LoadedClipPositions[timeStep] = loadedTimeSteps.insert(loadedTimeSteps.end(), timeStep);
+    ReleaseClipStages(cacheEntry);
+  }
+#endif
   return it->second;
 }
+
+#ifdef TIME_CLIP_STAGES
+void UsdBridgeUsdWriter::ReleaseClipStages(UsdBridgePrimCache* cacheEntry) const
+{
+  std::list<double>& loadedTimeSteps = cacheEntry->LoadedClipTimeSteps;
+  if (KeepTimeSteps == 0 || loadedTimeSteps.size() <= KeepTimeSteps)
+    return;
+
+  // Release the least recently used clip stages beyond the limit, except for the one just loaded (at the back) and those with unsaved changes.
+  // Callers only hold copies of the stage pointer, so they are not affected by resetting the pointer of the entries.
+  auto lastIt = std::prev(loadedTimeSteps.end());
+  for (auto timeStepIt = loadedTimeSteps.begin(); timeStepIt != lastIt && loadedTimeSteps.size() > KeepTimeSteps;)
+  {
+    double timeStep = *timeStepIt;
+    auto it = cacheEntry->ClipStages.find(timeStep);
+    if (it != cacheEntry->ClipStages.end() && it->second.second
+      && DirtyStages.count(get_pointer(it->second.second))) // Not the layer's dirty state, which a background save doesn't reset
+    {
+      ++timeStepIt;
+      continue;
+    }
+
+    if (it != cacheEntry->ClipStages.end())
+      it->second.second = nullptr;
+    cacheEntry->LoadedClipPositions.erase(timeStep);
+    timeStepIt = loadedTimeSteps.erase(timeStepIt);
+  }
+}
+#endif
 #endif
 
 void UsdBridgeUsdWriter::AddRootPrim(UsdBridgePrimCache* primCache, const char* primPathCp, const char* layerId)
@@ -443,7 +623,7 @@ void UsdBridgeUsdWriter::RemoveRootPrim(UsdBridgePrimCache* primCache, const cha
   SdfPath primPath(this->RootName + "/" + primPathCp);
   primPath = primPath.AppendPath(primCache->Name);
 
-  this->SceneStage->RemovePrim(primPath);
+  RemovePrim(this->SceneStage, primPath);
 }
 
 const std::string& UsdBridgeUsdWriter::CreatePrimName(const char * name, const char * category)
@@ -488,14 +668,25 @@ bool UsdBridgeUsdWriter::CreatePrim(const SdfPath& path)
 
 void UsdBridgeUsdWriter::DeletePrim(const UsdBridgePrimCache* cacheEntry)
 {
+  LodGenerator.Cancel(cacheEntry);
+
   if(SceneStage->GetPrimAtPath(cacheEntry->PrimPath))
-    SceneStage->RemovePrim(cacheEntry->PrimPath);
+    RemovePrim(SceneStage, cacheEntry->PrimPath);
 
 #ifdef VALUE_CLIP_RETIMING
+  ClipMetaDataCaches.erase(const_cast<UsdBridgePrimCache*>(cacheEntry));
   RemoveManifestAndClipStages(cacheEntry);
 #endif
 }
 
+void UsdBridgeUsdWriter::RemovePrim(const UsdStageRefPtr& stage, const SdfPath& primPath)
+{
+  stage->RemovePrim(primPath);
+
+  if(stage == this->SceneStage)
+    TimestepLayers.PrimRemoved(primPath);
+}
+
 #ifdef TIME_BASED_CACHING
 void UsdBridgeUsdWriter::InitializePrimVisibility(UsdStageRefPtr stage, const SdfPath& primPath, const UsdTimeCode& timeCode,
   UsdBridgePrimCache* parentCache, UsdBridgePrimCache* childCache)
@@ -510,13 +701,28 @@ void UsdBridgeUsdWriter::InitializePrimVisibility(UsdStageRefPtr stage, const Sd
     
     double startTime = stage->GetStartTimeCode();
     double endTime = stage->GetEndTimeCode();
-    if (startTime < timeCode)
-      visAttrib.Set(VtValue(UsdGeomTokens->invisible), startTime);//imageable.MakeInvisible(startTime);
-    if (endTime > timeCode)
-      visAttrib.Set(VtValue(UsdGeomTokens->invisible), endTime);//imageable.MakeInvisible(endTime);
-    visAttrib.Set(VtValue(UsdGeomTokens->inherited), timeCode);//imageable.MakeVisible(timeCode);
 
-    parentCache->SetChildVisibleAtTime(childCache, timeCode.GetValue());
+    UsdBridgePrimCache::ChildVisibility* visibility = parentCache->GetChildVisibility(childCache);
+    if(visibility)
+    {
+      // The referencing prim is new, so any states of a previous one are discarded
+      visibility->States.clear();
+      visibility->NumVisible = 0;
+
+      if (startTime < timeCode)
+        SetVisibilityAtTime(visAttrib, *visibility, startTime, false);
+      SetVisibilityAtTime(visAttrib, *visibility, timeCode.GetValue(), true);
+      if (endTime > timeCode)
+        SetVisibilityAtTime(visAttrib, *visibility, endTime, false);
+    }
+    else
+    {
+      if (startTime < timeCode)
+        visAttrib.Set(VtValue(UsdGeomTokens->invisible), startTime);//imageable.MakeInvisible(startTime);
+      if (endTime > timeCode)
+        visAttrib.Set(VtValue(UsdGeomTokens->invisible), endTime);//imageable.MakeInvisible(endTime);
+      visAttrib.Set(VtValue(UsdGeomTokens->inherited), timeCode);//imageable.MakeVisible(timeCode);
+    }
   }
 }
 
@@ -529,8 +735,68 @@ void UsdBridgeUsdWriter::SetPrimVisible(UsdStageRefPtr stage, const SdfPath& pri
     UsdAttribute visAttrib = imageable.GetVisibilityAttr();
     assert(visAttrib);
 
-    visAttrib.Set(VtValue(UsdGeomTokens->inherited), timeCode);//imageable.MakeVisible(timeCode);
-    parentCache->SetChildVisibleAtTime(childCache, timeCode.GetValue());
+    UsdBridgePrimCache::ChildVisibility* visibility = parentCache->GetChildVisibility(childCache);
+    if(visibility)
+      SetVisibilityAtTime(visAttrib, *visibility, timeCode.GetValue(), true);
+    else
+      visAttrib.Set(VtValue(UsdGeomTokens->inherited), timeCode);//imageable.MakeVisible(timeCode);
+  }
+}
+
+void UsdBridgeUsdWriter::SetVisibilityAtTime(UsdAttribute& visAttrib, UsdBridgePrimCache::ChildVisibility& visibility, double timeCode, bool visible)
+{
+  // Samples moved into the timestep layers can't be cleared through the scene stage, so then every timestep keeps its own sample instead
+  bool mergeRuns = !TimestepLayers.IsEnabled();
+
+  auto& states = visibility.States;
+  auto insertResult = states.emplace(timeCode, visible);
+  auto stateIt = insertResult.first;
+  bool hasPrev = (stateIt != states.begin());
+  bool prevVisible = hasPrev && std::prev(stateIt)->second;
+
+  if(insertResult.second)
+  {
+    if(visible)
+      ++visibility.NumVisible;
+    // The state held from the previous timestep doesn't change
+    if(mergeRuns && hasPrev && prevVisible == visible)
+      return;
+  }
+  else
+  {
+    if(stateIt->second == visible)
+      return;
+    stateIt->second = visible;
+    if(visible)
+      ++visibility.NumVisible;
+    else
+      --visibility.NumVisible;
+  }
+
+  auto setSample = [&visAttrib](double sampleTime, bool sampleVisible)
+  {
+    visAttrib.Set(VtValue(sampleVisible ? UsdGeomTokens->inherited : UsdGeomTokens->invisible), sampleTime);
+  };
+
+  if(!mergeRuns)
+  {
+    setSample(timeCode, visible);
+    return;
+  }
+
+  // Only the first timestep of a run holds a sample; the change may start, end or merge runs at timeCode and the next known timestep
+  if(!hasPrev || prevVisible != visible)
+    setSample(timeCode, visible);
+  else
+    visAttrib.ClearAtTime(timeCode);
+
+  auto nextIt = std::next(stateIt);
+  if(nextIt != states.end())
+  {
+    if(nextIt->second != visible)
+      setSample(nextIt->first, nextIt->second);
+    else
+      visAttrib.ClearAtTime(nextIt->first);
   }
 }
 
@@ -545,9 +811,16 @@ void UsdBridgeUsdWriter::PrimRemoveIfInvisibleAnytime(UsdStageRefPtr stage, cons
   {
     if(primCache)
     {
-      // Remove prim only if there are no more visible children AND the timecode has actually been removed
-      // (so if the timecode wasn't found in the cache, do not remove the prim)
-      removePrim = parentCache->SetChildInvisibleAtTime(primCache, timeCode.GetValue());
+      // Remove prim only if timeCode is the last visible timestep
+      // (so if the timecode wasn't visible according to the cache, do not remove the prim)
+      UsdBridgePrimCache::ChildVisibility* visibility = parentCache->GetChildVisibility(primCache);
+      if(visibility)
+      {
+        auto stateIt = visibility->States.find(timeCode.GetValue());
+        removePrim = (stateIt != visibility->States.end()) && stateIt->second && (visibility->NumVisible == 1);
+      }
+      else
+        removePrim = false;
 
       // If prim is still visible at other times, make sure to explicitly set this timeCode as invisible
       if(!removePrim)
@@ -557,7 +830,12 @@ void UsdBridgeUsdWriter::PrimRemoveIfInvisibleAnytime(UsdStageRefPtr stage, cons
         {
           UsdAttribute visAttrib = imageable.GetVisibilityAttr();
           if (visAttrib)
-            visAttrib.Set(UsdGeomTokens->invisible, timeCode);
+          {
+            if(visibility)
+              SetVisibilityAtTime(visAttrib, *visibility, timeCode.GetValue(), false);
+            else
+              visAttrib.Set(UsdGeomTokens->invisible, timeCode);
+          }
         }
       }
     }
@@ -572,7 +850,7 @@ void UsdBridgeUsdWriter::PrimRemoveIfInvisibleAnytime(UsdStageRefPtr stage, cons
       atRemoveRef(parentCache, primCache);
     
     // Remove the prim
-    stage->RemovePrim(primPath);
+    RemoveRefPrim(stage, parentCache, primPath);
   }
 }
 
@@ -597,137 +875,98 @@ void UsdBridgeUsdWriter::ChildrenRemoveIfInvisibleAnytime(UsdStageRefPtr stage,
 
 
 #ifdef VALUE_CLIP_RETIMING
-void UsdBridgeUsdWriter::InitializeClipMetaData(const UsdPrim& clipPrim, UsdBridgePrimCache* childCache, double parentTimeStep, double childTimeStep, bool clipStages, const char* clipPostfix)
+void UsdBridgeUsdWriter::InitializeClipMetaData(const UsdPrim& clipPrim, UsdBridgePrimCache* parentCache, UsdBridgePrimCache* childCache, double parentTimeStep, double childTimeStep, bool clipStages, const char* clipPostfix)
 {
   UsdClipsAPI clipsApi(clipPrim);
 
   clipsApi.SetClipPrimPath(childCache->PrimPath.GetString());
 
   const std::string& manifestPath = childCache->ManifestStage.first;
-  const std::string* refStagePath;
+  std::string refStagePath;
 #ifdef TIME_CLIP_STAGES
   if (clipStages)
   {
     //set interpolatemissingclipvalues?
 
     bool exists;
-    const UsdStagePair& childStagePair = FindOrCreateClipStage(childCache, clipPostfix, childTimeStep, exists);
+    UsdStagePair childStagePair = FindOrCreateClipStage(childCache, clipPostfix, childTimeStep, exists);
     //assert(exists); // In case prim creation succeeds but an update is not attempted, no clip stage is generated, so exists will be false
     if(!exists)
       UsdBridgeLogMacro(this->LogObject, UsdBridgeLogLevel::WARNING, "Child clip stage not found while setting clip metadata, using generated stage instead. Probably the child data has not been properly updated.");
 
-    refStagePath = &childStagePair.first;
+    refStagePath = std::move(childStagePair.first);
   }
   else
 #endif
   {
-    refStagePath = &childCache->GetPrimStagePair().first;
+    refStagePath = childCache->GetPrimStagePair().first;
   }
 
   clipsApi.SetClipManifestAssetPath(SdfAssetPath(manifestPath));
 
-  VtArray<SdfAssetPath> assetPaths;
-  assetPaths.push_back(SdfAssetPath(*refStagePath));
-  clipsApi.SetClipAssetPaths(assetPaths);
-
-  VtVec2dArray clipActives;
-  clipActives.push_back(GfVec2d(parentTimeStep, 0));
-  clipsApi.SetClipActive(clipActives);
-
-  VtVec2dArray clipTimes;
-  clipTimes.push_back(GfVec2d(parentTimeStep, childTimeStep));
-  clipsApi.SetClipTimes(clipTimes);
+  // Asset paths, actives and times are authored with FlushClipMetaData()
+  UsdBridgePrimCache::RefClipMetaData& clipMetaData = parentCache->RefClipMetaDatas[clipPrim.GetPath()];
+  clipMetaData.Reset(SdfAssetPath(refStagePath), parentTimeStep, childTimeStep);
+  ClipMetaDataCaches.insert(parentCache);
 }
 
-void UsdBridgeUsdWriter::UpdateClipMetaData(const UsdPrim& clipPrim, UsdBridgePrimCache* childCache, double parentTimeStep, double childTimeStep, bool clipStages, const char* clipPostfix)
+void UsdBridgeUsdWriter::UpdateClipMetaData(const UsdPrim& clipPrim, UsdBridgePrimCache* parentCache, UsdBridgePrimCache* childCache, double parentTimeStep, double childTimeStep, bool clipStages, const char* clipPostfix)
 {
   // Add parent-child timestep or update existing relationship
-  UsdClipsAPI clipsApi(clipPrim);
+  auto clipMetaDataIt = parentCache->RefClipMetaDatas.find(clipPrim.GetPath());
+  if(clipMetaDataIt == parentCache->RefClipMetaDatas.end())
+  {
+    // Prim from a reopened scene, start out with its authored metadata
+    clipMetaDataIt = parentCache->RefClipMetaDatas.emplace(clipPrim.GetPath(), UsdBridgePrimCache::RefClipMetaData()).first;
+    clipMetaDataIt->second.Load(UsdClipsAPI(clipPrim));
+  }
+  UsdBridgePrimCache::RefClipMetaData& clipMetaData = clipMetaDataIt->second;
 
 #ifdef TIME_CLIP_STAGES
   if (clipStages)
   {
     bool exists;
-    const UsdStagePair& childStagePair = FindOrCreateClipStage(childCache, clipPostfix, childTimeStep, exists);
+    UsdStagePair childStagePair = FindOrCreateClipStage(childCache, clipPostfix, childTimeStep, exists);
     // At this point, exists should be true, but if clip stage creation failed earlier due to user error, 
     // exists will be false and we'll just link to the empty new stage created by FindOrCreatePrimClipStage()
 
-    const std::string& refStagePath = childStagePair.first;
+    // Either points the active entry of parentTimeStep to the asset, or replaces its previous asset if that isn't active at any other timestep
+    // (gives the opportunity to garbage collect unused asset references)
+    clipMetaData.SetActiveAsset(parentTimeStep, SdfAssetPath(childStagePair.first));
+  }
+#endif
 
-    VtVec2dArray clipActives;
-    clipsApi.GetClipActive(&clipActives);
-    VtArray<SdfAssetPath> assetPaths;
-    clipsApi.GetClipAssetPaths(&assetPaths);
+  // Find the parentTimeStep, and change its child (or add the pair if nonexistent)
+  clipMetaData.SetClipTime(parentTimeStep, childTimeStep);
 
-    // Find the asset path
-    SdfAssetPath refStageSdf(refStagePath);
-    auto assetIt = std::find_if(assetPaths.begin(), assetPaths.end(), [&refStageSdf](const SdfAssetPath& entry) -> bool { return refStageSdf.GetAssetPath() == entry.GetAssetPath(); });
-    int assetIndex = int(assetIt - assetPaths.begin());
-    bool newAsset = (assetIndex == assetPaths.size()); // Gives the opportunity to garbage collect unused asset references
+  if(clipMetaData.ActivesModified || clipMetaData.TimesModified)
+    ClipMetaDataCaches.insert(parentCache);
+}
 
+void UsdBridgeUsdWriter::FlushClipMetaData()
+{
+  for(UsdBridgePrimCache* parentCache : ClipMetaDataCaches)
+  {
+    for(auto it = parentCache->RefClipMetaDatas.begin(); it != parentCache->RefClipMetaDatas.end();)
     {
-      // Find the parentTimeStep
-      int timeFindIdx = 0;
-      for (; timeFindIdx < clipActives.size() && clipActives[timeFindIdx][0] != parentTimeStep; ++timeFindIdx)
-      {}
-
-      bool replaceAsset = false;
-
-      // If timestep not found, just add (time, asset ref idx) to actives
-      if (timeFindIdx == clipActives.size())
-        clipActives.push_back(GfVec2d(parentTimeStep, assetIndex));
-      else
+      UsdPrim clipPrim = SceneStage->GetPrimAtPath(it->first);
+      if(!clipPrim)
       {
-        // Find out whether to update existing active entry with new asset ref idx, or let the entry unchanged and replace the asset itself
-        double prevAssetIndex = clipActives[timeFindIdx][1];
-       
-        if (newAsset)
-        {
-          //Find prev asset index
-          int assetIdxFindIdx = 0;
-          for (; assetIdxFindIdx < clipActives.size() && 
-            (assetIdxFindIdx == timeFindIdx || clipActives[assetIdxFindIdx][1] != prevAssetIndex); 
-            ++assetIdxFindIdx)
-          {}
-
-          // replacement occurs when prevAssetIndex hasn't been found in other entries
-          replaceAsset = (assetIdxFindIdx == clipActives.size());
-        }
-
-        if(replaceAsset)
-          assetPaths[int(prevAssetIndex)] = refStageSdf;
-        else
-          clipActives[timeFindIdx][1] = assetIndex;
+        // The referencing prim has been removed, a new one starts out with fresh metadata
+        it = parentCache->RefClipMetaDatas.erase(it);
+        continue;
       }
 
-      // If new asset and not put in place of an old asset, add to assetPaths
-      if (newAsset && !replaceAsset)
-        assetPaths.push_back(refStageSdf);
-
-      // Send the result through to usd
-      clipsApi.SetClipAssetPaths(assetPaths);
-      clipsApi.SetClipActive(clipActives);
-    }
-  }
-#endif
-
-  // Find the parentTimeStep, and change its child (or add the pair if nonexistent)
-  VtVec2dArray clipTimes;
-  clipsApi.GetClipTimes(&clipTimes);
-  {
-    int findIdx = 0;
-    for (; findIdx < clipTimes.size(); ++findIdx)
-    {
-      if (clipTimes[findIdx][0] == parentTimeStep)
+      UsdBridgePrimCache::RefClipMetaData& clipMetaData = it->second;
+      if(clipMetaData.ActivesModified || clipMetaData.TimesModified)
       {
-        clipTimes[findIdx][1] = childTimeStep;
-        break;
+        UsdClipsAPI clipsApi(clipPrim);
+        clipMetaData.Author(clipsApi);
       }
+      ++it;
     }
-    if (findIdx == clipTimes.size())
-      clipTimes.push_back(GfVec2d(parentTimeStep, childTimeStep));
-    clipsApi.SetClipTimes(clipTimes);
   }
+  ClipMetaDataCaches.clear();
 }
 
 #endif
@@ -771,7 +1010,7 @@ SdfPath UsdBridgeUsdWriter::AddRef_Impl(UsdBridgePrimCache* parentCache, UsdBrid
 
 #ifdef VALUE_CLIP_RETIMING
     if (valueClip)
-      InitializeClipMetaData(referencingPrim, childCache, parentTimeStep, childTimeStep, clipStages, clipPostfix);
+      InitializeClipMetaData(referencingPrim, parentCache, childCache, parentTimeStep, childTimeStep, clipStages, clipPostfix);
 #endif
 
     {
@@ -783,6 +1022,10 @@ SdfPath UsdBridgeUsdWriter::AddRef_Impl(UsdBridgePrimCache* parentCache, UsdBrid
 
     refModCallbacks.AtNewRef(parentCache, childCache);
 
+    auto refNamesIt = parentCache->RefNames.find(childBasePath);
+    if(refNamesIt != parentCache->RefNames.end())
+      refNamesIt->second.insert(referencingPrimPath.GetNameToken());
+
 #ifdef TIME_BASED_CACHING
     // If time domain of the stage extends beyond timestep in either direction, set visibility false for extremes.
     if (timeVarying)
@@ -801,7 +1044,7 @@ SdfPath UsdBridgeUsdWriter::AddRef_Impl(UsdBridgePrimCache* parentCache, UsdBrid
     // Cliptimes are added as additional info, not actively removed (visibility values remain leading in defining existing relationships over timesteps)
     // Also, clip stages at childTimeSteps which are not referenced anymore, are not removed; they could still be referenced from other parents!
     if (valueClip)
-      UpdateClipMetaData(referencingPrim, childCache, parentTimeStep, childTimeStep, clipStages, clipPostfix);
+      UpdateClipMetaData(referencingPrim, parentCache, childCache, parentTimeStep, childTimeStep, clipStages, clipPostfix);
 #endif
 #endif
   }
@@ -841,7 +1084,7 @@ void UsdBridgeUsdWriter::RemoveAllRefs(UsdStageRefPtr stage, UsdBridgePrimCache*
       if(childCache)
       {
         atRemoveRef(parentCache, childCache); // Decrease reference count in caches
-        stage->RemovePrim(child.GetPath()); // Remove reference prim
+        RemoveRefPrim(stage, parentCache, child.GetPath()); // Remove reference prim
       }
     }
   }
@@ -857,49 +1100,80 @@ void UsdBridgeUsdWriter::ManageUnusedRefs(UsdStageRefPtr stage, UsdBridgePrimCac
 {
   UsdTimeCode timeCode(timeStep);
 
-  UsdPrim basePrim;
+  SdfPath childBasePath = parentCache->PrimPath;
   if (refPathExt)
-  {
-    SdfPath childBasePath = parentCache->PrimPath.AppendPath(SdfPath(refPathExt));
-    basePrim = stage->GetPrimAtPath(childBasePath);
-  }
-  else
-    basePrim = stage->GetPrimAtPath(parentCache->PrimPath);
+    childBasePath = parentCache->PrimPath.AppendPath(SdfPath(refPathExt));
 
-  if (basePrim)
+  UsdBridgePrimCache::RefNameSet* refNames = GetRefNames(stage, parentCache, childBasePath);
+  if (refNames)
   {
-    // For each old (referencing) child prim, find it among the new ones, otherwise
-    // possibly delete the referencing prim.
-    UsdPrimSiblingRange children = basePrim.GetAllChildren();
-    for (UsdPrim oldChild : children)
+    // Find the old (referencing) child prims that are not among the new ones, and possibly delete them.
+    // Prims referencing the new children are left untouched.
+    TempRefNames.clear();
+    for (const UsdBridgePrimCache* newChild : newChildren)
+      TempRefNames.insert(newChild->PrimPath.GetNameToken());
+
+    TempUnusedRefNames.clear();
+    for (const TfToken& refName : *refNames)
     {
-      bool found = false;
-      for (size_t newChildIdx = 0; newChildIdx < newChildren.size() && !found; ++newChildIdx)
+      if (TempRefNames.find(refName) == TempRefNames.end())
+        TempUnusedRefNames.push_back(refName);
+    }
+
+    for (const TfToken& oldChildName : TempUnusedRefNames)
+    {
+      UsdPrim oldChild = stage->GetPrimAtPath(childBasePath.AppendChild(oldChildName));
+      if (!oldChild)
       {
-        found = (oldChild.GetName() == newChildren[newChildIdx]->PrimPath.GetNameToken());
+        refNames->erase(oldChildName); // Removed along with an ancestor
+        continue;
       }
 
-      UsdBridgePrimCache* oldChildCache = parentCache->GetChildCache(oldChild.GetName());
-
       // Not an assert: allow the case where child prims in a stage aren't cached, ie. when the bridge is destroyed and recreated
-      if (!found)
+      UsdBridgePrimCache* oldChildCache = parentCache->GetChildCache(oldChildName);
+
 #ifdef TIME_BASED_CACHING
-      {
-        // Remove *referencing* prim if no visible timecode exists anymore
-        PrimRemoveIfInvisibleAnytime(stage, oldChild, timeVarying, timeCode, atRemoveRef,
-          parentCache, oldChildCache);
-      }
+      // Remove *referencing* prim if no visible timecode exists anymore
+      PrimRemoveIfInvisibleAnytime(stage, oldChild, timeVarying, timeCode, atRemoveRef,
+        parentCache, oldChildCache);
 #else
-      {// remove the whole referencing prim
-        if(oldChildCache)
-          atRemoveRef(parentCache, oldChildCache);
-        stage->RemovePrim(oldChild.GetPath());
-      }
+      // remove the whole referencing prim
+      if(oldChildCache)
+        atRemoveRef(parentCache, oldChildCache);
+      RemoveRefPrim(stage, parentCache, oldChild.GetPath());
 #endif
     }
   }
 }
 
+UsdBridgePrimCache::RefNameSet* UsdBridgeUsdWriter::GetRefNames(UsdStageRefPtr stage, UsdBridgePrimCache* parentCache, const SdfPath& childBasePath)
+{
+  auto refNamesIt = parentCache->RefNames.find(childBasePath);
+  if (refNamesIt != parentCache->RefNames.end())
+    return &refNamesIt->second;
+
+  UsdPrim basePrim = stage->GetPrimAtPath(childBasePath);
+  if (!basePrim)
+    return nullptr;
+
+  // Start out with the prims in the stage, which includes those of a reopened scene
+  UsdBridgePrimCache::RefNameSet& refNames = parentCache->RefNames[childBasePath];
+  UsdPrimSiblingRange children = basePrim.GetAllChildren();
+  for (UsdPrim child : children)
+    refNames.insert(child.GetName());
+
+  return &refNames;
+}
+
+void UsdBridgeUsdWriter::RemoveRefPrim(UsdStageRefPtr stage, UsdBridgePrimCache* parentCache, const SdfPath& refPrimPath)
+{
+  RemovePrim(stage, refPrimPath);
+
+  auto refNamesIt = parentCache->RefNames.find(refPrimPath.GetParentPath());
+  if (refNamesIt != parentCache->RefNames.end())
+    refNamesIt->second.erase(refPrimPath.GetNameToken());
+}
+
 void UsdBridgeUsdWriter::InitializeUsdTransform(const UsdBridgePrimCache* cacheEntry)
 {
   SdfPath transformPath = cacheEntry->PrimPath;
@@ -958,6 +1232,83 @@ void UsdBridgeUsdWriter::UpdateUsdTransform(const SdfPath& transPrimPath, const
   ClearAndSetUsdAttribute(xformOp.GetAttr(), transMat, timeEval.Eval(), !timeEval.TimeVarying);
 }
 
+void UsdBridgeUsdWriter::UpdateUsdPointInstancers(UsdBridgePrimCache* parentCache, const char* instancerPathExt, const UsdBridgePrimCacheList& groupCaches,
+  const uint64_t* groupOffsets, const uint64_t* instanceIndices, const float* transforms, bool timeVarying, double timeStep,
+  const RefModFuncs& refModCallbacks)
+{
+  TimeEvaluator<bool> timeEval(timeVarying, timeStep);
+
+  SdfPath instancersPath = parentCache->PrimPath.AppendPath(SdfPath(instancerPathExt));
+
+  if (!timeVarying)
+  {
+    // Remove the instancers of groups that are not instanced anymore, along with the reference to the group
+    ManageUnusedRefs(SceneStage, parentCache, groupCaches, instancerPathExt, timeVarying, timeStep, refModCallbacks.AtRemoveRef);
+  }
+  else
+  {
+    // Groups that are not instanced at this timestep keep their instancer, without instances
+    UsdBridgePrimCache::RefNameSet* instancerNames = GetRefNames(SceneStage, parentCache, instancersPath);
+    if (instancerNames)
+    {
+      TempRefNames.clear();
+      for (const UsdBridgePrimCache* groupCache : groupCaches)
+        TempRefNames.insert(groupCache->PrimPath.GetNameToken());
+
+      for (const TfToken& instancerName : *instancerNames)
+      {
+        UsdGeomPointInstancer instancer = UsdGeomPointInstancer::Get(SceneStage, instancersPath.AppendChild(instancerName));
+        if (instancer && TempRefNames.find(instancerName) == TempRefNames.end())
+        {
+          instancer.GetProtoIndicesAttr().Set(VtIntArray(), timeEval.Eval());
+          instancer.GetPositionsAttr().Set(VtVec3fArray(), timeEval.Eval());
+          instancer.GetOrientationsAttr().Set(VtQuathArray(), timeEval.Eval());
+          instancer.GetScalesAttr().Set(VtVec3fArray(), timeEval.Eval());
+        }
+      }
+    }
+  }
+
+  for (size_t groupIdx = 0; groupIdx < groupCaches.size(); ++groupIdx)
+  {
+    UsdBridgePrimCache* groupCache = groupCaches[groupIdx];
+    const TfToken& instancerName = groupCache->PrimPath.GetNameToken();
+    SdfPath instancerPath = instancersPath.AppendChild(instancerName);
+
+    UsdGeomPointInstancer instancer = UsdGeomPointInstancer::Get(SceneStage, instancerPath);
+    if (!instancer)
+    {
+      instancer = UsdGeomPointInstancer::Define(SceneStage, instancerPath);
+      assert(instancer);
+
+      // The prototype references the group from below the instancer, so it is only drawn through the instancer
+      std::string protoPathExt(instancerPathExt);
+      protoPathExt += "/";
+      protoPathExt += instancerName.GetString();
+      SdfPath protoPath = AddRef_NoClip(parentCache, groupCache, protoPathExt.c_str(), false, timeStep, false, refModCallbacks);
+      instancer.CreatePrototypesRel().SetTargets(SdfPathVector(1, protoPath));
+
+      auto refNamesIt = parentCache->RefNames.find(instancersPath);
+      if (refNamesIt != parentCache->RefNames.end())
+        refNamesIt->second.insert(instancerName);
+    }
+
+    uint64_t firstInstance = groupOffsets[groupIdx];
+    uint64_t numInstances = groupOffsets[groupIdx+1] - firstInstance;
+
+    VtIntArray protoIndices(numInstances, 0);
+    VtVec3fArray positions(numInstances);
+    VtQuathArray orientations(numInstances);
+    VtVec3fArray scales(numInstances);
+    ConvertTransformsToInstances(transforms, instanceIndices + firstInstance, numInstances, positions, orientations, scales, NumThreads);
+
+    ClearAndSetUsdAttribute(instancer.CreateProtoIndicesAttr(), protoIndices, timeEval.Eval(), !timeEval.TimeVarying);
+    ClearAndSetUsdAttribute(instancer.CreatePositionsAttr(), positions, timeEval.Eval(), !timeEval.TimeVarying);
+    ClearAndSetUsdAttribute(instancer.CreateOrientationsAttr(), orientations, timeEval.Eval(), !timeEval.TimeVarying);
+    ClearAndSetUsdAttribute(instancer.CreateScalesAttr(), scales, timeEval.Eval(), !timeEval.TimeVarying);
+  }
+}
+
 void UsdBridgeUsdWriter::UpdateUsdCamera(UsdStageRefPtr timeVarStage, const SdfPath& cameraPrimPath, 
   const UsdBridgeCameraData& cameraData, double timeStep, bool timeVarHasChanged)
 {
@@ -1013,6 +1364,31 @@ void UsdBridgeUsdWriter::UpdateBeginEndTime(double timeStep)
   }
 }
 
+void UsdBridgeUsdWriter::SetKeepTimeSteps(uint32_t numTimeSteps)
+{
+  KeepTimeSteps = numTimeSteps;
+}
+
+void UsdBridgeUsdWriter::SetNumThreads(uint32_t numThreads)
+{
+  NumThreads = numThreads;
+}
+
+void UsdBridgeUsdWriter::SetLodSettings(const float* ratios, uint32_t numRatios, uint64_t minPrimitives)
+{
+  // Levels are ordered from high to low detail, ratios outside of (0,1) are ignored
+  LodRatios.resize(0);
+  for(uint32_t ratioIdx = 0; ratioIdx < numRatios; ++ratioIdx)
+  {
+    if(ratios[ratioIdx] > 0.0f && ratios[ratioIdx] < 1.0f)
+      LodRatios.push_back(ratios[ratioIdx]);
+  }
+  std::sort(LodRatios.begin(), LodRatios.end(), std::greater<float>());
+  LodRatios.erase(std::unique(LodRatios.begin(), LodRatios.end()), LodRatios.end());
+
+  LodMinPrimitives = minPrimitives;
+}
+
 TfToken& UsdBridgeUsdWriter::AttributeNameToken(const char* attribName)
 {
   int i = 0;
@@ -9,12 +9,17 @@ PXR_NAMESPACE_USING_DIRECTIVE
 
 #include "UsdBridgeData.h"
 #include "UsdBridgeCaches.h"
+#include "UsdBridgeLodGenerator.h"
+#include "UsdBridgeScratchArena.h"
+#include "UsdBridgeTimestepLayers.h"
 #include "UsdBridgeVolumeWriter.h"
 #include "UsdBridgeConnection.h"
 #include "UsdBridgeTimeEvaluator.h"
 
 #include <memory>
 #include <functional>
+#include <unordered_map>
+#include <unordered_set>
 
 //Includes detailed usd translation interface of Usd Bridge
 class UsdBridgeUsdWriter
@@ -47,19 +52,38 @@ public:
 
   bool OpenSceneStage();
   UsdStageRefPtr GetSceneStage() const;
+  // Prim, clip and manifest stages are saved once per frame instead of after every update; MarkStageDirty() registers a modified stage
+  // and SaveDirtyStages() saves all registered stages in parallel (the scene stage is saved separately)
+  void MarkStageDirty(const UsdStageRefPtr& stage);
+  void SaveDirtyStages();
+  // Moves the time samples of the scene stage into their timestep layers and saves those, if enabled; precedes saving the scene stage
+  void SaveTimestepLayers();
+  // Instead of saving them, appends the layers SaveDirtyStages() and SaveTimestepLayers() would save to dirtyLayers (for a background save)
+  void CollectDirtyLayers(std::vector<SdfLayerRefPtr>& dirtyLayers);
+  // Stage files of removed prims are only deleted once the scene has been saved without references to them.
+  // Removals wait for the next save, or for background save saveId after AssignFileRemovalsToSave(saveId) (or after AssignFileRemovalsToSave(saveId, prevSaveId) for removals that waited for prevSaveId);
+  // RemoveSavedFiles() deletes the files for which isSaveFinished(saveId) holds, saveId being 0 for removals not assigned to a background save.
+  void RemoveFileAfterSave(const std::string& relativeFileName);
+  bool CancelFileRemoval(const std::string& relativeFileName); // Returns whether the file was waiting for removal
+  void AssignFileRemovalsToSave(uint64_t saveId, uint64_t prevSaveId = 0);
+  void RemoveSavedFiles(const std::function<bool (uint64_t)>& isSaveFinished);
   UsdStageRefPtr GetTimeVarStage(UsdBridgePrimCache* cache
 #ifdef TIME_CLIP_STAGES
     , bool useClipStage = false, const char* clipPf = nullptr, double timeStep = 0.0
     , std::function<void (UsdStageRefPtr)> initFunc = [](UsdStageRefPtr){}
 #endif
-    ) const;
+    );
 #ifdef VALUE_CLIP_RETIMING
   void CreateManifestStage(const char* name, const char* primPostfix, UsdBridgePrimCache* cacheEntry);
   void RemoveManifestAndClipStages(const UsdBridgePrimCache* cacheEntry);
 
-  const UsdStagePair& FindOrCreatePrimStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix) const;
-  const UsdStagePair& FindOrCreateClipStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix, double timeStep, bool& exists) const;
-  const UsdStagePair& FindOrCreatePrimClipStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix, bool isClip, double timeStep, bool& exists) const;
+  // Returned by value, as the stage of a clip entry may be released by a later call
+  UsdStagePair FindOrCreatePrimStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix);
+  UsdStagePair FindOrCreateClipStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix, double timeStep, bool& exists);
+  UsdStagePair FindOrCreatePrimClipStage(UsdBridgePrimCache* cacheEntry, const char* namePostfix, bool isClip, double timeStep, bool& exists);
+#ifdef TIME_CLIP_STAGES
+  void ReleaseClipStages(UsdBridgePrimCache* cacheEntry) const;
+#endif
 #endif
   void AddRootPrim(UsdBridgePrimCache* primCache, const char* primPathCp, const char* layerId = nullptr);
   void RemoveRootPrim(UsdBridgePrimCache* primCache, const char* primPathCp);
@@ -71,19 +95,24 @@ public:
 
   bool CreatePrim(const SdfPath& path);
   void DeletePrim(const UsdBridgePrimCache* cacheEntry);
+  void RemovePrim(const UsdStageRefPtr& stage, const SdfPath& primPath); // Removes the prim along with its samples in timestep layers
 #ifdef TIME_BASED_CACHING
   void InitializePrimVisibility(UsdStageRefPtr stage, const SdfPath& primPath, const UsdTimeCode& timeCode,
     UsdBridgePrimCache* parentCache, UsdBridgePrimCache* childCache);
   void SetPrimVisible(UsdStageRefPtr stage, const SdfPath& primPath, const UsdTimeCode& timeCode,
     UsdBridgePrimCache* parentCache, UsdBridgePrimCache* childCache);
+  // Records the state in visibility and authors the samples at the boundaries of the affected runs
+  void SetVisibilityAtTime(UsdAttribute& visAttrib, UsdBridgePrimCache::ChildVisibility& visibility, double timeCode, bool visible);
   void PrimRemoveIfInvisibleAnytime(UsdStageRefPtr stage, const UsdPrim& prim, bool timeVarying, const UsdTimeCode& timeCode, AtRemoveRefFunc atRemoveRef,
     UsdBridgePrimCache* parentCache, UsdBridgePrimCache* primCache);
   void ChildrenRemoveIfInvisibleAnytime(UsdStageRefPtr stage, UsdBridgePrimCache* parentCache, const SdfPath& parentPath, bool timeVarying, const UsdTimeCode& timeCode, AtRemoveRefFunc atRemoveRef, const SdfPath& exceptPath = SdfPath());
 #endif
 
 #ifdef VALUE_CLIP_RETIMING
-  void InitializeClipMetaData(const UsdPrim& clipPrim, UsdBridgePrimCache* childCache, double parentTimeStep, double childTimeStep, bool clipStages, const char* clipPostfix);
-  void UpdateClipMetaData(const UsdPrim& clipPrim, UsdBridgePrimCache* childCache, double parentTimeStep, double childTimeStep, bool clipStages, const char* clipPostfix);
+  // Clip metadata of referencing prims is kept in the cache of the parent and authored by FlushClipMetaData(), at most once per frame
+  void InitializeClipMetaData(const UsdPrim& clipPrim, UsdBridgePrimCache* parentCache, UsdBridgePrimCache* childCache, double parentTimeStep, double childTimeStep, bool clipStages, const char* clipPostfix);
+  void UpdateClipMetaData(const UsdPrim& clipPrim, UsdBridgePrimCache* parentCache, UsdBridgePrimCache* childCache, double parentTimeStep, double childTimeStep, bool clipStages, const char* clipPostfix);
+  void FlushClipMetaData();
 #endif
 
   SdfPath AddRef_NoClip(UsdBridgePrimCache* parentCache, UsdBridgePrimCache* childCache, const char* refPathExt,
@@ -104,6 +133,8 @@ public:
   void RemoveAllRefs(UsdStageRefPtr stage, UsdBridgePrimCache* parentCache, SdfPath childBasePath, bool timeVarying, double timeStep, AtRemoveRefFunc atRemoveRef);
   void ManageUnusedRefs(UsdBridgePrimCache* parentCache, const UsdBridgePrimCacheList& newChildren, const char* refPathExt, bool timeVarying, double timeStep, AtRemoveRefFunc atRemoveRef);
   void ManageUnusedRefs(UsdStageRefPtr stage, UsdBridgePrimCache* parentCache, const UsdBridgePrimCacheList& newChildren, const char* refPathExt, bool timeVarying, double timeStep, AtRemoveRefFunc atRemoveRef);
+  UsdBridgePrimCache::RefNameSet* GetRefNames(UsdStageRefPtr stage, UsdBridgePrimCache* parentCache, const SdfPath& childBasePath); // Returns null if the base prim doesn't exist
+  void RemoveRefPrim(UsdStageRefPtr stage, UsdBridgePrimCache* parentCache, const SdfPath& refPrimPath);
 
   void InitializeUsdTransform(const UsdBridgePrimCache* cacheEntry);
   UsdPrim InitializeUsdGeometry(UsdStageRefPtr geometryStage, const SdfPath& geomPath, const UsdBridgeMeshData& meshData, bool uniformPrim);
@@ -136,9 +167,14 @@ public:
   void UnbindMaterialFromGeom(const SdfPath & refGeomPath);
 
   void UpdateUsdTransform(const SdfPath& transPrimPath, const float* transform, bool timeVarying, double timeStep);
-  void UpdateUsdGeometry(const UsdStagePtr& timeVarStage, const SdfPath& meshPath, const UsdBridgeMeshData& geomData, double timeStep);
-  void UpdateUsdGeometry(const UsdStagePtr& timeVarStage, const SdfPath& instancerPath, const UsdBridgeInstancerData& geomData, double timeStep);
-  void UpdateUsdGeometry(const UsdStagePtr& timeVarStage, const SdfPath& curvePath, const UsdBridgeCurveData& geomData, double timeStep);
+  // Writes one point instancer per group below the instancerPathExt of parentCache, its prototype referencing the group, with the decomposed transforms
+  // of the instances of each group; those of groupCaches[i] are indexed by instanceIndices[groupOffsets[i]] up to instanceIndices[groupOffsets[i+1]].
+  void UpdateUsdPointInstancers(UsdBridgePrimCache* parentCache, const char* instancerPathExt, const UsdBridgePrimCacheList& groupCaches,
+    const uint64_t* groupOffsets, const uint64_t* instanceIndices, const float* transforms, bool timeVarying, double timeStep,
+    const RefModFuncs& refModCallbacks);
+  void UpdateUsdGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& geomData, double timeStep);
+  void UpdateUsdGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& geomData, double timeStep);
+  void UpdateUsdGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeCurveData& geomData, double timeStep);
   void UpdateUsdMaterial(UsdStageRefPtr timeVarStage, const SdfPath& matPrimPath, const UsdBridgeMaterialData& matData, const UsdGeomPrimvarsAPI& boundGeomPrimvars, double timeStep);
   void UpdatePsShader(UsdStageRefPtr timeVarStage, const SdfPath& matPrimPath, const UsdBridgeMaterialData& matData, const UsdGeomPrimvarsAPI& boundGeomPrimvars, double timeStep);
   void UpdateMdlShader(UsdStageRefPtr timeVarStage, const SdfPath& matPrimPath, const UsdBridgeMaterialData& matData, const UsdGeomPrimvarsAPI& boundGeomPrimvars, double timeStep);
@@ -151,6 +187,16 @@ public:
   void UpdateInAttribute(UsdStageRefPtr timeVarStage, const SdfPath& samplerPrimPath, const char* newName, double timeStep, SamplerDMI timeVarying);
   void UpdateBeginEndTime(double timeStep);
 
+  // Ratios in (0,1) of the primitives kept by each generated level of detail, for geometry with at least minPrimitives primitives
+  void SetLodSettings(const float* ratios, uint32_t numRatios, uint64_t minPrimitives);
+  // Number of clip stages per object kept in memory, after which the least recently loaded ones are released once saved (0 keeps all).
+  // Released stages are reopened from disk when accessed again.
+  void SetKeepTimeSteps(uint32_t numTimeSteps);
+  // Threads over which large conversions are distributed, as passed to ubutils::ParallelFor (0 for the hardware concurrency)
+  void SetNumThreads(uint32_t numThreads);
+  // Authors the levels of detail finished in the background, optionally waiting for the pending ones first. Returns whether any have been authored.
+  bool UpdateUsdGeometryLods(bool waitForJobs = false);
+
 #ifdef USE_INDEX_MATERIALS
   void UpdateIndexVolumeMaterial(UsdStageRefPtr sceneStage, UsdStageRefPtr timeVarStage, const SdfPath& volumePath, const UsdBridgeVolumeData& volumeData, double timeStep);
 #endif
@@ -170,6 +216,9 @@ public:
 
   UsdBridgeLogObject LogObject;
 
+  // Temporary arrays for intermediate results of converting data into USD values
+  UsdBridgeScratchArena ScratchArena;
+
 protected:
   // Connect
   std::unique_ptr<UsdBridgeConnection> Connect = nullptr;
@@ -184,6 +233,26 @@ protected:
   using SharedResourceContainer = std::vector<SharedResourceKV>;
   SharedResourceContainer SharedResourceCache; 
 
+  // Meshes exceeding 32-bit indexing and instancers exceeding their points per tile are written as child prims (parts),
+  // see UpdateUsdMeshParts and UpdateUsdInstancerTiles
+  void UpdateUsdMeshGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& geomData, double timeStep);
+  void UpdateUsdMeshParts(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& geomData, double timeStep);
+  void UpdateUsdInstancerGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& geomData, double timeStep);
+  void UpdateUsdInstancerTiles(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& geomData, double timeStep);
+  template<typename GeomDataType>
+  UsdBridgePrimCache* InitializeUsdGeometryPart(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, std::vector<std::unique_ptr<UsdBridgePrimCache>>& parts,
+    size_t partIdx, const char* partPrefix, const GeomDataType& partData);
+  void SetUsdGeometryPartsVisibility(UsdBridgePrimCache* cacheEntry, size_t numVisibleParts, const UsdTimeCode& timeCode);
+
+  // Geometry with levels of detail holds its full resolution data in a child prim, next to the generated levels and a variant set to select them,
+  // see UpdateUsdMeshLods and UpdateUsdInstancerLods
+  void UpdateUsdMeshLods(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& geomData, double timeStep);
+  void UpdateUsdInstancerLods(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& geomData, double timeStep);
+  void UpdateUsdMeshLodLevels(UsdBridgePrimCache* cacheEntry, const std::vector<UsdBridgeMeshData>& levelDatas, double timeStep);
+  void UpdateUsdInstancerLodLevels(UsdBridgePrimCache* cacheEntry, const std::vector<UsdBridgeInstancerData>& levelDatas, double timeStep);
+  void UpdateUsdGeometryLodVariants(UsdBridgePrimCache* cacheEntry, size_t numLevels);
+  void SetUsdGeometryLodsEnabled(UsdBridgePrimCache* cacheEntry, bool enabled);
+
   void AddSharedResourceRef(const UsdBridgeResourceKey& key);
   bool RemoveSharedResourceRef(const UsdBridgeResourceKey& key);
   // Sets modified flag and returns whether the shared resource has been modified since ResetSharedResourceModified()
@@ -196,6 +265,8 @@ protected:
   int SessionNumber = -1;
   UsdStageRefPtr SceneStage;
   UsdStageRefPtr ExternalSceneStage;
+  std::unordered_map<const UsdStage*, UsdStageRefPtr> DirtyStages;
+  std::unordered_map<std::string, uint64_t> PendingFileRemovals; // Relative file name and the background save it waits for (0 for the next save)
   bool EnableSaving = true;
   std::string SceneFileName;
   std::string SessionDirectory;
@@ -210,7 +281,25 @@ protected:
   double EndTime = 0.0;
 
   std::string TempNameStr;
+  UsdBridgePrimCache::RefNameSet TempRefNames;
+  std::vector<TfToken> TempUnusedRefNames;
   std::vector<unsigned char> TempImageData;
+
+  // Level of detail generation
+  std::vector<float> LodRatios;
+  uint64_t LodMinPrimitives = 0;
+  UsdBridgeLodGenerator LodGenerator;
+
+  uint32_t KeepTimeSteps = 0;
+  unsigned int NumThreads = 0;
+
+  // Time samples of the scene stage, moved into layers per range of timesteps
+  UsdBridgeTimestepLayers TimestepLayers;
+
+#ifdef VALUE_CLIP_RETIMING
+  // Caches holding clip metadata that has not been authored yet
+  std::unordered_set<UsdBridgePrimCache*> ClipMetaDataCaches;
+#endif
 };
 
 void RemoveResourceFiles(UsdBridgePrimCache* cache, UsdBridgeUsdWriter& usdWriter, 
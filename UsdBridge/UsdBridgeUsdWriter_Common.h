@@ -9,6 +9,7 @@
 
 #include <string>
 #include <sstream>
+#include <type_traits>
 
 template<typename T>
 using TimeEvaluator = UsdBridgeTimeEvaluator<T>;
@@ -214,6 +215,10 @@ namespace constring
   extern const char* const mdlSamplerPrimPf;
   extern const char* const openVDBPrimPf;
   extern const char* const protoShapePf;
+  extern const char* const meshPartPf;
+  extern const char* const tilePf;
+  extern const char* const lodPf;
+  extern const char* const lodVariantSetName;
 
   // Extensions
   extern const char* const imageExtension;
@@ -241,14 +246,6 @@ namespace constring
 #endif
 }
 
-template<typename ArrayType>
-ArrayType& GetStaticTempArray()
-{
-  static ArrayType array;
-  array.resize(0);
-  return array;
-}
-
 namespace
 {
   size_t FindLength(std::stringstream& strStream)
@@ -269,17 +266,64 @@ namespace
   }
 
   template<typename NormalsType>
-  void ConvertNormalsToQuaternions(VtQuathArray& quaternions, const void* normals, uint64_t numVertices)
+  void ConvertNormalsToQuaternions(VtQuathArray& quaternions, const void* normals, uint64_t numVertices, unsigned int numThreads)
   {
-    GfVec3f from(0.0f, 0.0f, 1.0f);
-    NormalsType* norms = (NormalsType*)(normals);
-    for (int i = 0; i < numVertices; ++i)
-    {
-      GfVec3f to((float)(norms[i * 3]), (float)(norms[i * 3 + 1]), (float)(norms[i * 3 + 2]));
-      GfRotation rot(from, to);
-      const GfQuaternion& quat = rot.GetQuaternion();
-      quaternions[i] = GfQuath((float)(quat.GetReal()), GfVec3h(quat.GetImaginary()));
-    }
+    // Quaternions are generated in batches into a small float buffer, then narrowed to half in place
+    static constexpr size_t batchSize = 256;
+    static constexpr size_t chunkSize = 1 << 14;
+    static constexpr size_t parallelThreshold = 4 * chunkSize;
+
+    const NormalsType* norms = reinterpret_cast<const NormalsType*>(normals);
+    GfQuath* quats = quaternions.data();
+
+    size_t numChunks = (numVertices + chunkSize - 1) / chunkSize;
+    ubutils::ParallelFor(numChunks, (numVertices >= parallelThreshold) ? numThreads : 1,
+      [norms, quats, numVertices](size_t chunkIdx)
+      {
+        float quatBuffer[batchSize * 4];
+        size_t chunkEnd = std::min(static_cast<size_t>(numVertices), (chunkIdx + 1) * chunkSize);
+        for (size_t batchStart = chunkIdx * chunkSize; batchStart < chunkEnd; batchStart += batchSize)
+        {
+          size_t batchCount = std::min(batchSize, chunkEnd - batchStart);
+          ubutils::DirectionsToQuaternionsZ(norms + batchStart * 3, batchCount, quatBuffer);
+          for (size_t i = 0; i < batchCount; ++i)
+          {
+            const float* quat = quatBuffer + i * 4;
+            quats[batchStart + i] = GfQuath(GfHalf(quat[3]), GfVec3h(GfHalf(quat[0]), GfHalf(quat[1]), GfHalf(quat[2])));
+          }
+        }
+      });
+  }
+
+  void ConvertTransformsToInstances(const float* transforms, const uint64_t* indices, uint64_t numInstances,
+    VtVec3fArray& positions, VtQuathArray& orientations, VtVec3fArray& scales, unsigned int numThreads)
+  {
+    // Same batching as ConvertNormalsToQuaternions(); positions and scales are written in place
+    static constexpr size_t batchSize = 256;
+    static constexpr size_t chunkSize = 1 << 14;
+    static constexpr size_t parallelThreshold = 4 * chunkSize;
+
+    float* posData = reinterpret_cast<float*>(positions.data());
+    float* scaleData = reinterpret_cast<float*>(scales.data());
+    GfQuath* quats = orientations.data();
+
+    size_t numChunks = (numInstances + chunkSize - 1) / chunkSize;
+    ubutils::ParallelFor(numChunks, (numInstances >= parallelThreshold) ? numThreads : 1,
+      [transforms, indices, numInstances, posData, scaleData, quats](size_t chunkIdx)
+      {
+        float quatBuffer[batchSize * 4];
+        size_t chunkEnd = std::min(static_cast<size_t>(numInstances), (chunkIdx + 1) * chunkSize);
+        for (size_t batchStart = chunkIdx * chunkSize; batchStart < chunkEnd; batchStart += batchSize)
+        {
+          size_t batchCount = std::min(batchSize, chunkEnd - batchStart);
+          ubutils::DecomposeTransforms(transforms, indices + batchStart, batchCount, posData + batchStart * 3, quatBuffer, scaleData + batchStart * 3);
+          for (size_t i = 0; i < batchCount; ++i)
+          {
+            const float* quat = quatBuffer + i * 4;
+            quats[batchStart + i] = GfQuath(GfHalf(quat[3]), GfVec3h(GfHalf(quat[0]), GfHalf(quat[1]), GfHalf(quat[2])));
+          }
+        }
+      });
   }
 
   template<typename GeomDataType>
@@ -737,6 +781,37 @@ namespace
 #endif
   }
 
+  // Vt_ArrayForeignDataSource is internal to Vt without any stability guarantee across USD releases. The dependency is intentional,
+  // as it is the only way to author arrays without copying, but it is restricted to the USD versions that provide it with the expected interface.
+  // Other versions copy the array data instead.
+#if PXR_VERSION >= 2002
+#define USDBRIDGE_VT_FOREIGN_DATA
+#endif
+
+#ifdef USDBRIDGE_VT_FOREIGN_DATA
+  // Lets a VtArray reference memory of a UsdBridgeDataOwner, for as long as any copy of the array (ie. in a layer) exists
+  class UsdBridgeForeignDataSource : public Vt_ArrayForeignDataSource
+  {
+    public:
+      UsdBridgeForeignDataSource(UsdBridgeDataOwner* owner)
+        : Vt_ArrayForeignDataSource(&UsdBridgeForeignDataSource::ArraysDetached)
+        , Owner(owner)
+      {
+        Owner->AddDataRef();
+      }
+
+    protected:
+      static void ArraysDetached(Vt_ArrayForeignDataSource* self)
+      {
+        UsdBridgeForeignDataSource* source = static_cast<UsdBridgeForeignDataSource*>(self);
+        source->Owner->ReleaseDataRef();
+        delete source;
+      }
+
+      UsdBridgeDataOwner* Owner;
+  };
+#endif
+
     // Array assignment
   template<class ArrayType>
   void AssignArrayToPrimvar(const void* data, size_t numElements, const UsdTimeCode& timeCode, ArrayType* usdArray)
@@ -746,6 +821,22 @@ namespace
     usdArray->assign(typedData, typedData + numElements);
   }
 
+  template<class ArrayType>
+  void AssignArrayToPrimvarShared(const void* data, size_t numElements, UsdBridgeDataOwner* dataOwner, const UsdTimeCode& timeCode, ArrayType* usdArray)
+  {
+#ifdef USDBRIDGE_VT_FOREIGN_DATA
+    if(dataOwner && numElements)
+    {
+      // No copy; any write access to the VtArray will detach it from the owner's memory first
+      using ElementType = typename ArrayType::ElementType;
+      ElementType* typedData = const_cast<ElementType*>(reinterpret_cast<const ElementType*>(data));
+      *usdArray = ArrayType(new UsdBridgeForeignDataSource(dataOwner), typedData, numElements);
+      return;
+    }
+#endif
+    AssignArrayToPrimvar<ArrayType>(data, numElements, timeCode, usdArray);
+  }
+
   template<class ArrayType>
   void AssignArrayToPrimvarFlatten(const void* data, UsdBridgeType dataType, size_t numElements, const UsdTimeCode& timeCode, ArrayType* usdArray)
   {
@@ -755,97 +846,159 @@ namespace
     AssignArrayToPrimvar<ArrayType>(data, numFlattenedElements, timeCode, usdArray);
   }
 
+  // Calls func(begin, end) for chunks of [0, numElements), distributed over numThreads of the thread pool for large arrays
+  template<typename FuncType>
+  void ForEachConvertChunk(size_t numElements, unsigned int numThreads, const FuncType& func)
+  {
+    static constexpr size_t chunkSize = 1 << 16;
+    static constexpr size_t parallelThreshold = 4 * chunkSize;
+
+    size_t numChunks = (numElements + chunkSize - 1) / chunkSize;
+    ubutils::ParallelFor(numChunks, (numElements >= parallelThreshold) ? numThreads : 1,
+      [numElements, &func](size_t chunkIdx)
+      {
+        size_t begin = chunkIdx * chunkSize;
+        func(begin, std::min(begin + chunkSize, numElements));
+      });
+  }
+
+  template<typename ValueType, bool isVec = GfIsGfVec<ValueType>::value>
+  struct UsdBridgeScalarOf { using Type = ValueType; static constexpr size_t Dimension = 1; };
+  template<typename ValueType>
+  struct UsdBridgeScalarOf<ValueType, true> { using Type = typename ValueType::ScalarType; static constexpr size_t Dimension = ValueType::dimension; };
+
   template<class ArrayType, class EltType>
-  void AssignArrayToPrimvarConvert(const void* data, size_t numElements, const UsdTimeCode& timeCode, ArrayType* usdArray)
+  void AssignArrayToPrimvarConvert(const void* data, size_t numElements, const UsdTimeCode& timeCode, ArrayType* usdArray, unsigned int numThreads)
   {
     using ElementType = typename ArrayType::ElementType;
-    EltType* typedData = (EltType*)data;
+    using InScalar = UsdBridgeScalarOf<EltType>;
+    using OutScalar = UsdBridgeScalarOf<ElementType>;
+    const EltType* typedData = reinterpret_cast<const EltType*>(data);
 
     usdArray->resize(numElements);
-    for (int i = 0; i < numElements; ++i)
+    if constexpr (std::is_same<typename InScalar::Type, double>::value && std::is_same<typename OutScalar::Type, float>::value
+      && InScalar::Dimension == OutScalar::Dimension)
     {
-      (*usdArray)[i] = ElementType(typedData[i]);
+      const double* input = reinterpret_cast<const double*>(typedData);
+      float* output = reinterpret_cast<float*>(usdArray->data());
+      ForEachConvertChunk(numElements, numThreads, [input, output](size_t begin, size_t end)
+        { ubutils::ConvertToFloat(input + begin*InScalar::Dimension, (end-begin)*InScalar::Dimension, output + begin*InScalar::Dimension); });
+    }
+    else
+    {
+      for (size_t i = 0; i < numElements; ++i)
+      {
+        (*usdArray)[i] = ElementType(typedData[i]);
+      }
     }
   }
 
   template<class ArrayType, class EltType>
-  void AssignArrayToPrimvarConvertFlatten(const void* data, UsdBridgeType dataType, size_t numElements, const UsdTimeCode& timeCode, ArrayType* usdArray)
+  void AssignArrayToPrimvarConvertFlatten(const void* data, UsdBridgeType dataType, size_t numElements, const UsdTimeCode& timeCode, ArrayType* usdArray, unsigned int numThreads)
   {
     int elementMultiplier = UsdBridgeTypeNumComponents(dataType);
     size_t numFlattenedElements = numElements * elementMultiplier;
 
-    AssignArrayToPrimvarConvert<ArrayType, EltType>(data, numFlattenedElements, timeCode, usdArray);
+    AssignArrayToPrimvarConvert<ArrayType, EltType>(data, numFlattenedElements, timeCode, usdArray, numThreads);
   }
 
-  template<typename ArrayType, typename EltType>
-  void Expand1ToVec3(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, ArrayType* usdArray)
+  // Converts float or double data to the half precision array elements of the same dimension
+  template<class ArrayType, class EltType>
+  void AssignArrayToPrimvarHalf(const void* data, size_t numElements, const UsdTimeCode& timeCode, ArrayType* usdArray, unsigned int numThreads)
   {
+    using InScalar = UsdBridgeScalarOf<EltType>;
+    using OutScalar = UsdBridgeScalarOf<typename ArrayType::ElementType>;
+    static_assert(std::is_same<typename OutScalar::Type, GfHalf>::value && sizeof(GfHalf) == sizeof(uint16_t), "AssignArrayToPrimvarHalf requires an array of 16-bit GfHalf elements");
+    static_assert(InScalar::Dimension == OutScalar::Dimension, "AssignArrayToPrimvarHalf requires input and output elements of the same dimension");
+
     usdArray->resize(numElements);
-    const EltType* typedInput = reinterpret_cast<const EltType*>(data);
-    for (int i = 0; i < numElements; ++i)
-    {
-      (*usdArray)[i] = typename ArrayType::ElementType(typedInput[i], typedInput[i], typedInput[i]);
-    }
+    const typename InScalar::Type* input = reinterpret_cast<const typename InScalar::Type*>(data);
+    uint16_t* output = reinterpret_cast<uint16_t*>(usdArray->data());
+    ForEachConvertChunk(numElements, numThreads, [input, output](size_t begin, size_t end)
+      { ubutils::ConvertToHalf(input + begin*InScalar::Dimension, (end-begin)*InScalar::Dimension, output + begin*InScalar::Dimension); });
   }
 
-  template<typename InputEltType, int numComponents>
-  void ExpandToColor(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, VtVec4fArray* usdArray)
+  template<typename ArrayType, typename EltType>
+  void Expand1ToVec3(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, ArrayType* usdArray, unsigned int numThreads)
   {
+    static_assert(std::is_same<typename ArrayType::ElementType, GfVec3f>::value, "Expand1ToVec3 requires a VtVec3fArray");
     usdArray->resize(numElements);
-    const InputEltType* typedInput = reinterpret_cast<const InputEltType*>(data);
-    // No memcopies, as input is not guaranteed to be of float type
-    if(numComponents == 1)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(typedInput[i], 0.0f, 0.0f, 1.0f);
-    if(numComponents == 2)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(typedInput[i*2], typedInput[i*2+1], 0.0f, 1.0f);
-    if(numComponents == 3)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(typedInput[i*3], typedInput[i*3+1], typedInput[i*3+2], 1.0f);
+    const EltType* input = reinterpret_cast<const EltType*>(data);
+    float* output = reinterpret_cast<float*>(usdArray->data());
+    ForEachConvertChunk(numElements, numThreads, [input, output](size_t begin, size_t end)
+      { ubutils::ExpandToFloat3(input + begin, end-begin, output + begin*3); });
   }
 
-  template<typename InputEltType, int numComponents>
-  void ExpandToColorNormalize(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, VtVec4fArray* usdArray)
+  // Fills usdArray with the float4 colors that expandFunc(begin, count, output) converts from the source, in parallel chunks
+  template<typename ExpandFuncType>
+  void ExpandToColorArray(uint64_t numElements, VtVec4fArray* usdArray, unsigned int numThreads, const ExpandFuncType& expandFunc)
   {
     usdArray->resize(numElements);
-    const InputEltType* typedInput = reinterpret_cast<const InputEltType*>(data);
-    double normFactor = 1.0 / (double)std::numeric_limits<InputEltType>::max(); // float may not be enough for uint32_t
-    // No memcopies, as input is not guaranteed to be of float type
-    if(numComponents == 1)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(typedInput[i]*normFactor, 0.0f, 0.0f, 1.0f);
-    if(numComponents == 2)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(typedInput[i*2]*normFactor, typedInput[i*2+1]*normFactor, 0.0f, 1.0f);
-    if(numComponents == 3)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(typedInput[i*3]*normFactor, typedInput[i*3+1]*normFactor, typedInput[i*3+2]*normFactor, 1.0f);
-    if(numComponents == 4)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(typedInput[i*4]*normFactor, typedInput[i*4+1]*normFactor, typedInput[i*4+2]*normFactor, typedInput[i*4+3]*normFactor);
-  }
-
-  template<int numComponents>
-  void ExpandSRGBToColor(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, VtVec4fArray* usdArray)
+    float* output = reinterpret_cast<float*>(usdArray->data());
+    ForEachConvertChunk(numElements, numThreads, [output, &expandFunc](size_t begin, size_t end)
+      { expandFunc(begin, end-begin, output + begin*4); });
+  }
+
+  // Half precision variant, which expands small batches into a float buffer and narrows them right away, instead of a full float intermediate
+  template<typename ExpandFuncType>
+  void ExpandToColorArray(uint64_t numElements, VtVec4hArray* usdArray, unsigned int numThreads, const ExpandFuncType& expandFunc)
   {
+    static constexpr size_t batchSize = 256;
+    static_assert(sizeof(GfHalf) == sizeof(uint16_t), "ExpandToColorArray requires 16-bit GfHalf elements");
+
     usdArray->resize(numElements);
-    const unsigned char* typedInput = reinterpret_cast<const unsigned char*>(data);
-    float normFactor = 1.0f / 255.0f;
-    const float* srgbTable = ubutils::SrgbToLinearTable();
+    uint16_t* output = reinterpret_cast<uint16_t*>(usdArray->data());
+    ForEachConvertChunk(numElements, numThreads, [output, &expandFunc](size_t begin, size_t end)
+      {
+        float colorBuffer[batchSize * 4];
+        for (size_t batchStart = begin; batchStart < end; batchStart += batchSize)
+        {
+          size_t batchCount = std::min(batchSize, end - batchStart);
+          expandFunc(batchStart, batchCount, colorBuffer);
+          ubutils::ConvertToHalf(colorBuffer, batchCount * 4, output + batchStart * 4);
+        }
+      });
+  }
+
+  template<typename InputEltType, int numComponents, typename ColorArrayType>
+  void ExpandToColor(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, ColorArrayType* usdArray, unsigned int numThreads)
+  {
     // No memcopies, as input is not guaranteed to be of float type
-    if(numComponents == 1)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(srgbTable[typedInput[i]], 0.0f, 0.0f, 1.0f);
-    if(numComponents == 2)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(srgbTable[typedInput[i*2]], 0.0f, 0.0f, typedInput[i*2+1]*normFactor); // Alpha is linear
-    if(numComponents == 3)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(srgbTable[typedInput[i*3]], srgbTable[typedInput[i*3+1]], srgbTable[typedInput[i*3+2]], 1.0f);
-    if(numComponents == 4)
-      for (int i = 0; i < numElements; ++i)
-        (*usdArray)[i] = GfVec4f(srgbTable[typedInput[i*4]], srgbTable[typedInput[i*4+1]], srgbTable[typedInput[i*4+2]], typedInput[i*4+3]*normFactor);
+    const InputEltType* input = reinterpret_cast<const InputEltType*>(data);
+    ExpandToColorArray(numElements, usdArray, numThreads, [input](size_t begin, size_t count, float* output)
+      { ubutils::ExpandToFloat4(input + begin*numComponents, numComponents, count, output); });
+  }
+
+  template<typename InputEltType, int numComponents, typename ColorArrayType>
+  void ExpandToColorNormalize(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, ColorArrayType* usdArray, unsigned int numThreads)
+  {
+    const InputEltType* input = reinterpret_cast<const InputEltType*>(data);
+    ExpandToColorArray(numElements, usdArray, numThreads, [input](size_t begin, size_t count, float* output)
+      { ubutils::ExpandToFloat4Normalized(input + begin*numComponents, numComponents, count, output); });
+  }
+
+  template<int numComponents, typename ColorArrayType>
+  void ExpandSRGBToColor(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, ColorArrayType* usdArray, unsigned int numThreads)
+  {
+    const unsigned char* input = reinterpret_cast<const unsigned char*>(data);
+    ExpandToColorArray(numElements, usdArray, numThreads, [input](size_t begin, size_t count, float* output)
+      { ubutils::ExpandSrgbToFloat4(input + begin*numComponents, numComponents, count, output); });
+  }
+
+  // Copies GfVec4f or GfVec4d colors
+  template<typename InputEltType>
+  void CopyToColor(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, VtVec4fArray* usdArray, unsigned int numThreads)
+  {
+    if constexpr (std::is_same<InputEltType, GfVec4f>::value)
+      AssignArrayToPrimvar<VtVec4fArray>(data, numElements, timeCode, usdArray);
+    else
+      AssignArrayToPrimvarConvert<VtVec4fArray, InputEltType>(data, numElements, timeCode, usdArray, numThreads);
+  }
+
+  template<typename InputEltType>
+  void CopyToColor(const void* data, uint64_t numElements, const UsdTimeCode& timeCode, VtVec4hArray* usdArray, unsigned int numThreads)
+  {
+    AssignArrayToPrimvarHalf<VtVec4hArray, InputEltType>(data, numElements, timeCode, usdArray, numThreads);
   }
 }
 
@@ -867,113 +1020,203 @@ namespace
   else \
     _uniformAttrib.Set(_value, timeEval.Default());
 
+namespace
+{
+  // Upper bound on the distinct values of an indexed primvar, so high-cardinality arrays are rejected after looking at a small part of them
+  constexpr size_t MaxIndexedPrimvarValues = 1 << 14;
+
+  // Writes the distinct values of flatArray and the value index of every element, if that is smaller than flatArray itself
+  template<typename ArrayType>
+  bool IndexArrayValues(const ArrayType& flatArray, ArrayType& values, VtIntArray& indices, unsigned int numThreads)
+  {
+    using ElementType = typename ArrayType::ElementType;
+    constexpr size_t elementSize = sizeof(ElementType);
+    if constexpr (elementSize <= sizeof(int))
+    {
+      return false; // Indexing cannot make arrays with elements of index size or smaller any smaller
+    }
+    else
+    {
+      size_t numElements = flatArray.size();
+      if(numElements < 2)
+        return false;
+
+      // Only smaller if numValues*elementSize + numElements*sizeof(int) < numElements*elementSize
+      size_t maxValues = std::min((numElements*(elementSize - sizeof(int)) - 1) / elementSize, MaxIndexedPrimvarValues);
+
+      indices.resize(numElements);
+      std::vector<size_t> firstElements;
+      if(!ubutils::IndexDistinctValues(flatArray.cdata(), elementSize, numElements, maxValues, indices.data(), firstElements, numThreads))
+        return false;
+
+      values.resize(firstElements.size());
+      for(size_t valueIdx = 0; valueIdx < firstElements.size(); ++valueIdx)
+        values[valueIdx] = flatArray[firstElements[valueIdx]];
+      return true;
+    }
+  }
+
+  void BlockUsdPrimvarIndices(const UsdGeomPrimvar& primvar, const UsdTimeCode& timeCode)
+  {
+    UsdAttribute indicesAttr = primvar.GetIndicesAttr();
+    if(indicesAttr && indicesAttr.HasAuthoredValue())
+      indicesAttr.Set(SdfValueBlock(), timeCode);
+  }
+
+  // Sets converted arrays to a primvar attribute. With indexValues, an array is authored as its distinct values plus indices
+  // if that is smaller, and as is otherwise, in which case no indices apply to it at timeCode.
+  struct UsdBridgePrimvarArraySetter
+  {
+    UsdBridgePrimvarArraySetter(const UsdAttribute& attrib, bool indexValues, unsigned int numThreads)
+      : Attrib(attrib), IndexValues(indexValues), NumThreads(numThreads)
+    {}
+
+    template<typename ArrayType>
+    void Set(const ArrayType& usdArray, const UsdTimeCode& timeCode) const
+    {
+      if(IndexValues)
+      {
+        UsdGeomPrimvar primvar(Attrib);
+        ArrayType values;
+        VtIntArray indices;
+        if(IndexArrayValues(usdArray, values, indices, NumThreads))
+        {
+          Attrib.Set(values, timeCode);
+          primvar.SetIndices(indices, timeCode);
+          return;
+        }
+        BlockUsdPrimvarIndices(primvar, timeCode);
+      }
+      Attrib.Set(usdArray, timeCode);
+    }
+
+    const UsdAttribute& Attrib;
+    bool IndexValues;
+    unsigned int NumThreads;
+  };
+}
+
 #define ASSIGN_SET_PRIMVAR if(setPrimvar) arrayPrimvar.Set(usdArray, timeCode)
 #define ASSIGN_PRIMVAR_MACRO(ArrayType) \
-  ArrayType& usdArray = GetStaticTempArray<ArrayType>(); AssignArrayToPrimvar<ArrayType>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ArrayType usdArray; AssignArrayToPrimvar<ArrayType>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+#define ASSIGN_PRIMVAR_SHARED_MACRO(ArrayType) \
+  ArrayType usdArray; AssignArrayToPrimvarShared<ArrayType>(arrayData, arrayNumElements, arrayDataOwner, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+#define ASSIGN_PRIMVAR_SHARED_CUSTOM_ARRAY_MACRO(ArrayType, customArray) \
+  ArrayType& usdArray = customArray; AssignArrayToPrimvarShared<ArrayType>(arrayData, arrayNumElements, arrayDataOwner, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_FLATTEN_MACRO(ArrayType) \
-  ArrayType& usdArray = GetStaticTempArray<ArrayType>(); AssignArrayToPrimvarFlatten<ArrayType>(arrayData, arrayDataType, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ArrayType usdArray; AssignArrayToPrimvarFlatten<ArrayType>(arrayData, arrayDataType, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_CONVERT_MACRO(ArrayType, EltType) \
-  ArrayType& usdArray = GetStaticTempArray<ArrayType>(); AssignArrayToPrimvarConvert<ArrayType, EltType>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ArrayType usdArray; AssignArrayToPrimvarConvert<ArrayType, EltType>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_CONVERT_FLATTEN_MACRO(ArrayType, EltType) \
-  ArrayType& usdArray = GetStaticTempArray<ArrayType>(); AssignArrayToPrimvarConvertFlatten<ArrayType, EltType>(arrayData, arrayDataType, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ArrayType usdArray; AssignArrayToPrimvarConvertFlatten<ArrayType, EltType>(arrayData, arrayDataType, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_CUSTOM_ARRAY_MACRO(ArrayType, customArray) \
   ArrayType& usdArray = customArray; AssignArrayToPrimvar<ArrayType>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_CONVERT_CUSTOM_ARRAY_MACRO(ArrayType, EltType, customArray) \
-  ArrayType& usdArray = customArray; AssignArrayToPrimvarConvert<ArrayType, EltType>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ArrayType& usdArray = customArray; AssignArrayToPrimvarConvert<ArrayType, EltType>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
+#define ASSIGN_PRIMVAR_HALF_MACRO(ArrayType, EltType) \
+  ArrayType usdArray; AssignArrayToPrimvarHalf<ArrayType, EltType>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_1EXPAND3(ArrayType, EltType) \
-  ArrayType& usdArray = GetStaticTempArray<ArrayType>(); Expand1ToVec3<ArrayType, EltType>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ArrayType usdArray; Expand1ToVec3<ArrayType, EltType>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_1EXPAND_COL(EltType) \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandToColor<EltType, 1>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandToColor<EltType, 1>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_2EXPAND_COL(EltType) \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandToColor<EltType, 2>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandToColor<EltType, 2>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_3EXPAND_COL(EltType) \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandToColor<EltType, 3>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandToColor<EltType, 3>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
+#define ASSIGN_PRIMVAR_MACRO_4COPY_COL(EltType) \
+  ColorArrayType& usdArray = colorArray; CopyToColor<EltType>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_1EXPAND_NORMALIZE_COL(EltType) \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandToColorNormalize<EltType, 1>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandToColorNormalize<EltType, 1>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_2EXPAND_NORMALIZE_COL(EltType) \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandToColorNormalize<EltType, 2>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandToColorNormalize<EltType, 2>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_3EXPAND_NORMALIZE_COL(EltType) \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandToColorNormalize<EltType, 3>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandToColorNormalize<EltType, 3>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_4EXPAND_NORMALIZE_COL(EltType) \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandToColorNormalize<EltType, 4>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandToColorNormalize<EltType, 4>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_1EXPAND_SGRB() \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandSRGBToColor<1>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandSRGBToColor<1>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_2EXPAND_SGRB() \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandSRGBToColor<2>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandSRGBToColor<2>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_3EXPAND_SGRB() \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandSRGBToColor<3>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
+  ColorArrayType& usdArray = colorArray; ExpandSRGBToColor<3>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 #define ASSIGN_PRIMVAR_MACRO_4EXPAND_SGRB() \
-  VtVec4fArray& usdArray = GetStaticTempArray<VtVec4fArray>(); ExpandSRGBToColor<4>(arrayData, arrayNumElements, timeCode, &usdArray); ASSIGN_SET_PRIMVAR
-
-#define GET_USDARRAY_REF usdArrayRef = &usdArray
+  ColorArrayType& usdArray = colorArray; ExpandSRGBToColor<4>(arrayData, arrayNumElements, timeCode, &usdArray, numThreads); ASSIGN_SET_PRIMVAR
 
 namespace
 {
-  // Assigns color data array to VtVec4fArray primvar
-  VtVec4fArray* AssignColorArrayToPrimvar(const UsdBridgeLogObject& logObj, const void* arrayData, size_t arrayNumElements, UsdBridgeType arrayType, UsdTimeCode timeCode, const UsdAttribute& arrayPrimvar, bool setPrimvar = true)
+  // Assigns color data array to a VtVec4fArray or VtVec4hArray primvar, or to outColors instead if provided. Returns false for unsupported types.
+  // With indexValues, the primvar is set through UsdBridgePrimvarArraySetter. Large arrays are converted in parallel over numThreads.
+  template<typename ColorArrayType>
+  bool AssignColorArrayToPrimvar(const UsdBridgeLogObject& logObj, const void* arrayData, size_t arrayNumElements, UsdBridgeType arrayType, UsdTimeCode timeCode, const UsdAttribute& primvarAttr,
+    unsigned int numThreads, ColorArrayType* outColors = nullptr, bool indexValues = false)
   {
-    VtVec4fArray* usdArrayRef = nullptr;
+    UsdBridgePrimvarArraySetter arrayPrimvar(primvarAttr, indexValues, numThreads);
+    ColorArrayType localColors;
+    ColorArrayType& colorArray = outColors ? *outColors : localColors;
+    bool setPrimvar = !outColors;
     switch (arrayType)
     {
-      case UsdBridgeType::UCHAR: {ASSIGN_PRIMVAR_MACRO_1EXPAND_NORMALIZE_COL(uint8_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UCHAR2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_NORMALIZE_COL(uint8_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UCHAR3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_NORMALIZE_COL(uint8_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UCHAR4: {ASSIGN_PRIMVAR_MACRO_4EXPAND_NORMALIZE_COL(uint8_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UCHAR_SRGB_R: {ASSIGN_PRIMVAR_MACRO_1EXPAND_SGRB(); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UCHAR_SRGB_RA: {ASSIGN_PRIMVAR_MACRO_2EXPAND_SGRB(); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UCHAR_SRGB_RGB: {ASSIGN_PRIMVAR_MACRO_3EXPAND_SGRB(); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UCHAR_SRGB_RGBA: {ASSIGN_PRIMVAR_MACRO_4EXPAND_SGRB(); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::USHORT: {ASSIGN_PRIMVAR_MACRO_1EXPAND_NORMALIZE_COL(uint16_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::USHORT2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_NORMALIZE_COL(uint16_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::USHORT3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_NORMALIZE_COL(uint16_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::USHORT4: {ASSIGN_PRIMVAR_MACRO_4EXPAND_NORMALIZE_COL(uint16_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UINT: {ASSIGN_PRIMVAR_MACRO_1EXPAND_NORMALIZE_COL(uint32_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UINT2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_NORMALIZE_COL(uint32_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UINT3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_NORMALIZE_COL(uint32_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::UINT4: {ASSIGN_PRIMVAR_MACRO_4EXPAND_NORMALIZE_COL(uint32_t); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::FLOAT: {ASSIGN_PRIMVAR_MACRO_1EXPAND_COL(float); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::FLOAT2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_COL(float); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::FLOAT3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_COL(float); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::FLOAT4: {ASSIGN_PRIMVAR_MACRO(VtVec4fArray); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::DOUBLE: {ASSIGN_PRIMVAR_MACRO_1EXPAND_COL(double); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::DOUBLE2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_COL(double); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::DOUBLE3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_COL(double); GET_USDARRAY_REF; break; }
-      case UsdBridgeType::DOUBLE4: {ASSIGN_PRIMVAR_CONVERT_MACRO(VtVec4fArray, GfVec4d); GET_USDARRAY_REF; break; }
-      default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom color primvar is not of type (UCHAR/USHORT/UINT/FLOAT/DOUBLE)(1/2/3/4) or UCHAR_SRGB_<X>."); break; }
+      case UsdBridgeType::UCHAR: {ASSIGN_PRIMVAR_MACRO_1EXPAND_NORMALIZE_COL(uint8_t); break; }
+      case UsdBridgeType::UCHAR2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_NORMALIZE_COL(uint8_t); break; }
+      case UsdBridgeType::UCHAR3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_NORMALIZE_COL(uint8_t); break; }
+      case UsdBridgeType::UCHAR4: {ASSIGN_PRIMVAR_MACRO_4EXPAND_NORMALIZE_COL(uint8_t); break; }
+      case UsdBridgeType::UCHAR_SRGB_R: {ASSIGN_PRIMVAR_MACRO_1EXPAND_SGRB(); break; }
+      case UsdBridgeType::UCHAR_SRGB_RA: {ASSIGN_PRIMVAR_MACRO_2EXPAND_SGRB(); break; }
+      case UsdBridgeType::UCHAR_SRGB_RGB: {ASSIGN_PRIMVAR_MACRO_3EXPAND_SGRB(); break; }
+      case UsdBridgeType::UCHAR_SRGB_RGBA: {ASSIGN_PRIMVAR_MACRO_4EXPAND_SGRB(); break; }
+      case UsdBridgeType::USHORT: {ASSIGN_PRIMVAR_MACRO_1EXPAND_NORMALIZE_COL(uint16_t); break; }
+      case UsdBridgeType::USHORT2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_NORMALIZE_COL(uint16_t); break; }
+      case UsdBridgeType::USHORT3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_NORMALIZE_COL(uint16_t); break; }
+      case UsdBridgeType::USHORT4: {ASSIGN_PRIMVAR_MACRO_4EXPAND_NORMALIZE_COL(uint16_t); break; }
+      case UsdBridgeType::UINT: {ASSIGN_PRIMVAR_MACRO_1EXPAND_NORMALIZE_COL(uint32_t); break; }
+      case UsdBridgeType::UINT2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_NORMALIZE_COL(uint32_t); break; }
+      case UsdBridgeType::UINT3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_NORMALIZE_COL(uint32_t); break; }
+      case UsdBridgeType::UINT4: {ASSIGN_PRIMVAR_MACRO_4EXPAND_NORMALIZE_COL(uint32_t); break; }
+      case UsdBridgeType::FLOAT: {ASSIGN_PRIMVAR_MACRO_1EXPAND_COL(float); break; }
+      case UsdBridgeType::FLOAT2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_COL(float); break; }
+      case UsdBridgeType::FLOAT3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_COL(float); break; }
+      case UsdBridgeType::FLOAT4: {ASSIGN_PRIMVAR_MACRO_4COPY_COL(GfVec4f); break; }
+      case UsdBridgeType::DOUBLE: {ASSIGN_PRIMVAR_MACRO_1EXPAND_COL(double); break; }
+      case UsdBridgeType::DOUBLE2: {ASSIGN_PRIMVAR_MACRO_2EXPAND_COL(double); break; }
+      case UsdBridgeType::DOUBLE3: {ASSIGN_PRIMVAR_MACRO_3EXPAND_COL(double); break; }
+      case UsdBridgeType::DOUBLE4: {ASSIGN_PRIMVAR_MACRO_4COPY_COL(GfVec4d); break; }
+      default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom color primvar is not of type (UCHAR/USHORT/UINT/FLOAT/DOUBLE)(1/2/3/4) or UCHAR_SRGB_<X>."); return false; }
     }
 
-    return usdArrayRef;
+    return true;
   }
 
-  void AssignAttribArrayToPrimvar(const UsdBridgeLogObject& logObj, const void* arrayData, UsdBridgeType arrayDataType, size_t arrayNumElements, const UsdAttribute& arrayPrimvar, const UsdTimeCode& timeCode)
+  void AssignAttribArrayToPrimvar(const UsdBridgeLogObject& logObj, const void* arrayData, UsdBridgeType arrayDataType, size_t arrayNumElements, const UsdAttribute& primvarAttr, const UsdTimeCode& timeCode,
+    unsigned int numThreads, UsdBridgeDataOwner* arrayDataOwner = nullptr, bool indexValues = false)
   {
+    UsdBridgePrimvarArraySetter arrayPrimvar(primvarAttr, indexValues, numThreads);
     bool setPrimvar = true;
     switch (arrayDataType)
     {
-      case UsdBridgeType::UCHAR: { ASSIGN_PRIMVAR_MACRO(VtUCharArray); break; }
-      case UsdBridgeType::UCHAR_SRGB_R: { ASSIGN_PRIMVAR_MACRO(VtUCharArray); break; }
-      case UsdBridgeType::CHAR: { ASSIGN_PRIMVAR_MACRO(VtUCharArray); break; }
+      case UsdBridgeType::UCHAR: { ASSIGN_PRIMVAR_SHARED_MACRO(VtUCharArray); break; }
+      case UsdBridgeType::UCHAR_SRGB_R: { ASSIGN_PRIMVAR_SHARED_MACRO(VtUCharArray); break; }
+      case UsdBridgeType::CHAR: { ASSIGN_PRIMVAR_SHARED_MACRO(VtUCharArray); break; }
       case UsdBridgeType::USHORT: { ASSIGN_PRIMVAR_CONVERT_MACRO(VtUIntArray, short); break; }
       case UsdBridgeType::SHORT: { ASSIGN_PRIMVAR_CONVERT_MACRO(VtIntArray, unsigned short); break; }
-      case UsdBridgeType::UINT: { ASSIGN_PRIMVAR_MACRO(VtUIntArray); break; }
-      case UsdBridgeType::INT: { ASSIGN_PRIMVAR_MACRO(VtIntArray); break; }
-      case UsdBridgeType::LONG: { ASSIGN_PRIMVAR_MACRO(VtInt64Array); break; }
-      case UsdBridgeType::ULONG: { ASSIGN_PRIMVAR_MACRO(VtUInt64Array); break; }
-      case UsdBridgeType::HALF: { ASSIGN_PRIMVAR_MACRO(VtHalfArray); break; }
-      case UsdBridgeType::FLOAT: { ASSIGN_PRIMVAR_MACRO(VtFloatArray); break; }
-      case UsdBridgeType::DOUBLE: { ASSIGN_PRIMVAR_MACRO(VtDoubleArray); break; }
-
-      case UsdBridgeType::INT2: { ASSIGN_PRIMVAR_MACRO(VtVec2iArray); break; }
-      case UsdBridgeType::FLOAT2: { ASSIGN_PRIMVAR_MACRO(VtVec2fArray); break; }
-      case UsdBridgeType::DOUBLE2: { ASSIGN_PRIMVAR_MACRO(VtVec2dArray); break; }
-
-      case UsdBridgeType::INT3: { ASSIGN_PRIMVAR_MACRO(VtVec3iArray); break; }
-      case UsdBridgeType::FLOAT3: { ASSIGN_PRIMVAR_MACRO(VtVec3fArray); break; }
-      case UsdBridgeType::DOUBLE3: { ASSIGN_PRIMVAR_MACRO(VtVec3dArray); break; }
-
-      case UsdBridgeType::INT4: { ASSIGN_PRIMVAR_MACRO(VtVec4iArray); break; }
-      case UsdBridgeType::FLOAT4: { ASSIGN_PRIMVAR_MACRO(VtVec4fArray); break; }
-      case UsdBridgeType::DOUBLE4: { ASSIGN_PRIMVAR_MACRO(VtVec4dArray); break; }
+      case UsdBridgeType::UINT: { ASSIGN_PRIMVAR_SHARED_MACRO(VtUIntArray); break; }
+      case UsdBridgeType::INT: { ASSIGN_PRIMVAR_SHARED_MACRO(VtIntArray); break; }
+      case UsdBridgeType::LONG: { ASSIGN_PRIMVAR_SHARED_MACRO(VtInt64Array); break; }
+      case UsdBridgeType::ULONG: { ASSIGN_PRIMVAR_SHARED_MACRO(VtUInt64Array); break; }
+      case UsdBridgeType::HALF: { ASSIGN_PRIMVAR_SHARED_MACRO(VtHalfArray); break; }
+      case UsdBridgeType::FLOAT: { ASSIGN_PRIMVAR_SHARED_MACRO(VtFloatArray); break; }
+      case UsdBridgeType::DOUBLE: { ASSIGN_PRIMVAR_SHARED_MACRO(VtDoubleArray); break; }
+
+      case UsdBridgeType::INT2: { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec2iArray); break; }
+      case UsdBridgeType::FLOAT2: { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec2fArray); break; }
+      case UsdBridgeType::DOUBLE2: { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec2dArray); break; }
+
+      case UsdBridgeType::INT3: { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec3iArray); break; }
+      case UsdBridgeType::FLOAT3: { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec3fArray); break; }
+      case UsdBridgeType::DOUBLE3: { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec3dArray); break; }
+
+      case UsdBridgeType::INT4: { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec4iArray); break; }
+      case UsdBridgeType::FLOAT4: { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec4fArray); break; }
+      case UsdBridgeType::DOUBLE4: { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec4dArray); break; }
 
       case UsdBridgeType::UCHAR2:
       case UsdBridgeType::UCHAR3: 
@@ -1006,6 +1249,27 @@ namespace
       default: {UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom Attribute<Index> primvar copy does not support source data type: " << arrayDataType) break; }
     };
   }
+
+  // Assigns float or double data array to a half precision primvar of the same dimension
+  void AssignHalfArrayToPrimvar(const UsdBridgeLogObject& logObj, const void* arrayData, UsdBridgeType arrayDataType, size_t arrayNumElements, const UsdAttribute& primvarAttr, const UsdTimeCode& timeCode,
+    unsigned int numThreads, bool indexValues = false)
+  {
+    UsdBridgePrimvarArraySetter arrayPrimvar(primvarAttr, indexValues, numThreads);
+    bool setPrimvar = true;
+    switch (arrayDataType)
+    {
+      case UsdBridgeType::FLOAT: { ASSIGN_PRIMVAR_HALF_MACRO(VtHalfArray, float); break; }
+      case UsdBridgeType::FLOAT2: { ASSIGN_PRIMVAR_HALF_MACRO(VtVec2hArray, GfVec2f); break; }
+      case UsdBridgeType::FLOAT3: { ASSIGN_PRIMVAR_HALF_MACRO(VtVec3hArray, GfVec3f); break; }
+      case UsdBridgeType::FLOAT4: { ASSIGN_PRIMVAR_HALF_MACRO(VtVec4hArray, GfVec4f); break; }
+      case UsdBridgeType::DOUBLE: { ASSIGN_PRIMVAR_HALF_MACRO(VtHalfArray, double); break; }
+      case UsdBridgeType::DOUBLE2: { ASSIGN_PRIMVAR_HALF_MACRO(VtVec2hArray, GfVec2d); break; }
+      case UsdBridgeType::DOUBLE3: { ASSIGN_PRIMVAR_HALF_MACRO(VtVec3hArray, GfVec3d); break; }
+      case UsdBridgeType::DOUBLE4: { ASSIGN_PRIMVAR_HALF_MACRO(VtVec4hArray, GfVec4d); break; }
+
+      default: {UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom half precision primvar copy does not support source data type: " << arrayDataType) break; }
+    };
+  }
 }
 
 
@@ -5,6 +5,11 @@
 
 #include "UsdBridgeUsdWriter_Common.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
 namespace
 {
   template<typename UsdGeomType>
@@ -22,6 +27,279 @@ namespace
   template<>
   UsdAttribute UsdGeomGetPointsAttribute(UsdGeomPointInstancer& usdGeom) { return usdGeom.GetPositionsAttr(); }
 
+  // Identifies the source data of an array value by content hash, type and size (0 if the data hash is unknown)
+  uint64_t GetArrayValueKey(uint64_t dataHash, UsdBridgeType dataType, size_t numElements)
+  {
+    if(!dataHash)
+      return 0;
+    return ubutils::HashCombine(ubutils::HashCombine(dataHash, static_cast<uint64_t>(dataType)), static_cast<uint64_t>(numElements));
+  }
+
+  // Key of the source data of a value about to be written to attrib. The content hash is only resolved if attrib has been written before,
+  // ie. when the key is compared; for the first write 0 is returned, so the value written is identified from the next write onwards.
+  uint64_t GetArrayValueKey(const UsdBridgePrimCache* cacheEntry, const UsdAttribute& attrib, const UsdBridgeDataHash& dataHash,
+    UsdBridgeType dataType, size_t numElements)
+  {
+    if(cacheEntry->ArrayValues.find(attrib.GetName()) == cacheEntry->ArrayValues.end())
+      return 0;
+    return GetArrayValueKey(dataHash.Get(), dataType, numElements);
+  }
+
+  // Hash of data selected from source data by a topology (ie. the faces of a mesh part or the points of a tile), resolved from the hashes of both
+  // when requested, so deriving it doesn't compute any content hashes; 0 if any of them is unknown
+  class UsdBridgeDerivedDataHash : public UsdBridgeDataHashSource
+  {
+    public:
+      UsdBridgeDataHash Init(const UsdBridgeDataHash& sourceHash, const UsdBridgeDataHash& topologyHash, uint64_t selection)
+      {
+        SourceHash = sourceHash;
+        TopologyHash = topologyHash;
+        Selection = selection;
+
+        UsdBridgeDataHash derivedHash;
+        derivedHash.Source = this;
+        return derivedHash;
+      }
+
+      uint64_t GetDataHash() const override
+      {
+        uint64_t sourceHash = SourceHash.Get();
+        uint64_t topologyHash = sourceHash ? TopologyHash.Get() : 0;
+        if(!topologyHash)
+          return 0;
+        return ubutils::HashCombine(ubutils::HashCombine(sourceHash, topologyHash), Selection);
+      }
+
+    protected:
+      UsdBridgeDataHash SourceHash;
+      UsdBridgeDataHash TopologyHash;
+      uint64_t Selection = 0;
+  };
+
+  // Sets the value last authored for the attribute's name if it has been converted from the same source data, so conversion can be skipped
+  bool SetCachedArrayValue(UsdBridgePrimCache* cacheEntry, uint64_t valueKey, const UsdAttribute& attrib, const UsdTimeCode& timeCode)
+  {
+    if(!valueKey)
+      return false;
+
+    auto entryIt = cacheEntry->ArrayValues.find(attrib.GetName());
+    if(entryIt == cacheEntry->ArrayValues.end() || entryIt->second.ValueKey != valueKey)
+      return false;
+
+    attrib.Set(entryIt->second.Value, timeCode);
+    return true;
+  }
+
+  // Keeps the value just authored to the attribute for reuse by SetCachedArrayValue (storage is shared with the layer).
+  // Without a key, the entry only records that the attribute has been written.
+  void CacheArrayValue(UsdBridgePrimCache* cacheEntry, uint64_t valueKey, const UsdAttribute& attrib, const UsdTimeCode& timeCode)
+  {
+    UsdBridgePrimCache::ArrayValueEntry& entry = cacheEntry->ArrayValues[attrib.GetName()];
+    entry.ValueKey = valueKey;
+    if(!valueKey || !attrib.Get(&entry.Value, timeCode))
+    {
+      entry.ValueKey = 0;
+      entry.Value = VtValue();
+    }
+  }
+
+  // Whether an attribute of dataType is written as a primvar with (unflattened) elements larger than an index, so indexing may make it smaller
+  bool AttributeIndexingApplies(UsdBridgeType dataType)
+  {
+    switch(dataType)
+    {
+      case UsdBridgeType::LONG: case UsdBridgeType::ULONG: case UsdBridgeType::DOUBLE:
+      case UsdBridgeType::INT2: case UsdBridgeType::FLOAT2: case UsdBridgeType::DOUBLE2:
+      case UsdBridgeType::INT3: case UsdBridgeType::FLOAT3: case UsdBridgeType::DOUBLE3:
+      case UsdBridgeType::INT4: case UsdBridgeType::FLOAT4: case UsdBridgeType::DOUBLE4:
+      case UsdBridgeType::HALF3: case UsdBridgeType::HALF4:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  // Type in which an attribute of dataType is written, which is the corresponding half type for float data under half precision output
+  UsdBridgeType GetAttributeOutputType(const UsdBridgeSettings& settings, UsdBridgeType dataType)
+  {
+    if(settings.HalfPrecisionOutput)
+    {
+      switch(dataType)
+      {
+        case UsdBridgeType::FLOAT: return UsdBridgeType::HALF;
+        case UsdBridgeType::FLOAT2: return UsdBridgeType::HALF2;
+        case UsdBridgeType::FLOAT3: return UsdBridgeType::HALF3;
+        case UsdBridgeType::FLOAT4: return UsdBridgeType::HALF4;
+        default: break;
+      }
+    }
+    return dataType;
+  }
+
+  // Under half precision output, normals and widths are written to the primvars:normals and primvars:widths primvars,
+  // as the schema attributes are of fixed float type and the primvars take precedence over them.
+  template<typename UsdGeomType>
+  UsdAttribute GetUsdGeomNormalsAttr(const UsdGeomType& geom, const UsdBridgeSettings& settings)
+  {
+    return settings.HalfPrecisionOutput ? UsdGeomPrimvarsAPI(geom).GetPrimvar(UsdBridgeTokens->normals).GetAttr() : geom.GetNormalsAttr();
+  }
+
+  template<typename UsdGeomType>
+  UsdAttribute GetUsdGeomWidthsAttr(const UsdGeomType& geom, const UsdBridgeSettings& settings)
+  {
+    return settings.HalfPrecisionOutput ? UsdGeomPrimvarsAPI(geom).GetPrimvar(UsdBridgeTokens->widths).GetAttr() : geom.GetWidthsAttr();
+  }
+
+  template<typename UsdGeomType, typename GeomDataType>
+  void CreateUsdGeomNormals(UsdGeomType& geom, typename GeomDataType::DataMemberId dataMemberId, const UsdBridgeSettings& settings, const TimeEvaluator<GeomDataType>* timeEval)
+  {
+    UsdGeomPrimvarsAPI primvarApi(geom);
+    if(!timeEval || timeEval->IsTimeVarying(dataMemberId))
+    {
+      if(settings.HalfPrecisionOutput)
+        primvarApi.CreatePrimvar(UsdBridgeTokens->normals, SdfValueTypeNames->Normal3hArray, UsdGeomTokens->vertex);
+      else
+        geom.CreateNormalsAttr();
+    }
+    else if(settings.HalfPrecisionOutput)
+      primvarApi.RemovePrimvar(UsdBridgeTokens->normals);
+    else
+      geom.GetPrim().RemoveProperty(UsdBridgeTokens->normals);
+  }
+
+  template<typename UsdGeomType, typename GeomDataType>
+  void CreateUsdGeomWidths(UsdGeomType& geom, typename GeomDataType::DataMemberId dataMemberId, const UsdBridgeSettings& settings, const TimeEvaluator<GeomDataType>* timeEval)
+  {
+    UsdGeomPrimvarsAPI primvarApi(geom);
+    if(!timeEval || timeEval->IsTimeVarying(dataMemberId))
+    {
+      if(settings.HalfPrecisionOutput)
+        primvarApi.CreatePrimvar(UsdBridgeTokens->widths, SdfValueTypeNames->HalfArray, UsdGeomTokens->vertex);
+      else
+        geom.CreateWidthsAttr();
+    }
+    else if(settings.HalfPrecisionOutput)
+      primvarApi.RemovePrimvar(UsdBridgeTokens->widths);
+    else
+      geom.GetPrim().RemoveProperty(UsdBridgeTokens->widths);
+  }
+
+  void SetUsdGeomWidths(UsdBridgeUsdWriter* writer, const UsdAttribute& widthsAttr, const VtFloatArray& widths, const UsdTimeCode& timeCode)
+  {
+    if(writer->Settings.HalfPrecisionOutput)
+    {
+      VtHalfArray halfWidths;
+      AssignArrayToPrimvarHalf<VtHalfArray, float>(widths.cdata(), widths.size(), timeCode, &halfWidths, writer->NumThreads);
+      widthsAttr.Set(halfWidths, timeCode);
+    }
+    else
+      widthsAttr.Set(widths, timeCode);
+  }
+
+  // Variants of SetCachedArrayValue and CacheArrayValue for primvars which may be indexed, keeping the indices along with the values
+  bool SetCachedPrimvarValue(UsdBridgePrimCache* cacheEntry, uint64_t valueKey, const UsdGeomPrimvar& primvar, const UsdTimeCode& timeCode, bool indexable)
+  {
+    if(!SetCachedArrayValue(cacheEntry, valueKey, primvar.GetAttr(), timeCode))
+      return false;
+
+    if(indexable)
+    {
+      UsdAttribute indicesAttr = primvar.CreateIndicesAttr();
+      if(!SetCachedArrayValue(cacheEntry, valueKey, indicesAttr, timeCode)) // Not indexed when cached
+        BlockUsdPrimvarIndices(primvar, timeCode);
+    }
+    return true;
+  }
+
+  void CachePrimvarValue(UsdBridgePrimCache* cacheEntry, uint64_t valueKey, const UsdGeomPrimvar& primvar, const UsdTimeCode& timeCode, bool indexable)
+  {
+    CacheArrayValue(cacheEntry, valueKey, primvar.GetAttr(), timeCode);
+    if(indexable)
+      CacheArrayValue(cacheEntry, valueKey, primvar.CreateIndicesAttr(), timeCode); // A blocked value invalidates the entry
+  }
+
+  enum class TopologyArrayKind : uint64_t
+  {
+    FACEVERTEXCOUNTS = 1,
+    IDENTITYINDICES
+  };
+
+  // Identifies an array value derived from topology alone, ie. numElements copies of elementValue or the sequence 0..numElements-1
+  uint64_t GetTopologyValueKey(TopologyArrayKind kind, uint64_t numElements, uint64_t elementValue = 0)
+  {
+    constexpr uint64_t topologySeed = 0x746F706F6C6F6779ULL;
+    return ubutils::HashCombine(ubutils::HashCombine(ubutils::HashCombine(topologySeed, static_cast<uint64_t>(kind)), numElements), elementValue);
+  }
+
+  // Before authoring a new time sample to attrib, pins the value at each time where a sample has been left out,
+  // if that time would otherwise start to resolve to the new sample (ie. when samples are written out of order)
+  void PreserveHeldArrayValues(UsdBridgePrimCache* cacheEntry, const UsdAttribute& attrib, const UsdTimeCode& timeCode)
+  {
+    if(timeCode.IsDefault())
+      return;
+
+    auto heldIt = cacheEntry->HeldArrayTimes.find(attrib.GetName());
+    if(heldIt == cacheEntry->HeldArrayTimes.end())
+      return;
+
+    double time = timeCode.GetValue();
+    double lower = 0.0, upper = 0.0;
+    bool hasSamples = false;
+    bool hasNextSample = attrib.GetBracketingTimeSamples(time, &lower, &upper, &hasSamples) && hasSamples && upper > time;
+
+    std::vector<double>& heldTimes = heldIt->second;
+    for(auto timeIt = heldTimes.begin(); timeIt != heldTimes.end();)
+    {
+      double heldTime = *timeIt;
+      if(heldTime > time && (!hasNextSample || heldTime < upper))
+      {
+        VtValue heldValue;
+        if(attrib.Get(&heldValue, heldTime))
+          attrib.Set(heldValue, heldTime);
+        timeIt = heldTimes.erase(timeIt);
+      }
+      else if(heldTime == time)
+        timeIt = heldTimes.erase(timeIt);
+      else
+        ++timeIt;
+    }
+  }
+
+  // Authors the topology value to attrib, or, for a time code past the attribute's last sample which already holds that value, leaves out the sample.
+  // The value is taken from the prim cache if it has been authored before for the same valueKey, otherwise it is created with createValue().
+  template<typename CreateValueFunc>
+  void SetTopologyArrayValue(UsdBridgePrimCache* cacheEntry, uint64_t valueKey, const UsdAttribute& attrib, const UsdTimeCode& timeCode,
+    CreateValueFunc createValue)
+  {
+    auto entryIt = cacheEntry->ArrayValues.find(attrib.GetName());
+    if(entryIt != cacheEntry->ArrayValues.end() && entryIt->second.ValueKey == valueKey)
+    {
+      const VtValue& cachedValue = entryIt->second.Value;
+
+      double lower = 0.0, upper = 0.0;
+      bool hasSamples = false;
+      if(!timeCode.IsDefault() && attrib.GetBracketingTimeSamples(timeCode.GetValue(), &lower, &upper, &hasSamples) && hasSamples
+        && lower == upper && lower <= timeCode.GetValue())
+      {
+        VtValue heldValue;
+        if(attrib.Get(&heldValue, lower) && heldValue == cachedValue) // Cheap for the cached array itself, which shares its storage with the layer
+        {
+          if(lower != timeCode.GetValue())
+            cacheEntry->HeldArrayTimes[attrib.GetName()].push_back(timeCode.GetValue());
+          return;
+        }
+      }
+
+      PreserveHeldArrayValues(cacheEntry, attrib, timeCode);
+      attrib.Set(cachedValue, timeCode);
+      return;
+    }
+
+    PreserveHeldArrayValues(cacheEntry, attrib, timeCode);
+    attrib.Set(createValue(), timeCode);
+    CacheArrayValue(cacheEntry, valueKey, attrib, timeCode);
+  }
+
   template<typename GeomDataType>
   void CreateUsdGeomColorPrimvars(UsdGeomPrimvarsAPI& primvarApi, const GeomDataType& geomData, const UsdBridgeSettings& settings, const TimeEvaluator<GeomDataType>* timeEval = nullptr)
   {
@@ -35,7 +313,10 @@ namespace
 
     if (timeVarChecked)
     {
-      primvarApi.CreatePrimvar(UsdBridgeTokens->color, SdfValueTypeNames->Float4Array);
+      SdfValueTypeName colorType = settings.HalfPrecisionOutput ? SdfValueTypeNames->Half4Array : SdfValueTypeNames->Float4Array;
+      UsdGeomPrimvar colorPrimvar = primvarApi.CreatePrimvar(UsdBridgeTokens->color, colorType);
+      if(settings.IndexedPrimvars)
+        colorPrimvar.CreateIndicesAttr();
     }
     else
     {
@@ -79,7 +360,8 @@ namespace
 
       if(timeVarChecked)
       {
-        SdfValueTypeName primvarType = GetPrimvarArrayType(attrib.DataType);
+        UsdBridgeType outputType = GetAttributeOutputType(writer->Settings, attrib.DataType);
+        SdfValueTypeName primvarType = GetPrimvarArrayType(outputType);
         if(primvarType == SdfValueTypeNames->BoolArray)
         {
           UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::WARNING, "UsdGeom Attribute<" << attribIndex << "> primvar does not support source data type: " << attrib.DataType);
@@ -91,7 +373,9 @@ namespace
         {
           primvarApi.RemovePrimvar(attribToken);
         }
-        primvarApi.CreatePrimvar(attribToken, primvarType);
+        UsdGeomPrimvar attribPrimvar = primvarApi.CreatePrimvar(attribToken, primvarType);
+        if(writer->Settings.IndexedPrimvars && AttributeIndexingApplies(outputType))
+          attribPrimvar.CreateIndicesAttr();
       }
       else if(timeEval)
       {
@@ -122,7 +406,7 @@ namespace
     CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::POINTS, CreateExtentAttr, UsdBridgeTokens->extent);
     CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::INDICES, CreateFaceVertexIndicesAttr, UsdBridgeTokens->faceVertexCounts);
     CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::INDICES, CreateFaceVertexCountsAttr, UsdBridgeTokens->faceVertexIndices);
-    CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::NORMALS, CreateNormalsAttr, UsdBridgeTokens->normals);
+    CreateUsdGeomNormals(meshGeom, DMI::NORMALS, settings, timeEval);
 
     CreateUsdGeomColorPrimvars(primvarApi, meshData, settings, timeEval);
 
@@ -144,8 +428,8 @@ namespace
     CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::POINTS, CreatePointsAttr, UsdBridgeTokens->points);
     CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::POINTS, CreateExtentAttr, UsdBridgeTokens->extent);
     CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::INSTANCEIDS, CreateIdsAttr, UsdBridgeTokens->ids);
-    CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::ORIENTATIONS, CreateNormalsAttr, UsdBridgeTokens->normals);
-    CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::SCALES, CreateWidthsAttr, UsdBridgeTokens->widths);
+    CreateUsdGeomNormals(pointsGeom, DMI::ORIENTATIONS, settings, timeEval);
+    CreateUsdGeomWidths(pointsGeom, DMI::SCALES, settings, timeEval);
 
     CreateUsdGeomColorPrimvars(primvarApi, instancerData, settings, timeEval);
 
@@ -195,8 +479,8 @@ namespace
     CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::POINTS, CreatePointsAttr, UsdBridgeTokens->positions);
     CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::POINTS, CreateExtentAttr, UsdBridgeTokens->extent);
     CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::CURVELENGTHS, CreateCurveVertexCountsAttr, UsdBridgeTokens->curveVertexCounts);
-    CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::NORMALS, CreateNormalsAttr, UsdBridgeTokens->normals);
-    CREATE_REMOVE_TIMEVARYING_ATTRIB_QUALIFIED(DMI::SCALES, CreateWidthsAttr, UsdBridgeTokens->widths);
+    CreateUsdGeomNormals(curveGeom, DMI::NORMALS, settings, timeEval);
+    CreateUsdGeomWidths(curveGeom, DMI::SCALES, settings, timeEval);
 
     CreateUsdGeomColorPrimvars(primvarApi, curveData, settings, timeEval);
 
@@ -269,8 +553,8 @@ namespace
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomPoints(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
-    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
+  void UpdateUsdGeomPoints(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval, UsdBridgePrimCache* cacheEntry)
   {
     using DMI = typename GeomDataType::DataMemberId;
     bool performsUpdate = updateEval.PerformsUpdate(DMI::POINTS);
@@ -283,7 +567,7 @@ namespace
     {
       if (!geomData.Points)
       {
-        UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "GeomData requires points.");
+        UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "GeomData requires points.");
       }
       else
       {
@@ -292,37 +576,67 @@ namespace
 
         // Points
         UsdAttribute pointsAttr = UsdGeomGetPointsAttribute(*outGeom);
+        UsdAttribute extentAttr = outGeom->GetExtentAttr();
 
-        const void* arrayData = geomData.Points;
-        size_t arrayNumElements = geomData.NumPoints;
-        UsdAttribute arrayPrimvar = pointsAttr;
-        VtVec3fArray& usdVerts = GetStaticTempArray<VtVec3fArray>();
-        bool setPrimvar = true;
+        // Unchanged points also imply an unchanged extent
+        uint64_t valueKey = GetArrayValueKey(cacheEntry, pointsAttr, geomData.PointsHash, geomData.PointsType, geomData.NumPoints);
+        if(SetCachedArrayValue(cacheEntry, valueKey, pointsAttr, timeCode)
+          && SetCachedArrayValue(cacheEntry, valueKey, extentAttr, timeCode))
+          return;
+
+        // Copy or narrow the points and compute their extent (required by Usd) in a single pass
+        size_t numPoints = geomData.NumPoints;
+        VtVec3fArray usdVerts; // Not a static temp array, as it may reference the data owner's memory
+        VtVec3fArray extentArray(2);
+        float* boundsMin = extentArray[0].data();
+        float* boundsMax = extentArray[1].data();
 
         switch (geomData.PointsType)
         {
-        case UsdBridgeType::FLOAT3: {ASSIGN_PRIMVAR_CUSTOM_ARRAY_MACRO(VtVec3fArray, usdVerts); break; }
-        case UsdBridgeType::DOUBLE3: {ASSIGN_PRIMVAR_CONVERT_CUSTOM_ARRAY_MACRO(VtVec3fArray, GfVec3d, usdVerts); break; }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom PointsAttr should be FLOAT3 or DOUBLE3."); break; }
+        case UsdBridgeType::FLOAT3:
+        {
+          const float* inPoints = reinterpret_cast<const float*>(geomData.Points);
+          if(geomData.PointsOwner && numPoints)
+          {
+            AssignArrayToPrimvarShared<VtVec3fArray>(geomData.Points, numPoints, geomData.PointsOwner, timeCode, &usdVerts);
+            ubutils::ConvertToFloat3WithBounds(inPoints, numPoints, nullptr, boundsMin, boundsMax, writer->NumThreads);
+          }
+          else
+          {
+            usdVerts.resize(numPoints);
+            ubutils::ConvertToFloat3WithBounds(inPoints, numPoints, reinterpret_cast<float*>(usdVerts.data()), boundsMin, boundsMax, writer->NumThreads);
+          }
+          pointsAttr.Set(usdVerts, timeCode);
+          break;
+        }
+        case UsdBridgeType::DOUBLE3:
+        {
+          usdVerts.resize(numPoints);
+          ubutils::ConvertToFloat3WithBounds(reinterpret_cast<const double*>(geomData.Points), numPoints, reinterpret_cast<float*>(usdVerts.data()), boundsMin, boundsMax, writer->NumThreads);
+          pointsAttr.Set(usdVerts, timeCode);
+          break;
         }
-
-        // Usd requires extent.
-        GfRange3f extent;
-        for (const auto& pt : usdVerts) {
-          extent.UnionWith(pt);
+        default:
+        {
+          UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom PointsAttr should be FLOAT3 or DOUBLE3.");
+          GfRange3f emptyExtent;
+          extentArray[0] = emptyExtent.GetMin();
+          extentArray[1] = emptyExtent.GetMax();
+          break;
         }
-        VtVec3fArray extentArray(2);
-        extentArray[0] = extent.GetMin();
-        extentArray[1] = extent.GetMax();
+        }
+
+        extentAttr.Set(extentArray, timeCode);
 
-        outGeom->GetExtentAttr().Set(extentArray, timeCode);
+        CacheArrayValue(cacheEntry, valueKey, pointsAttr, timeCode);
+        CacheArrayValue(cacheEntry, valueKey, extentAttr, timeCode);
       }
     }
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomIndices(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
-    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
+  void UpdateUsdGeomIndices(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval, UsdBridgePrimCache* cacheEntry)
   {
     using DMI = typename GeomDataType::DataMemberId;
     bool performsUpdate = updateEval.PerformsUpdate(DMI::INDICES);
@@ -338,80 +652,99 @@ namespace
 
       uint64_t numIndices = geomData.NumIndices;
 
-      VtArray<int>& usdVertexCounts = GetStaticTempArray<VtIntArray>();
-      usdVertexCounts.resize(numPrims);
-      int vertexCount = numIndices / numPrims;
-      for (uint64_t i = 0; i < numPrims; ++i)
-        usdVertexCounts[i] = vertexCount;//geomData.FaceVertCounts[i];
-
       // Face Vertex counts
+      int vertexCount = numIndices / numPrims;
       UsdAttribute faceVertCountsAttr = outGeom->GetFaceVertexCountsAttr();
-      faceVertCountsAttr.Set(usdVertexCounts, timeCode);
+      SetTopologyArrayValue(cacheEntry, GetTopologyValueKey(TopologyArrayKind::FACEVERTEXCOUNTS, numPrims, vertexCount), faceVertCountsAttr, timeCode,
+        [numPrims, vertexCount]() { return VtIntArray(numPrims, vertexCount); });
 
       if (!geomData.Indices)
       {
-        VtIntArray& tempIndices = GetStaticTempArray<VtIntArray>();
-        tempIndices.resize(numIndices);
-        for (uint64_t i = 0; i < numIndices; ++i)
-          tempIndices[i] = (int)i;
-
         UsdAttribute arrayPrimvar = outGeom->GetFaceVertexIndicesAttr();
-        arrayPrimvar.Set(tempIndices, timeCode);
+        SetTopologyArrayValue(cacheEntry, GetTopologyValueKey(TopologyArrayKind::IDENTITYINDICES, numIndices), arrayPrimvar, timeCode,
+          [numIndices]()
+          {
+            VtIntArray identityIndices(numIndices);
+            std::iota(identityIndices.begin(), identityIndices.end(), 0);
+            return identityIndices;
+          });
       }
       else
       {
         // Face indices
         const void* arrayData = geomData.Indices;
         size_t arrayNumElements = numIndices;
+        UsdBridgeDataOwner* arrayDataOwner = geomData.IndicesOwner;
         UsdAttribute arrayPrimvar = outGeom->GetFaceVertexIndicesAttr();
         bool setPrimvar = true;
+        unsigned int numThreads = writer->NumThreads;
+
+        PreserveHeldArrayValues(cacheEntry, arrayPrimvar, timeCode);
+
+        uint64_t valueKey = GetArrayValueKey(cacheEntry, arrayPrimvar, geomData.IndicesHash, geomData.IndicesType, arrayNumElements);
+        if(SetCachedArrayValue(cacheEntry, valueKey, arrayPrimvar, timeCode))
+          return;
 
         switch (geomData.IndicesType)
         {
         case UsdBridgeType::ULONG: {ASSIGN_PRIMVAR_CONVERT_MACRO(VtIntArray, uint64_t); break; }
         case UsdBridgeType::LONG: {ASSIGN_PRIMVAR_CONVERT_MACRO(VtIntArray, int64_t); break; }
-        case UsdBridgeType::INT: {ASSIGN_PRIMVAR_MACRO(VtIntArray); break; }
-        case UsdBridgeType::UINT: {ASSIGN_PRIMVAR_MACRO(VtIntArray); break; }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom FaceVertexIndicesAttr should be (U)LONG or (U)INT."); break; }
+        case UsdBridgeType::INT: {ASSIGN_PRIMVAR_SHARED_MACRO(VtIntArray); break; }
+        case UsdBridgeType::UINT: {ASSIGN_PRIMVAR_SHARED_MACRO(VtIntArray); break; }
+        default: { UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom FaceVertexIndicesAttr should be (U)LONG or (U)INT."); break; }
         }
+
+        CacheArrayValue(cacheEntry, valueKey, arrayPrimvar, timeCode);
       }
     }
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomNormals(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
-    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
+  void UpdateUsdGeomNormals(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval, UsdBridgePrimCache* cacheEntry)
   {
     using DMI = typename GeomDataType::DataMemberId;
     bool performsUpdate = updateEval.PerformsUpdate(DMI::NORMALS);
     bool timeVaryingUpdate = timeEval.IsTimeVarying(DMI::NORMALS);
 
-    ClearUsdAttributes(uniformGeom.GetNormalsAttr(), timeVarGeom.GetNormalsAttr(), timeVaryingUpdate);
+    const UsdBridgeSettings& settings = writer->Settings;
+    ClearUsdAttributes(GetUsdGeomNormalsAttr(uniformGeom, settings), GetUsdGeomNormalsAttr(timeVarGeom, settings), timeVaryingUpdate);
 
     if (performsUpdate)
     {
       UsdGeomType* outGeom = timeVaryingUpdate ? &timeVarGeom : &uniformGeom;
       UsdTimeCode timeCode = timeEval.Eval(DMI::NORMALS);
 
-      UsdAttribute normalsAttr = outGeom->GetNormalsAttr();
+      UsdAttribute normalsAttr = GetUsdGeomNormalsAttr(*outGeom, settings);
 
       if (geomData.Normals != nullptr)
       {
         const void* arrayData = geomData.Normals;
         size_t arrayNumElements = geomData.PerPrimNormals ? numPrims : geomData.NumPoints;
+        UsdBridgeDataOwner* arrayDataOwner = geomData.NormalsOwner;
         UsdAttribute arrayPrimvar = normalsAttr;
         bool setPrimvar = true;
+        unsigned int numThreads = writer->NumThreads;
 
-        switch (geomData.NormalsType)
+        uint64_t valueKey = GetArrayValueKey(cacheEntry, arrayPrimvar, geomData.NormalsHash, geomData.NormalsType, arrayNumElements);
+        if(!SetCachedArrayValue(cacheEntry, valueKey, arrayPrimvar, timeCode))
         {
-        case UsdBridgeType::FLOAT3: {ASSIGN_PRIMVAR_MACRO(VtVec3fArray); break; }
-        case UsdBridgeType::DOUBLE3: {ASSIGN_PRIMVAR_CONVERT_MACRO(VtVec3fArray, GfVec3d); break; }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom NormalsAttr should be FLOAT3 or DOUBLE3."); break; }
+          switch (geomData.NormalsType)
+          {
+          case UsdBridgeType::FLOAT3: { if(settings.HalfPrecisionOutput) { ASSIGN_PRIMVAR_HALF_MACRO(VtVec3hArray, GfVec3f); } else { ASSIGN_PRIMVAR_SHARED_MACRO(VtVec3fArray); } break; }
+          case UsdBridgeType::DOUBLE3: { if(settings.HalfPrecisionOutput) { ASSIGN_PRIMVAR_HALF_MACRO(VtVec3hArray, GfVec3d); } else { ASSIGN_PRIMVAR_CONVERT_MACRO(VtVec3fArray, GfVec3d); } break; }
+          default: { UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom NormalsAttr should be FLOAT3 or DOUBLE3."); break; }
+          }
+
+          CacheArrayValue(cacheEntry, valueKey, arrayPrimvar, timeCode);
         }
 
         // Per face or per-vertex interpolation. This will break timesteps that have been written before.
         TfToken normalInterpolation = geomData.PerPrimNormals ? UsdGeomTokens->uniform : UsdGeomTokens->vertex;
-        uniformGeom.SetNormalsInterpolation(normalInterpolation);
+        if(settings.HalfPrecisionOutput)
+          UsdGeomPrimvarsAPI(uniformGeom).GetPrimvar(UsdBridgeTokens->normals).SetInterpolation(normalInterpolation);
+        else
+          uniformGeom.SetNormalsInterpolation(normalInterpolation);
       }
       else
       {
@@ -448,6 +781,7 @@ namespace
         size_t arrayNumElements = texCoordAttrib.PerPrimData ? numPrims : geomData.NumPoints;
         UsdAttribute arrayPrimvar = texcoordPrimvar;
         bool setPrimvar = true;
+        unsigned int numThreads = writer->NumThreads;
 
         switch (texCoordAttrib.DataType)
         {
@@ -469,21 +803,22 @@ namespace
 
   template<typename GeomDataType>
   void UpdateUsdGeomAttribute(UsdBridgeUsdWriter* writer, UsdGeomPrimvarsAPI& timeVarPrimvars, UsdGeomPrimvarsAPI& uniformPrimvars, const GeomDataType& geomData, uint64_t numPrims,
-    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval, uint32_t attribIndex)
+    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval, UsdBridgePrimCache* cacheEntry, uint32_t attribIndex)
   {
     assert(attribIndex < geomData.NumAttributes);
     const UsdBridgeAttribute& bridgeAttrib = geomData.Attributes[attribIndex];
 
     TfToken attribToken = bridgeAttrib.Name ? writer->AttributeNameToken(bridgeAttrib.Name) : AttribIndexToToken(attribIndex);
+    UsdBridgeType outputType = GetAttributeOutputType(writer->Settings, bridgeAttrib.DataType);
     UsdGeomPrimvar uniformPrimvar = uniformPrimvars.GetPrimvar(attribToken);
     // The uniform primvar has to exist, otherwise any timevarying data will be ignored as well
-    if(!uniformPrimvar || uniformPrimvar.GetTypeName() != GetPrimvarArrayType(bridgeAttrib.DataType))
+    if(!uniformPrimvar || uniformPrimvar.GetTypeName() != GetPrimvarArrayType(outputType))
     {
       CreateUsdGeomAttributePrimvar(writer, uniformPrimvars, geomData, attribIndex); // No timeEval, to force attribute primvar creation on the uniform api
     }
 
     UsdGeomPrimvar timeVarPrimvar = timeVarPrimvars.GetPrimvar(attribToken);
-    if(!timeVarPrimvar || timeVarPrimvar.GetTypeName() != GetPrimvarArrayType(bridgeAttrib.DataType)) // even though new clipstages initialize the correct primvar type/name, it may still be wrong for existing ones (or primstages if so configured)
+    if(!timeVarPrimvar || timeVarPrimvar.GetTypeName() != GetPrimvarArrayType(outputType)) // even though new clipstages initialize the correct primvar type/name, it may still be wrong for existing ones (or primstages if so configured)
     {
       CreateUsdGeomAttributePrimvar(writer, timeVarPrimvars, geomData, attribIndex, &timeEval);
     }
@@ -493,13 +828,17 @@ namespace
     bool performsUpdate = updateEval.PerformsUpdate(attributeId);
     bool timeVaryingUpdate = timeEval.IsTimeVarying(attributeId);
 
+    bool indexable = writer->Settings.IndexedPrimvars && AttributeIndexingApplies(outputType);
+
     ClearUsdAttributes(uniformPrimvar.GetAttr(), timeVarPrimvar.GetAttr(), timeVaryingUpdate);
+    if(indexable)
+      ClearUsdAttributes(uniformPrimvar.GetIndicesAttr(), timeVarPrimvar.GetIndicesAttr(), timeVaryingUpdate);
 
     if (performsUpdate)
     {
       UsdTimeCode timeCode = timeEval.Eval(attributeId);
 
-      UsdAttribute attributePrimvar = timeVaryingUpdate ? timeVarPrimvar : uniformPrimvar;
+      UsdGeomPrimvar attributePrimvar = timeVaryingUpdate ? timeVarPrimvar : uniformPrimvar;
 
       if(!attributePrimvar)
       {
@@ -513,7 +852,15 @@ namespace
           size_t arrayNumElements = bridgeAttrib.PerPrimData ? numPrims : geomData.NumPoints;
           UsdAttribute arrayPrimvar = attributePrimvar;
 
-          AssignAttribArrayToPrimvar(writer->LogObject, arrayData, bridgeAttrib.DataType, arrayNumElements, arrayPrimvar, timeCode);
+          uint64_t valueKey = GetArrayValueKey(cacheEntry, arrayPrimvar, bridgeAttrib.DataHash, bridgeAttrib.DataType, arrayNumElements);
+          if(!SetCachedPrimvarValue(cacheEntry, valueKey, attributePrimvar, timeCode, indexable))
+          {
+            if(outputType != bridgeAttrib.DataType)
+              AssignHalfArrayToPrimvar(writer->LogObject, arrayData, bridgeAttrib.DataType, arrayNumElements, arrayPrimvar, timeCode, writer->NumThreads, indexable);
+            else
+              AssignAttribArrayToPrimvar(writer->LogObject, arrayData, bridgeAttrib.DataType, arrayNumElements, arrayPrimvar, timeCode, writer->NumThreads, bridgeAttrib.DataOwner, indexable);
+            CachePrimvarValue(cacheEntry, valueKey, attributePrimvar, timeCode, indexable);
+          }
 
           // Per face or per-vertex interpolation. This will break timesteps that have been written before.
           TfToken attribInterpolation = bridgeAttrib.PerPrimData ? UsdGeomTokens->uniform : UsdGeomTokens->vertex;
@@ -521,7 +868,7 @@ namespace
         }
         else
         {
-          attributePrimvar.Set(SdfValueBlock(), timeCode);
+          attributePrimvar.GetAttr().Set(SdfValueBlock(), timeCode);
         }
       }
     }
@@ -529,20 +876,20 @@ namespace
 
   template<typename GeomDataType>
   void UpdateUsdGeomAttributes(UsdBridgeUsdWriter* writer, UsdGeomPrimvarsAPI& timeVarPrimvars, UsdGeomPrimvarsAPI& uniformPrimvars, const GeomDataType& geomData, uint64_t numPrims,
-    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
+    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval, UsdBridgePrimCache* cacheEntry)
   {
     uint32_t startIdx = 0;
     for(uint32_t attribIndex = startIdx; attribIndex < geomData.NumAttributes; ++attribIndex)
     {
       const UsdBridgeAttribute& attrib = geomData.Attributes[attribIndex];
       if(attrib.DataType != UsdBridgeType::UNDEFINED)
-        UpdateUsdGeomAttribute(writer, timeVarPrimvars, uniformPrimvars, geomData, numPrims, updateEval, timeEval, attribIndex);
+        UpdateUsdGeomAttribute(writer, timeVarPrimvars, uniformPrimvars, geomData, numPrims, updateEval, timeEval, cacheEntry, attribIndex);
     }
   }
 
   template<typename GeomDataType>
   void UpdateUsdGeomColors(UsdBridgeUsdWriter* writer, UsdGeomPrimvarsAPI& timeVarPrimvars, UsdGeomPrimvarsAPI& uniformPrimvars, const GeomDataType& geomData, uint64_t numPrims,
-    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
+    UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval, UsdBridgePrimCache* cacheEntry)
   {
     using DMI = typename GeomDataType::DataMemberId;
     bool performsUpdate = updateEval.PerformsUpdate(DMI::COLORS);
@@ -551,7 +898,11 @@ namespace
     UsdGeomPrimvar uniformDispPrimvar = uniformPrimvars.GetPrimvar(UsdBridgeTokens->color);
     UsdGeomPrimvar timeVarDispPrimvar = timeVarPrimvars.GetPrimvar(UsdBridgeTokens->color);
 
+    bool indexable = writer->Settings.IndexedPrimvars;
+
     ClearUsdAttributes(uniformDispPrimvar.GetAttr(), timeVarDispPrimvar.GetAttr(), timeVaryingUpdate);
+    if(indexable)
+      ClearUsdAttributes(uniformDispPrimvar.GetIndicesAttr(), timeVarDispPrimvar.GetIndicesAttr(), timeVaryingUpdate);
 
     if (performsUpdate)
     {
@@ -564,7 +915,15 @@ namespace
         size_t arrayNumElements = geomData.PerPrimColors ? numPrims : geomData.NumPoints;
         assert(colorPrimvar);
 
-        AssignColorArrayToPrimvar(writer->LogObject, geomData.Colors, arrayNumElements, geomData.ColorsType, timeEval.Eval(DMI::COLORS), colorPrimvar.GetAttr());
+        uint64_t valueKey = GetArrayValueKey(cacheEntry, colorPrimvar.GetAttr(), geomData.ColorsHash, geomData.ColorsType, arrayNumElements);
+        if(!SetCachedPrimvarValue(cacheEntry, valueKey, colorPrimvar, timeCode, indexable))
+        {
+          if(writer->Settings.HalfPrecisionOutput)
+            AssignColorArrayToPrimvar<VtVec4hArray>(writer->LogObject, geomData.Colors, arrayNumElements, geomData.ColorsType, timeCode, colorPrimvar.GetAttr(), writer->NumThreads, nullptr, indexable);
+          else
+            AssignColorArrayToPrimvar<VtVec4fArray>(writer->LogObject, geomData.Colors, arrayNumElements, geomData.ColorsType, timeCode, colorPrimvar.GetAttr(), writer->NumThreads, nullptr, indexable);
+          CachePrimvarValue(cacheEntry, valueKey, colorPrimvar, timeCode, indexable);
+        }
 
         // Per face or per-vertex interpolation. This will break timesteps that have been written before.
         TfToken colorInterpolation = geomData.PerPrimColors ? UsdGeomTokens->uniform : UsdGeomTokens->vertex;
@@ -579,7 +938,7 @@ namespace
 
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomInstanceIds(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+  void UpdateUsdGeomInstanceIds(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
   {
     using DMI = typename GeomDataType::DataMemberId;
@@ -601,6 +960,7 @@ namespace
         size_t arrayNumElements = geomData.NumPoints;
         UsdAttribute arrayPrimvar = idsAttr;
         bool setPrimvar = true;
+        unsigned int numThreads = writer->NumThreads;
 
         switch (geomData.InstanceIdsType)
         {
@@ -608,7 +968,7 @@ namespace
         case UsdBridgeType::INT: {ASSIGN_PRIMVAR_CONVERT_MACRO(VtInt64Array, int); break; }
         case UsdBridgeType::LONG: {ASSIGN_PRIMVAR_MACRO(VtInt64Array); break; }
         case UsdBridgeType::ULONG: {ASSIGN_PRIMVAR_MACRO(VtInt64Array); break; }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom IdsAttribute should be (U)LONG or (U)INT."); break; }
+        default: { UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom IdsAttribute should be (U)LONG or (U)INT."); break; }
         }
       }
       else
@@ -619,21 +979,21 @@ namespace
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomWidths(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+  void UpdateUsdGeomWidths(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
   {
     using DMI = typename GeomDataType::DataMemberId;
     bool performsUpdate = updateEval.PerformsUpdate(DMI::SCALES);
     bool timeVaryingUpdate = timeEval.IsTimeVarying(DMI::SCALES);
 
-    ClearUsdAttributes(uniformGeom.GetWidthsAttr(), timeVarGeom.GetWidthsAttr(), timeVaryingUpdate);
+    ClearUsdAttributes(GetUsdGeomWidthsAttr(uniformGeom, writer->Settings), GetUsdGeomWidthsAttr(timeVarGeom, writer->Settings), timeVaryingUpdate);
 
     if (performsUpdate)
     {
       UsdGeomType& outGeom = timeVaryingUpdate ? timeVarGeom : uniformGeom;
       UsdTimeCode timeCode = timeEval.Eval(DMI::SCALES);
 
-      UsdAttribute widthsAttribute = outGeom.GetWidthsAttr();
+      UsdAttribute widthsAttribute = GetUsdGeomWidthsAttr(outGeom, writer->Settings);
       assert(widthsAttribute);
       if (geomData.Scales)
       {
@@ -641,13 +1001,18 @@ namespace
         size_t arrayNumElements = geomData.NumPoints;
         UsdAttribute arrayPrimvar = widthsAttribute;
         bool setPrimvar = false;
+        unsigned int numThreads = writer->NumThreads;
+
+        // With half precision output, the float widths are only an intermediate, which can be kept in the scratch arena
+        VtFloatArray localWidths;
+        VtFloatArray& floatWidths = writer->Settings.HalfPrecisionOutput ? writer->ScratchArena.GetArray<VtFloatArray>() : localWidths;
 
         auto doubleFn = [](VtFloatArray& usdArray) { for(auto& x : usdArray) { x *= 2.0f; } };
         switch (geomData.ScalesType)
         {
-        case UsdBridgeType::FLOAT: {ASSIGN_PRIMVAR_MACRO(VtFloatArray); doubleFn(usdArray); arrayPrimvar.Set(usdArray, timeCode); break; }
-        case UsdBridgeType::DOUBLE: {ASSIGN_PRIMVAR_CONVERT_MACRO(VtFloatArray, double); doubleFn(usdArray); arrayPrimvar.Set(usdArray, timeCode); break; }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom WidthsAttribute should be FLOAT or DOUBLE."); break; }
+        case UsdBridgeType::FLOAT: {ASSIGN_PRIMVAR_CUSTOM_ARRAY_MACRO(VtFloatArray, floatWidths); doubleFn(usdArray); SetUsdGeomWidths(writer, arrayPrimvar, usdArray, timeCode); break; }
+        case UsdBridgeType::DOUBLE: {ASSIGN_PRIMVAR_CONVERT_CUSTOM_ARRAY_MACRO(VtFloatArray, double, floatWidths); doubleFn(usdArray); SetUsdGeomWidths(writer, arrayPrimvar, usdArray, timeCode); break; }
+        default: { UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom WidthsAttribute should be FLOAT or DOUBLE."); break; }
         }
       }
       else
@@ -655,10 +1020,11 @@ namespace
         // Remember that widths define a diameter, so a default width (1.0) corresponds to a scale of 0.5.
         if(geomData.getUniformScale() != 0.5f)
         {
-          VtFloatArray& usdWidths = GetStaticTempArray<VtFloatArray>();
+          VtFloatArray localWidths;
+          VtFloatArray& usdWidths = writer->Settings.HalfPrecisionOutput ? writer->ScratchArena.GetArray<VtFloatArray>() : localWidths;
           usdWidths.resize(geomData.NumPoints);
           for(auto& x : usdWidths) x = geomData.getUniformScale() * 2.0f;
-          widthsAttribute.Set(usdWidths, timeCode);
+          SetUsdGeomWidths(writer, widthsAttribute, usdWidths, timeCode);
         }
         else
         {
@@ -669,7 +1035,7 @@ namespace
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomScales(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+  void UpdateUsdGeomScales(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
   {
     using DMI = typename GeomDataType::DataMemberId;
@@ -691,6 +1057,7 @@ namespace
         size_t arrayNumElements = geomData.NumPoints;
         UsdAttribute arrayPrimvar = scalesAttribute;
         bool setPrimvar = true;
+        unsigned int numThreads = writer->NumThreads;
 
         switch (geomData.ScalesType)
         {
@@ -698,7 +1065,7 @@ namespace
         case UsdBridgeType::DOUBLE: {ASSIGN_PRIMVAR_MACRO_1EXPAND3(VtVec3fArray, double); break;}
         case UsdBridgeType::FLOAT3: {ASSIGN_PRIMVAR_MACRO(VtVec3fArray); break; }
         case UsdBridgeType::DOUBLE3: {ASSIGN_PRIMVAR_CONVERT_MACRO(VtVec3fArray, GfVec3d); break; }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom ScalesAttribute should be FLOAT(3) or DOUBLE(3)."); break; }
+        default: { UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom ScalesAttribute should be FLOAT(3) or DOUBLE(3)."); break; }
         }
       }
       else
@@ -706,7 +1073,7 @@ namespace
         if(!usdbridgenumerics::isIdentity(geomData.Scale))
         {
           GfVec3f defaultScale(geomData.Scale.Data);
-          VtVec3fArray& usdScales = GetStaticTempArray<VtVec3fArray>();
+          VtVec3fArray usdScales;
           usdScales.resize(geomData.NumPoints);
           for(auto& x : usdScales) x = defaultScale;
           scalesAttribute.Set(usdScales, timeCode);
@@ -720,21 +1087,22 @@ namespace
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomOrientNormals(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+  void UpdateUsdGeomOrientNormals(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
   {
     using DMI = typename GeomDataType::DataMemberId;
     bool performsUpdate = updateEval.PerformsUpdate(DMI::ORIENTATIONS);
     bool timeVaryingUpdate = timeEval.IsTimeVarying(DMI::ORIENTATIONS);
 
-    ClearUsdAttributes(uniformGeom.GetNormalsAttr(), timeVarGeom.GetNormalsAttr(), timeVaryingUpdate);
+    const UsdBridgeSettings& settings = writer->Settings;
+    ClearUsdAttributes(GetUsdGeomNormalsAttr(uniformGeom, settings), GetUsdGeomNormalsAttr(timeVarGeom, settings), timeVaryingUpdate);
 
     if (performsUpdate)
     {
       UsdGeomType& outGeom = timeVaryingUpdate ? timeVarGeom : uniformGeom;
       UsdTimeCode timeCode = timeEval.Eval(DMI::ORIENTATIONS);
 
-      UsdAttribute normalsAttribute = outGeom.GetNormalsAttr();
+      UsdAttribute normalsAttribute = GetUsdGeomNormalsAttr(outGeom, settings);
       assert(normalsAttribute);
       if (geomData.Orientations)
       {
@@ -742,18 +1110,19 @@ namespace
         size_t arrayNumElements = geomData.NumPoints;
         UsdAttribute arrayPrimvar = normalsAttribute;
         bool setPrimvar = true;
+        unsigned int numThreads = writer->NumThreads;
 
         switch (geomData.OrientationsType)
         {
-        case UsdBridgeType::FLOAT3: {ASSIGN_PRIMVAR_MACRO(VtVec3fArray); break; }
-        case UsdBridgeType::DOUBLE3: {ASSIGN_PRIMVAR_CONVERT_MACRO(VtVec3fArray, GfVec3d); break; }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom NormalsAttribute (orientations) should be FLOAT3 or DOUBLE3."); break; }
+        case UsdBridgeType::FLOAT3: { if(settings.HalfPrecisionOutput) { ASSIGN_PRIMVAR_HALF_MACRO(VtVec3hArray, GfVec3f); } else { ASSIGN_PRIMVAR_MACRO(VtVec3fArray); } break; }
+        case UsdBridgeType::DOUBLE3: { if(settings.HalfPrecisionOutput) { ASSIGN_PRIMVAR_HALF_MACRO(VtVec3hArray, GfVec3d); } else { ASSIGN_PRIMVAR_CONVERT_MACRO(VtVec3fArray, GfVec3d); } break; }
+        default: { UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom NormalsAttribute (orientations) should be FLOAT3 or DOUBLE3."); break; }
         }
       }
       else
       {
         //GfVec3f defaultNormal(1, 0, 0);
-        //VtVec3fArray& usdNormals = GetStaticTempArray<VtVec3fArray>();
+        //VtVec3fArray usdNormals;
         //usdNormals.resize(geomData.NumPoints);
         //for(auto& x : usdNormals) x = defaultNormal;
         //normalsAttribute.Set(usdNormals, timeCode);
@@ -763,7 +1132,7 @@ namespace
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomOrientations(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+  void UpdateUsdGeomOrientations(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
   {
     using DMI = typename GeomDataType::DataMemberId;
@@ -780,14 +1149,14 @@ namespace
       // Orientations
       UsdAttribute orientationsAttribute = outGeom.GetOrientationsAttr();
       assert(orientationsAttribute);
-      VtQuathArray& usdOrients = GetStaticTempArray<VtQuathArray>();
+      VtQuathArray usdOrients;
       if (geomData.Orientations)
       {
         usdOrients.resize(geomData.NumPoints);
         switch (geomData.OrientationsType)
         {
-        case UsdBridgeType::FLOAT3: { ConvertNormalsToQuaternions<float>(usdOrients, geomData.Orientations, geomData.NumPoints); break; }
-        case UsdBridgeType::DOUBLE3: { ConvertNormalsToQuaternions<double>(usdOrients, geomData.Orientations, geomData.NumPoints); break; }
+        case UsdBridgeType::FLOAT3: { ConvertNormalsToQuaternions<float>(usdOrients, geomData.Orientations, geomData.NumPoints, writer->NumThreads); break; }
+        case UsdBridgeType::DOUBLE3: { ConvertNormalsToQuaternions<double>(usdOrients, geomData.Orientations, geomData.NumPoints, writer->NumThreads); break; }
         case UsdBridgeType::FLOAT4:
           {
             // Note that ANARI quaternion arrays are in IJKW order
@@ -799,7 +1168,7 @@ namespace
             orientationsAttribute.Set(usdOrients, timeCode);
             break;
           }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom OrientationsAttribute should be FLOAT3, DOUBLE3 or FLOAT4."); break; }
+        default: { UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom OrientationsAttribute should be FLOAT3, DOUBLE3 or FLOAT4."); break; }
         }
         orientationsAttribute.Set(usdOrients, timeCode);
       }
@@ -822,7 +1191,7 @@ namespace
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomProtoIndices(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+  void UpdateUsdGeomProtoIndices(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
   {
     using DMI = typename GeomDataType::DataMemberId;
@@ -849,12 +1218,12 @@ namespace
         switch (geomData.OrientationsType)
         {
         case UsdBridgeType::INT: {ASSIGN_PRIMVAR_MACRO(VtIntArray); break; }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom ProtoIndicesAttr (ShapeIndices) should be INT."); break; }
+        default: { UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom ProtoIndicesAttr (ShapeIndices) should be INT."); break; }
         }
       }
       else
       {
-        VtIntArray& protoIndices = GetStaticTempArray<VtIntArray>();
+        VtIntArray protoIndices;
         protoIndices.resize(geomData.NumPoints);
         for(auto& x : protoIndices) x = 0;
         protoIndexAttr.Set(protoIndices, timeCode);
@@ -863,7 +1232,7 @@ namespace
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomLinearVelocities(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+  void UpdateUsdGeomLinearVelocities(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
   {
     using DMI = typename GeomDataType::DataMemberId;
@@ -884,7 +1253,7 @@ namespace
       {
         GfVec3f* linVels = (GfVec3f*)geomData.LinearVelocities;
 
-        VtVec3fArray& usdVelocities = GetStaticTempArray<VtVec3fArray>();
+        VtVec3fArray usdVelocities;
         usdVelocities.assign(linVels, linVels + geomData.NumPoints);
         linearVelocitiesAttribute.Set(usdVelocities, timeCode);
       }
@@ -896,7 +1265,7 @@ namespace
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomAngularVelocities(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+  void UpdateUsdGeomAngularVelocities(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
   {
     using DMI = typename GeomDataType::DataMemberId;
@@ -917,7 +1286,7 @@ namespace
       {
         GfVec3f* angVels = (GfVec3f*)geomData.AngularVelocities;
 
-        VtVec3fArray& usdAngularVelocities = GetStaticTempArray<VtVec3fArray>();
+        VtVec3fArray usdAngularVelocities;
         usdAngularVelocities.assign(angVels, angVels + geomData.NumPoints);
         angularVelocitiesAttribute.Set(usdAngularVelocities, timeCode);
       }
@@ -929,7 +1298,7 @@ namespace
   }
 
   template<typename UsdGeomType, typename GeomDataType>
-  void UpdateUsdGeomInvisibleIds(const UsdBridgeLogObject& logObj, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
+  void UpdateUsdGeomInvisibleIds(UsdBridgeUsdWriter* writer, UsdGeomType& timeVarGeom, UsdGeomType& uniformGeom, const GeomDataType& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const GeomDataType>& updateEval, TimeEvaluator<GeomDataType>& timeEval)
   {
     using DMI = typename GeomDataType::DataMemberId;
@@ -953,6 +1322,7 @@ namespace
         size_t arrayNumElements = numInvisibleIds;
         UsdAttribute arrayPrimvar = invisIdsAttr;
         bool setPrimvar = true;
+        unsigned int numThreads = writer->NumThreads;
 
         switch (geomData.InvisibleIdsType)
         {
@@ -960,7 +1330,7 @@ namespace
         case UsdBridgeType::INT: {ASSIGN_PRIMVAR_CONVERT_MACRO(VtInt64Array, int); break; }
         case UsdBridgeType::LONG: {ASSIGN_PRIMVAR_MACRO(VtInt64Array); break; }
         case UsdBridgeType::ULONG: {ASSIGN_PRIMVAR_MACRO(VtInt64Array); break; }
-        default: { UsdBridgeLogMacro(logObj, UsdBridgeLogLevel::ERR, "UsdGeom GetInvisibleIdsAttr should be (U)LONG or (U)INT."); break; }
+        default: { UsdBridgeLogMacro(writer->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom GetInvisibleIdsAttr should be (U)LONG or (U)INT."); break; }
         }
       }
       else
@@ -970,7 +1340,7 @@ namespace
     }
   }
 
-  static void UpdateUsdGeomCurveLengths(const UsdBridgeLogObject& logObj, UsdGeomBasisCurves& timeVarGeom, UsdGeomBasisCurves& uniformGeom, const UsdBridgeCurveData& geomData, uint64_t numPrims,
+  static void UpdateUsdGeomCurveLengths(UsdBridgeUsdWriter* writer, UsdGeomBasisCurves& timeVarGeom, UsdGeomBasisCurves& uniformGeom, const UsdBridgeCurveData& geomData, uint64_t numPrims,
     UsdBridgeUpdateEvaluator<const UsdBridgeCurveData>& updateEval, TimeEvaluator<UsdBridgeCurveData>& timeEval)
   {
     using DMI = typename UsdBridgeCurveData::DataMemberId;
@@ -1065,96 +1435,1254 @@ namespace
       protoRel.AddTarget(shapePath);
     }
   }
-}
-
-UsdPrim UsdBridgeUsdWriter::InitializeUsdGeometry(UsdStageRefPtr geometryStage, const SdfPath& geomPath, const UsdBridgeMeshData& meshData, bool uniformPrim)
-{
-  return InitializeUsdGeometry_Impl(this, geometryStage, geomPath, meshData, uniformPrim, Settings);
-}
 
-UsdPrim UsdBridgeUsdWriter::InitializeUsdGeometry(UsdStageRefPtr geometryStage, const SdfPath& geomPath, const UsdBridgeInstancerData& instancerData, bool uniformPrim)
-{
-  return InitializeUsdGeometry_Impl(this, geometryStage, geomPath, instancerData, uniformPrim, Settings);
-}
+  // Meshes with more points or indices than a signed 32-bit int can address are split into parts of at most MeshPartMaxIndices indices
+  constexpr uint64_t MeshMaxElements = static_cast<uint64_t>(std::numeric_limits<int>::max());
+  constexpr uint64_t MeshPartMaxIndices = uint64_t(1) << 24;
 
-UsdPrim UsdBridgeUsdWriter::InitializeUsdGeometry(UsdStageRefPtr geometryStage, const SdfPath& geomPath, const UsdBridgeCurveData& curveData, bool uniformPrim)
-{
-  return InitializeUsdGeometry_Impl(this, geometryStage, geomPath, curveData, uniformPrim, Settings);
-}
+  bool MeshRequiresParts(const UsdBridgeMeshData& geomData)
+  {
+    return geomData.NumPoints > MeshMaxElements || geomData.NumIndices > MeshMaxElements;
+  }
 
-#ifdef VALUE_CLIP_RETIMING
-void UsdBridgeUsdWriter::UpdateUsdGeometryManifest(const UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& meshData)
-{
-  TimeEvaluator<UsdBridgeMeshData> timeEval(meshData);
-  InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, cacheEntry->PrimPath, meshData, false,
-    Settings, &timeEval);
+  // Element size in bytes of the bridge types up until DOUBLE4, 0 otherwise
+  size_t GetElementSize(UsdBridgeType dataType)
+  {
+    constexpr size_t fundamentalSizes[] = {1, 1, 1, 2, 2, 4, 4, 8, 8, 2, 4, 8}; // UCHAR up until DOUBLE
+    constexpr int groupSize = UsdBridgeNumFundamentalTypes - 1; // Multi-component groups have no BOOL
+    int typeIdent = static_cast<int>(dataType);
+    if(dataType == UsdBridgeType::BOOL)
+      return 1;
+    if(typeIdent < 0 || typeIdent > static_cast<int>(UsdBridgeType::DOUBLE4))
+      return 0;
+    int groupIdent = typeIdent - 1;
+    return fundamentalSizes[groupIdent % groupSize] * (groupIdent / groupSize + 1);
+  }
 
-  if(this->EnableSaving)
-    cacheEntry->ManifestStage.second->Save();
-}
+  struct UsdBridgeMeshPartition
+  {
+    uint64_t FaceBegin = 0;
+    uint64_t NumFaces = 0;
+    UsdBridgeDataHash TopologyHash; // Identifies the source indices, from which the content of the part follows
+
+    std::vector<uint64_t> Faces; // Source faces of the part if not the range starting at FaceBegin, eg. for levels of detail
+    std::vector<uint64_t> SourceIndices; // Source indices of the part's faces
+    std::vector<uint64_t> Vertices; // Sorted source indices of the vertices referenced by the part
+    std::vector<int> Indices; // SourceIndices rebased into Vertices
+    bool HasInvalidIndices = false;
+
+    std::vector<char> Points;
+    std::vector<char> Normals;
+    std::vector<char> Colors;
+    std::vector<std::vector<char>> AttributeArrays;
+    std::vector<UsdBridgeAttribute> Attributes;
+
+    UsdBridgeDerivedDataHash PointsHash;
+    UsdBridgeDerivedDataHash NormalsHash;
+    UsdBridgeDerivedDataHash ColorsHash;
+    UsdBridgeDerivedDataHash IndicesHash;
+    std::vector<UsdBridgeDerivedDataHash> AttributeHashes;
+
+    UsdBridgeMeshData PartData;
+  };
+
+  template<typename IndexType>
+  void ReadMeshIndices(const void* indices, uint64_t indexBegin, uint64_t numIndices, uint64_t* output)
+  {
+    const IndexType* typedIndices = reinterpret_cast<const IndexType*>(indices) + indexBegin;
+    for(uint64_t i = 0; i < numIndices; ++i)
+      output[i] = static_cast<uint64_t>(typedIndices[i]); // Negative indices wrap around to out of range values
+  }
 
-void UsdBridgeUsdWriter::UpdateUsdGeometryManifest(const UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& instancerData)
-{
-  TimeEvaluator<UsdBridgeInstancerData> timeEval(instancerData);
-  InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, cacheEntry->PrimPath, instancerData, false,
-    Settings, &timeEval);
+  template<size_t fixedEltSize>
+  void GatherElements(const void* source, size_t eltSize, const uint64_t* elementIds, size_t numElements, std::vector<char>& dest)
+  {
+    const size_t copySize = fixedEltSize ? fixedEltSize : eltSize; // Fixed sizes turn the memcpy into plain moves
+    const char* srcBytes = reinterpret_cast<const char*>(source);
+    dest.resize(numElements*copySize);
+    char* dstBytes = dest.data();
+    for(size_t i = 0; i < numElements; ++i)
+      memcpy(dstBytes + i*copySize, srcBytes + elementIds[i]*copySize, copySize);
+  }
 
-  if(this->EnableSaving)
-    cacheEntry->ManifestStage.second->Save();
-}
+  // Copies the elements of source at elementIds into dest, returns dest's data (or null if source is null or eltSize is 0)
+  const void* GatherElements(const void* source, size_t eltSize, const uint64_t* elementIds, size_t numElements, std::vector<char>& dest)
+  {
+    if(!source || !eltSize)
+      return nullptr;
+    switch (eltSize)
+    {
+      case 4: GatherElements<4>(source, eltSize, elementIds, numElements, dest); break;
+      case 8: GatherElements<8>(source, eltSize, elementIds, numElements, dest); break;
+      case 12: GatherElements<12>(source, eltSize, elementIds, numElements, dest); break;
+      case 16: GatherElements<16>(source, eltSize, elementIds, numElements, dest); break;
+      case 24: GatherElements<24>(source, eltSize, elementIds, numElements, dest); break;
+      case 32: GatherElements<32>(source, eltSize, elementIds, numElements, dest); break;
+      default: GatherElements<0>(source, eltSize, elementIds, numElements, dest); break;
+    }
+    return dest.data();
+  }
 
-void UsdBridgeUsdWriter::UpdateUsdGeometryManifest(const UsdBridgePrimCache* cacheEntry, const UsdBridgeCurveData& curveData)
-{
-  TimeEvaluator<UsdBridgeCurveData> timeEval(curveData);
-  InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, cacheEntry->PrimPath, curveData, false,
-    Settings, &timeEval);
+  // Returns the part's range of per-face data (or its faces gathered into storage), or the part's vertices gathered from per-vertex data into storage
+  const void* GetMeshPartArray(const void* data, size_t eltSize, bool perPrimData, const UsdBridgeMeshPartition& part, std::vector<char>& storage)
+  {
+    if(!data || !eltSize)
+      return nullptr;
+    if(perPrimData)
+    {
+      if(!part.Faces.empty())
+        return GatherElements(data, eltSize, part.Faces.data(), part.Faces.size(), storage);
+      return reinterpret_cast<const char*>(data) + part.FaceBegin*eltSize;
+    }
+    return GatherElements(data, eltSize, part.Vertices.data(), part.Vertices.size(), storage);
+  }
 
-  if(this->EnableSaving)
-    cacheEntry->ManifestStage.second->Save();
-}
-#endif
 
-#define UPDATE_USDGEOM_ARRAYS(FuncDef) \
-  FuncDef(this->LogObject, timeVarGeom, uniformGeom, geomData, numPrims, updateEval, timeEval)
+  // Reads the source indices of the part's range of faces, replacing the ones out of range of the points by 0.
+  // Index types are expected to have been validated.
+  void ReadMeshPartIndices(const UsdBridgeMeshData& geomData, UsdBridgeMeshPartition& part)
+  {
+    uint64_t faceVertexCount = static_cast<uint64_t>(geomData.FaceVertexCount);
+    uint64_t indexBegin = part.FaceBegin*faceVertexCount;
+    uint64_t numIndices = part.NumFaces*faceVertexCount;
 
-#define UPDATE_USDGEOM_PRIMVAR_ARRAYS(FuncDef) \
-  FuncDef(this, timeVarPrimvars, uniformPrimvars, geomData, numPrims, updateEval, timeEval)
+    std::vector<uint64_t>& sourceIndices = part.SourceIndices;
+    sourceIndices.resize(numIndices);
+    switch (geomData.Indices ? geomData.IndicesType : UsdBridgeType::UNDEFINED)
+    {
+      case UsdBridgeType::INT: ReadMeshIndices<int32_t>(geomData.Indices, indexBegin, numIndices, sourceIndices.data()); break;
+      case UsdBridgeType::UINT: ReadMeshIndices<uint32_t>(geomData.Indices, indexBegin, numIndices, sourceIndices.data()); break;
+      case UsdBridgeType::LONG: ReadMeshIndices<int64_t>(geomData.Indices, indexBegin, numIndices, sourceIndices.data()); break;
+      case UsdBridgeType::ULONG: ReadMeshIndices<uint64_t>(geomData.Indices, indexBegin, numIndices, sourceIndices.data()); break;
+      default: std::iota(sourceIndices.begin(), sourceIndices.end(), indexBegin); break;
+    }
 
-void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, const SdfPath& meshPath, const UsdBridgeMeshData& geomData, double timeStep)
-{
-  // To avoid data duplication when using of clip stages, we need to potentially use the scenestage prim for time-uniform data.
-  UsdGeomMesh uniformGeom = UsdGeomMesh::Get(this->SceneStage, meshPath);
-  assert(uniformGeom);
-  UsdGeomPrimvarsAPI uniformPrimvars(uniformGeom);
+    part.HasInvalidIndices = false;
+    for(uint64_t& sourceIdx : sourceIndices)
+    {
+      if(sourceIdx >= geomData.NumPoints)
+      {
+        sourceIdx = 0;
+        part.HasInvalidIndices = true;
+      }
+    }
+  }
 
-  UsdGeomMesh timeVarGeom = UsdGeomMesh::Get(timeVarStage, meshPath);
-  assert(timeVarGeom);
-  UsdGeomPrimvarsAPI timeVarPrimvars(timeVarGeom);
+  // Collects the vertices referenced by the part's source indices and derives its mesh data, with 32-bit indices rebased to the collected vertices.
+  // Per-face data is taken from the part's Faces if set, otherwise from its range of faces.
+  void AssembleMeshPartition(const UsdBridgeMeshData& geomData, UsdBridgeMeshPartition& part)
+  {
+    const std::vector<uint64_t>& sourceIndices = part.SourceIndices;
+    uint64_t numIndices = sourceIndices.size();
+
+    std::vector<uint64_t>& vertices = part.Vertices;
+    vertices.assign(sourceIndices.begin(), sourceIndices.end());
+    std::sort(vertices.begin(), vertices.end());
+    vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+    part.Indices.resize(numIndices);
+    for(uint64_t i = 0; i < numIndices; ++i)
+      part.Indices[i] = static_cast<int>(std::lower_bound(vertices.begin(), vertices.end(), sourceIndices[i]) - vertices.begin());
+
+    UsdBridgeMeshData& partData = part.PartData;
+    partData = geomData;
+    partData.NumPoints = vertices.size();
+
+    uint64_t faceSelection = ubutils::HashCombine(ubutils::HashCombine(ubutils::HashCombine(
+      static_cast<uint64_t>(geomData.IndicesType), geomData.NumIndices), part.FaceBegin), part.NumFaces);
+
+    partData.Points = GetMeshPartArray(geomData.Points, GetElementSize(geomData.PointsType), false, part, part.Points);
+    partData.PointsOwner = nullptr;
+    partData.PointsHash = part.PointsHash.Init(geomData.PointsHash, part.TopologyHash, faceSelection);
+    partData.Normals = GetMeshPartArray(geomData.Normals, GetElementSize(geomData.NormalsType), geomData.PerPrimNormals, part, part.Normals);
+    partData.NormalsOwner = nullptr;
+    partData.NormalsHash = part.NormalsHash.Init(geomData.NormalsHash, part.TopologyHash, faceSelection);
+    partData.Colors = GetMeshPartArray(geomData.Colors, GetElementSize(geomData.ColorsType), geomData.PerPrimColors, part, part.Colors);
+    partData.ColorsHash = part.ColorsHash.Init(geomData.ColorsHash, part.TopologyHash, faceSelection);
+
+    part.AttributeArrays.resize(geomData.NumAttributes);
+    part.AttributeHashes.resize(geomData.NumAttributes);
+    part.Attributes.assign(geomData.Attributes, geomData.Attributes + geomData.NumAttributes);
+    for(uint32_t attribIdx = 0; attribIdx < geomData.NumAttributes; ++attribIdx)
+    {
+      UsdBridgeAttribute& attrib = part.Attributes[attribIdx];
+      size_t eltSize = attrib.EltSize ? attrib.EltSize : GetElementSize(attrib.DataType);
+      attrib.Data = GetMeshPartArray(attrib.Data, eltSize, attrib.PerPrimData, part, part.AttributeArrays[attribIdx]);
+      attrib.DataOwner = nullptr;
+      attrib.DataHash = part.AttributeHashes[attribIdx].Init(attrib.DataHash, part.TopologyHash, faceSelection);
+    }
+    partData.Attributes = part.Attributes.data();
 
-  // Update the mesh
-  UsdBridgeUpdateEvaluator<const UsdBridgeMeshData> updateEval(geomData);
-  TimeEvaluator<UsdBridgeMeshData> timeEval(geomData, timeStep);
+    partData.Indices = part.Indices.data();
+    partData.IndicesType = UsdBridgeType::INT;
+    partData.IndicesOwner = nullptr;
+    partData.IndicesHash = part.IndicesHash.Init(part.TopologyHash, part.TopologyHash, faceSelection);
+    partData.NumIndices = numIndices;
+  }
 
-  assert((geomData.NumIndices % geomData.FaceVertexCount) == 0);
-  uint64_t numPrims = int(geomData.NumIndices) / geomData.FaceVertexCount;
+  // Builds the part for its range of faces. Safe to run concurrently for different parts.
+  void BuildMeshPartition(const UsdBridgeMeshData& geomData, UsdBridgeMeshPartition& part)
+  {
+    ReadMeshPartIndices(geomData, part);
+    AssembleMeshPartition(geomData, part);
+  }
 
-  UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomPoints);
-  UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomNormals);
-  if( Settings.EnableStTexCoords && UsdGeomDataHasTexCoords(geomData) )
-    { UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomTexCoords); }
-  UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomAttributes);
-  UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomColors);
-  UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomIndices);
-}
+  struct UsdBridgeInstancerTile
+  {
+    uint64_t PointBegin = 0; // Range of the tile's points within the sorted order
+    uint64_t NumPoints = 0;
+    UsdBridgeDataHash OrderHash; // Identifies the sorted order, from which the content of the tile follows
+
+    std::vector<char> Points;
+    std::vector<char> ShapeIndices;
+    std::vector<char> Scales;
+    std::vector<char> Orientations;
+    std::vector<char> Colors;
+    std::vector<char> LinearVelocities;
+    std::vector<char> AngularVelocities;
+    std::vector<char> InstanceIds;
+    std::vector<std::vector<char>> AttributeArrays;
+    std::vector<UsdBridgeAttribute> Attributes;
+
+    UsdBridgeDerivedDataHash PointsHash;
+    UsdBridgeDerivedDataHash ColorsHash;
+    std::vector<UsdBridgeDerivedDataHash> AttributeHashes;
+
+    UsdBridgeInstancerData TileData;
+  };
+
+  // Gathers all per-point data of the tile's range of sortedPoints. Safe to run concurrently for different tiles.
+  void BuildInstancerTile(const UsdBridgeInstancerData& geomData, const std::vector<uint64_t>& sortedPoints, UsdBridgeInstancerTile& tile)
+  {
+    const uint64_t* tilePoints = sortedPoints.data() + tile.PointBegin;
+    size_t numTilePoints = static_cast<size_t>(tile.NumPoints);
+
+    UsdBridgeInstancerData& tileData = tile.TileData;
+    tileData = geomData;
+    tileData.NumPoints = numTilePoints;
+    tileData.MaxPointsPerTile = 0;
+
+    uint64_t pointSelection = ubutils::HashCombine(ubutils::HashCombine(ubutils::HashCombine(
+      static_cast<uint64_t>(geomData.PointsType), geomData.NumPoints), tile.PointBegin), tile.NumPoints);
+
+    tileData.Points = GatherElements(geomData.Points, GetElementSize(geomData.PointsType), tilePoints, numTilePoints, tile.Points);
+    tileData.PointsOwner = nullptr;
+    tileData.PointsHash = tile.PointsHash.Init(geomData.PointsHash, tile.OrderHash, pointSelection);
+    tileData.ShapeIndices = reinterpret_cast<const int*>(GatherElements(geomData.ShapeIndices, sizeof(int), tilePoints, numTilePoints, tile.ShapeIndices));
+    tileData.Scales = GatherElements(geomData.Scales, GetElementSize(geomData.ScalesType), tilePoints, numTilePoints, tile.Scales);
+    tileData.Orientations = GatherElements(geomData.Orientations, GetElementSize(geomData.OrientationsType), tilePoints, numTilePoints, tile.Orientations);
+    tileData.Colors = GatherElements(geomData.Colors, GetElementSize(geomData.ColorsType), tilePoints, numTilePoints, tile.Colors);
+    tileData.ColorsHash = tile.ColorsHash.Init(geomData.ColorsHash, tile.OrderHash, pointSelection);
+    tileData.LinearVelocities = reinterpret_cast<const float*>(GatherElements(geomData.LinearVelocities, 3*sizeof(float), tilePoints, numTilePoints, tile.LinearVelocities));
+    tileData.AngularVelocities = reinterpret_cast<const float*>(GatherElements(geomData.AngularVelocities, 3*sizeof(float), tilePoints, numTilePoints, tile.AngularVelocities));
+
+    if(geomData.InstanceIds)
+    {
+      tileData.InstanceIds = GatherElements(geomData.InstanceIds, GetElementSize(geomData.InstanceIdsType), tilePoints, numTilePoints, tile.InstanceIds);
+    }
+    else if(geomData.NumInvisibleIds)
+    {
+      // Without ids, invisible ids refer to point indices, so the points keep their source index as id
+      tile.InstanceIds.resize(numTilePoints*sizeof(int64_t));
+      int64_t* tileIds = reinterpret_cast<int64_t*>(tile.InstanceIds.data());
+      for(size_t i = 0; i < numTilePoints; ++i)
+        tileIds[i] = static_cast<int64_t>(tilePoints[i]);
+      tileData.InstanceIds = tileIds;
+      tileData.InstanceIdsType = UsdBridgeType::LONG;
+    }
 
-void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, const SdfPath& instancerPath, const UsdBridgeInstancerData& geomData, double timeStep)
-{
-  UsdBridgeUpdateEvaluator<const UsdBridgeInstancerData> updateEval(geomData);
-  TimeEvaluator<UsdBridgeInstancerData> timeEval(geomData, timeStep);
+    tile.AttributeArrays.resize(geomData.NumAttributes);
+    tile.AttributeHashes.resize(geomData.NumAttributes);
+    tile.Attributes.assign(geomData.Attributes, geomData.Attributes + geomData.NumAttributes);
+    for(uint32_t attribIdx = 0; attribIdx < geomData.NumAttributes; ++attribIdx)
+    {
+      UsdBridgeAttribute& attrib = tile.Attributes[attribIdx];
+      size_t eltSize = attrib.EltSize ? attrib.EltSize : GetElementSize(attrib.DataType);
+      attrib.Data = GatherElements(attrib.Data, eltSize, tilePoints, numTilePoints, tile.AttributeArrays[attribIdx]); // Instancer data is per point either way
+      attrib.DataOwner = nullptr;
+      attrib.DataHash = tile.AttributeHashes[attribIdx].Init(attrib.DataHash, tile.OrderHash, pointSelection);
+    }
+    tileData.Attributes = tile.Attributes.data();
+  }
 
-  bool useGeomPoints = geomData.UseUsdGeomPoints;
+  // Blocks an array of geometry whose data is held by its parts, at the uniform or timevarying prim like a regular update would write it
+  template<typename GeomDataType>
+  void BlockUsdGeomAttribute(TimeEvaluator<GeomDataType>& timeEval, UsdBridgePrimCache* cacheEntry, typename GeomDataType::DataMemberId dataMemberId,
+    const UsdAttribute& uniformAttrib, const UsdAttribute& timeVarAttrib)
+  {
+    bool timeVaryingUpdate = timeEval.IsTimeVarying(dataMemberId);
+    ClearUsdAttributes(uniformAttrib, timeVarAttrib, timeVaryingUpdate);
 
-  uint64_t numPrims = geomData.NumPoints;
+    const UsdAttribute& outAttrib = timeVaryingUpdate ? timeVarAttrib : uniformAttrib;
+    if(outAttrib)
+    {
+      UsdTimeCode timeCode = timeEval.Eval(dataMemberId);
+      PreserveHeldArrayValues(cacheEntry, outAttrib, timeCode);
+      outAttrib.Set(SdfValueBlock(), timeCode);
+    }
+  }
+
+  template<typename GeomDataType>
+  void BlockUsdGeomPrimvars(UsdBridgeUsdWriter* writer, UsdGeomPrimvarsAPI timeVarPrimvars, UsdGeomPrimvarsAPI uniformPrimvars, const GeomDataType& geomData,
+    TimeEvaluator<GeomDataType>& timeEval, UsdBridgePrimCache* cacheEntry)
+  {
+    using DMI = typename GeomDataType::DataMemberId;
+
+    auto blockPrimvar = [&](DMI dataMemberId, const TfToken& primvarName)
+    {
+      BlockUsdGeomAttribute(timeEval, cacheEntry, dataMemberId, uniformPrimvars.GetPrimvar(primvarName).GetAttr(), timeVarPrimvars.GetPrimvar(primvarName).GetAttr());
+    };
+
+    blockPrimvar(DMI::COLORS, UsdBridgeTokens->color);
+    blockPrimvar(DMI::ATTRIBUTE0, UsdBridgeTokens->st);
+    for(uint32_t attribIndex = 0; attribIndex < geomData.NumAttributes; ++attribIndex)
+    {
+      const UsdBridgeAttribute& bridgeAttrib = geomData.Attributes[attribIndex];
+      TfToken attribToken = bridgeAttrib.Name ? writer->AttributeNameToken(bridgeAttrib.Name) : AttribIndexToToken(attribIndex);
+      blockPrimvar(DMI::ATTRIBUTE0 + attribIndex, attribToken);
+    }
+  }
+
+  void BlockUsdGeomArrays(UsdBridgeUsdWriter* writer, UsdGeomMesh& timeVarGeom, UsdGeomMesh& uniformGeom, const UsdBridgeMeshData& geomData,
+    TimeEvaluator<UsdBridgeMeshData>& timeEval, UsdBridgePrimCache* cacheEntry)
+  {
+    using DMI = UsdBridgeMeshData::DataMemberId;
+
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::POINTS, uniformGeom.GetPointsAttr(), timeVarGeom.GetPointsAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::POINTS, uniformGeom.GetExtentAttr(), timeVarGeom.GetExtentAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::NORMALS, GetUsdGeomNormalsAttr(uniformGeom, writer->Settings), GetUsdGeomNormalsAttr(timeVarGeom, writer->Settings));
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::INDICES, uniformGeom.GetFaceVertexCountsAttr(), timeVarGeom.GetFaceVertexCountsAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::INDICES, uniformGeom.GetFaceVertexIndicesAttr(), timeVarGeom.GetFaceVertexIndicesAttr());
+    BlockUsdGeomPrimvars(writer, UsdGeomPrimvarsAPI(timeVarGeom), UsdGeomPrimvarsAPI(uniformGeom), geomData, timeEval, cacheEntry);
+  }
+
+  void BlockUsdGeomArrays(UsdBridgeUsdWriter* writer, UsdGeomPoints& timeVarGeom, UsdGeomPoints& uniformGeom, const UsdBridgeInstancerData& geomData,
+    TimeEvaluator<UsdBridgeInstancerData>& timeEval, UsdBridgePrimCache* cacheEntry)
+  {
+    using DMI = UsdBridgeInstancerData::DataMemberId;
+
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::POINTS, uniformGeom.GetPointsAttr(), timeVarGeom.GetPointsAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::POINTS, uniformGeom.GetExtentAttr(), timeVarGeom.GetExtentAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::INSTANCEIDS, uniformGeom.GetIdsAttr(), timeVarGeom.GetIdsAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::SCALES, GetUsdGeomWidthsAttr(uniformGeom, writer->Settings), GetUsdGeomWidthsAttr(timeVarGeom, writer->Settings));
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::ORIENTATIONS, GetUsdGeomNormalsAttr(uniformGeom, writer->Settings), GetUsdGeomNormalsAttr(timeVarGeom, writer->Settings));
+    BlockUsdGeomPrimvars(writer, UsdGeomPrimvarsAPI(timeVarGeom), UsdGeomPrimvarsAPI(uniformGeom), geomData, timeEval, cacheEntry);
+  }
+
+  void BlockUsdGeomArrays(UsdBridgeUsdWriter* writer, UsdGeomPointInstancer& timeVarGeom, UsdGeomPointInstancer& uniformGeom, const UsdBridgeInstancerData& geomData,
+    TimeEvaluator<UsdBridgeInstancerData>& timeEval, UsdBridgePrimCache* cacheEntry)
+  {
+    using DMI = UsdBridgeInstancerData::DataMemberId;
+
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::POINTS, uniformGeom.GetPositionsAttr(), timeVarGeom.GetPositionsAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::POINTS, uniformGeom.GetExtentAttr(), timeVarGeom.GetExtentAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::INSTANCEIDS, uniformGeom.GetIdsAttr(), timeVarGeom.GetIdsAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::SCALES, uniformGeom.GetScalesAttr(), timeVarGeom.GetScalesAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::ORIENTATIONS, uniformGeom.GetOrientationsAttr(), timeVarGeom.GetOrientationsAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::SHAPEINDICES, uniformGeom.GetProtoIndicesAttr(), timeVarGeom.GetProtoIndicesAttr());
+    BlockUsdGeomAttribute(timeEval, cacheEntry, DMI::INVISIBLEIDS, uniformGeom.GetInvisibleIdsAttr(), timeVarGeom.GetInvisibleIdsAttr());
+    BlockUsdGeomPrimvars(writer, UsdGeomPrimvarsAPI(timeVarGeom), UsdGeomPrimvarsAPI(uniformGeom), geomData, timeEval, cacheEntry);
+  }
+
+  // Tiles hold the prototypes of the instancer they partition
+  void CopyUsdInstancerPrototypes(const UsdGeomPointInstancer& sourceGeom, const UsdGeomPointInstancer& destGeom)
+  {
+    SdfPathVector protoPaths;
+    sourceGeom.GetPrototypesRel().GetTargets(&protoPaths);
+    destGeom.CreatePrototypesRel().SetTargets(protoPaths);
+  }
+
+  // Blocks the arrays of an instancer (or points) prim whose data is held by its child prims, returns the uniform instancer if not written as points
+  UsdGeomPointInstancer BlockUsdInstancerArrays(UsdBridgeUsdWriter* writer, const UsdStagePtr& sceneStage, const UsdStagePtr& timeVarStage,
+    const UsdBridgeInstancerData& geomData, TimeEvaluator<UsdBridgeInstancerData>& timeEval, UsdBridgePrimCache* cacheEntry)
+  {
+    const SdfPath& instancerPath = cacheEntry->PrimPath;
+    if(geomData.UseUsdGeomPoints)
+    {
+      UsdGeomPoints uniformGeom = UsdGeomPoints::Get(sceneStage, instancerPath);
+      assert(uniformGeom);
+      UsdGeomPoints timeVarGeom = UsdGeomPoints::Get(timeVarStage, instancerPath);
+      assert(timeVarGeom);
+      BlockUsdGeomArrays(writer, timeVarGeom, uniformGeom, geomData, timeEval, cacheEntry);
+      return UsdGeomPointInstancer();
+    }
+
+    UsdGeomPointInstancer uniformGeom = UsdGeomPointInstancer::Get(sceneStage, instancerPath);
+    assert(uniformGeom);
+    UsdGeomPointInstancer timeVarGeom = UsdGeomPointInstancer::Get(timeVarStage, instancerPath);
+    assert(timeVarGeom);
+    BlockUsdGeomArrays(writer, timeVarGeom, uniformGeom, geomData, timeEval, cacheEntry);
+    return uniformGeom;
+  }
+
+  bool MeshLodsApply(const UsdBridgeMeshData& geomData, const std::vector<float>& lodRatios, uint64_t lodMinPrimitives)
+  {
+    if(lodRatios.empty() || geomData.FaceVertexCount < 3 || geomData.FaceVertexCount > 4 || !geomData.Points
+      || (geomData.PointsType != UsdBridgeType::FLOAT3 && geomData.PointsType != UsdBridgeType::DOUBLE3))
+      return false;
+    if(geomData.Indices && geomData.IndicesType != UsdBridgeType::INT && geomData.IndicesType != UsdBridgeType::UINT
+      && geomData.IndicesType != UsdBridgeType::LONG && geomData.IndicesType != UsdBridgeType::ULONG)
+      return false;
+    return geomData.NumIndices / static_cast<uint64_t>(geomData.FaceVertexCount) >= std::max(lodMinPrimitives, uint64_t(1));
+  }
+
+  bool InstancerLodsApply(const UsdBridgeInstancerData& geomData, const std::vector<float>& lodRatios, uint64_t lodMinPrimitives)
+  {
+    return !lodRatios.empty() && geomData.Points
+      && (geomData.PointsType == UsdBridgeType::FLOAT3 || geomData.PointsType == UsdBridgeType::DOUBLE3)
+      && geomData.NumPoints >= std::max(lodMinPrimitives, uint64_t(1));
+  }
+
+  template<typename ValueType>
+  uint64_t HashCombineValue(uint64_t hash, const ValueType& value)
+  {
+    return ubutils::HashCombine(hash, ubutils::HashData(&value, sizeof(ValueType)));
+  }
+
+  // Combines an array of the level of detail source into key, first computing its content hash if unknown.
+  // The hash is resolved into a value, as the job outlives the hash source.
+  uint64_t HashLodSourceArray(uint64_t key, const void* data, UsdBridgeDataHash& dataHash, size_t eltSize, uint64_t numElements)
+  {
+    uint64_t hash = dataHash.Get();
+    if(data && !hash)
+      hash = ubutils::HashData(data, eltSize*numElements);
+    dataHash = UsdBridgeDataHash();
+    dataHash.Value = hash;
+    return ubutils::HashCombine(ubutils::HashCombine(ubutils::HashCombine(key, hash), eltSize), numElements);
+  }
+
+  uint64_t HashLodSourceAttributes(uint64_t key, UsdBridgeAttribute* attributes, uint32_t numAttributes, uint64_t numPoints, uint64_t numPrims)
+  {
+    for(uint32_t attribIdx = 0; attribIdx < numAttributes; ++attribIdx)
+    {
+      UsdBridgeAttribute& attrib = attributes[attribIdx];
+      size_t eltSize = attrib.EltSize ? attrib.EltSize : GetElementSize(attrib.DataType);
+      key = HashLodSourceArray(key, attrib.Data, attrib.DataHash, eltSize, attrib.PerPrimData ? numPrims : numPoints);
+      key = ubutils::HashCombine(HashCombineValue(key, attrib.DataType), attrib.Name ? ubutils::HashData(attrib.Name, std::strlen(attrib.Name)) : 0);
+    }
+    return key;
+  }
+
+  // Keeps the source arrays of a level of detail job valid after the geometry update returns,
+  // by adding a reference to their owner, or otherwise by copying them
+  struct UsdBridgeLodSourceData
+  {
+    UsdBridgeLodSourceData() = default;
+    UsdBridgeLodSourceData(const UsdBridgeLodSourceData&) = delete;
+    UsdBridgeLodSourceData& operator=(const UsdBridgeLodSourceData&) = delete;
+
+    ~UsdBridgeLodSourceData()
+    {
+      for(UsdBridgeDataOwner* owner : Owners)
+        owner->ReleaseDataRef();
+    }
+
+    template<typename DataType>
+    void Retain(DataType*& data, UsdBridgeDataOwner* owner, size_t numBytes)
+    {
+      if(!data)
+        return;
+      if(owner)
+      {
+        owner->AddDataRef();
+        Owners.push_back(owner);
+        return;
+      }
+      const char* bytes = reinterpret_cast<const char*>(data);
+      Copies.emplace_back(bytes, bytes + numBytes); // Moving the vectors on reallocation keeps their data in place
+      data = reinterpret_cast<DataType*>(Copies.back().data());
+    }
+
+    // Copies the attribute definitions, including their names
+    void CopyAttributes(const UsdBridgeAttribute*& attributes, uint32_t numAttributes)
+    {
+      Attributes.assign(attributes, attributes + numAttributes);
+      AttributeNames.resize(numAttributes);
+      for(uint32_t attribIdx = 0; attribIdx < numAttributes; ++attribIdx)
+      {
+        if(Attributes[attribIdx].Name)
+        {
+          AttributeNames[attribIdx] = Attributes[attribIdx].Name;
+          Attributes[attribIdx].Name = AttributeNames[attribIdx].c_str();
+        }
+      }
+      attributes = Attributes.data();
+    }
+
+    void RetainAttributes(uint64_t numPoints, uint64_t numPrims)
+    {
+      for(UsdBridgeAttribute& attrib : Attributes)
+      {
+        size_t eltSize = attrib.EltSize ? attrib.EltSize : GetElementSize(attrib.DataType);
+        Retain(attrib.Data, attrib.DataOwner, eltSize*(attrib.PerPrimData ? numPrims : numPoints));
+        attrib.DataOwner = nullptr;
+      }
+    }
+
+    std::vector<UsdBridgeDataOwner*> Owners;
+    std::vector<std::vector<char>> Copies;
+    std::vector<UsdBridgeAttribute> Attributes;
+    std::vector<std::string> AttributeNames;
+  };
+
+  // Decimates a mesh (with quads split into triangles) to each of the ratios of its triangle count.
+  // Decimation only removes vertices, so every level is a partition of the source's points with the gathered per-vertex and per-face data.
+  struct UsdBridgeMeshLodJob : public UsdBridgeLodGenerator::Job
+  {
+    void Build() override
+    {
+      uint64_t faceVertexCount = static_cast<uint64_t>(SourceData.FaceVertexCount);
+      uint64_t numFaces = SourceData.NumIndices / faceVertexCount;
+
+      UsdBridgeMeshPartition sourcePart;
+      sourcePart.NumFaces = numFaces;
+      ReadMeshPartIndices(SourceData, sourcePart);
+
+      std::vector<uint64_t> triIndices, triFaces;
+      if(faceVertexCount == 4)
+      {
+        triIndices.resize(numFaces*6);
+        triFaces.resize(numFaces*2);
+        for(uint64_t faceIdx = 0; faceIdx < numFaces; ++faceIdx)
+        {
+          const uint64_t* quad = sourcePart.SourceIndices.data() + faceIdx*4;
+          uint64_t* tris = triIndices.data() + faceIdx*6;
+          tris[0] = quad[0]; tris[1] = quad[1]; tris[2] = quad[2];
+          tris[3] = quad[0]; tris[4] = quad[2]; tris[5] = quad[3];
+          triFaces[faceIdx*2] = triFaces[faceIdx*2 + 1] = faceIdx;
+        }
+      }
+      else
+        triIndices.swap(sourcePart.SourceIndices);
+      size_t numTriangles = triIndices.size() / 3;
+
+      Levels.resize(Ratios.size());
+      ubutils::ParallelFor(Levels.size(), NumThreads, [this, &triIndices, &triFaces, numTriangles](size_t levelIdx)
+      {
+        UsdBridgeMeshPartition& level = Levels[levelIdx];
+        size_t targetTriangles = std::max(static_cast<size_t>(numTriangles*static_cast<double>(Ratios[levelIdx])), size_t(1));
+
+        std::vector<uint64_t> keptTriangles;
+        if(SourceData.PointsType == UsdBridgeType::FLOAT3)
+          ubutils::DecimateTriangles(static_cast<const float*>(SourceData.Points), SourceData.NumPoints, triIndices.data(), numTriangles, targetTriangles,
+            keptTriangles, level.SourceIndices);
+        else
+          ubutils::DecimateTriangles(static_cast<const double*>(SourceData.Points), SourceData.NumPoints, triIndices.data(), numTriangles, targetTriangles,
+            keptTriangles, level.SourceIndices);
+
+        if(triFaces.empty())
+          level.Faces.swap(keptTriangles);
+        else
+        {
+          level.Faces.resize(keptTriangles.size());
+          for(size_t i = 0; i < keptTriangles.size(); ++i)
+            level.Faces[i] = triFaces[keptTriangles[i]];
+        }
+        level.NumFaces = level.Faces.size();
+        level.TopologyHash.Value = HashCombineValue(LodKey, Ratios[levelIdx]);
+
+        AssembleMeshPartition(SourceData, level);
+        level.PartData.FaceVertexCount = 3;
+      });
+    }
+
+    UsdBridgeMeshData SourceData;
+    UsdBridgeLodSourceData Source;
+    std::vector<float> Ratios;
+    uint64_t LodKey = 0;
+
+    std::vector<UsdBridgeMeshPartition> Levels;
+  };
+
+  // Subsamples points (and all their per-point data) to each of the ratios of their count, evenly along a Z-order curve through their bounds,
+  // so the kept points remain spread over the occupied space
+  struct UsdBridgeInstancerLodJob : public UsdBridgeLodGenerator::Job
+  {
+    void Build() override
+    {
+      std::vector<uint64_t> sortedPoints;
+      if(SourceData.PointsType == UsdBridgeType::FLOAT3)
+        ubutils::MortonOrder(static_cast<const float*>(SourceData.Points), SourceData.NumPoints, sortedPoints, NumThreads);
+      else
+        ubutils::MortonOrder(static_cast<const double*>(SourceData.Points), SourceData.NumPoints, sortedPoints, NumThreads);
+
+      uint64_t numPoints = SourceData.NumPoints;
+      Levels.resize(Ratios.size());
+      ubutils::ParallelFor(Levels.size(), NumThreads, [this, &sortedPoints, numPoints](size_t levelIdx)
+      {
+        uint64_t numKept = std::max(static_cast<uint64_t>(numPoints*static_cast<double>(Ratios[levelIdx])), uint64_t(1));
+        double stride = static_cast<double>(numPoints) / static_cast<double>(numKept);
+
+        std::vector<uint64_t> keptPoints(numKept);
+        for(uint64_t i = 0; i < numKept; ++i)
+          keptPoints[i] = sortedPoints[std::min(static_cast<uint64_t>(i*stride), numPoints - 1)];
+
+        UsdBridgeInstancerTile& level = Levels[levelIdx];
+        level.PointBegin = 0;
+        level.NumPoints = numKept;
+        level.OrderHash.Value = HashCombineValue(LodKey, Ratios[levelIdx]);
+        BuildInstancerTile(SourceData, keptPoints, level);
+      });
+    }
+
+    UsdBridgeInstancerData SourceData;
+    UsdBridgeLodSourceData Source;
+    std::vector<float> Ratios;
+    uint64_t LodKey = 0;
+
+    std::vector<UsdBridgeInstancerTile> Levels;
+  };
+
+  // Creates the level of detail job for the geometry data and computes the key identifying its source data, settings and (if timevarying) timestep.
+  // Arrays without a content hash are hashed here, so unchanged data does not trigger a new job.
+  std::unique_ptr<UsdBridgeMeshLodJob> CreateLodJob(UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& geomData,
+    const std::vector<float>& lodRatios, double timeStep, unsigned int numThreads)
+  {
+    std::unique_ptr<UsdBridgeMeshLodJob> job = std::make_unique<UsdBridgeMeshLodJob>();
+    job->CacheEntry = cacheEntry;
+    job->TimeStep = timeStep;
+    job->GeomType = UsdBridgeGeomType::MESH;
+    job->Ratios = lodRatios;
+    job->NumThreads = numThreads;
+
+    UsdBridgeMeshData& sourceData = job->SourceData;
+    sourceData = geomData;
+    job->Source.CopyAttributes(sourceData.Attributes, sourceData.NumAttributes);
+
+    uint64_t numPrims = sourceData.NumIndices / static_cast<uint64_t>(sourceData.FaceVertexCount);
+    uint64_t key = ubutils::HashData(lodRatios.data(), lodRatios.size()*sizeof(float));
+    key = HashCombineValue(key, sourceData.TimeVarying);
+    if(sourceData.TimeVarying != UsdBridgeMeshData::DataMemberId::NONE)
+      key = HashCombineValue(key, timeStep);
+    key = HashCombineValue(HashCombineValue(key, sourceData.FaceVertexCount), sourceData.IndicesType);
+    key = HashLodSourceArray(key, sourceData.Points, sourceData.PointsHash, GetElementSize(sourceData.PointsType), sourceData.NumPoints);
+    key = HashLodSourceArray(key, sourceData.Indices, sourceData.IndicesHash, GetElementSize(sourceData.IndicesType), sourceData.NumIndices);
+    key = HashLodSourceArray(key, sourceData.Normals, sourceData.NormalsHash, GetElementSize(sourceData.NormalsType),
+      sourceData.PerPrimNormals ? numPrims : sourceData.NumPoints);
+    key = HashLodSourceArray(key, sourceData.Colors, sourceData.ColorsHash, GetElementSize(sourceData.ColorsType),
+      sourceData.PerPrimColors ? numPrims : sourceData.NumPoints);
+    job->LodKey = HashLodSourceAttributes(key, job->Source.Attributes.data(), sourceData.NumAttributes, sourceData.NumPoints, numPrims);
+
+    return job;
+  }
+
+  std::unique_ptr<UsdBridgeInstancerLodJob> CreateLodJob(UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& geomData,
+    const std::vector<float>& lodRatios, double timeStep, unsigned int numThreads)
+  {
+    std::unique_ptr<UsdBridgeInstancerLodJob> job = std::make_unique<UsdBridgeInstancerLodJob>();
+    job->CacheEntry = cacheEntry;
+    job->TimeStep = timeStep;
+    job->GeomType = UsdBridgeGeomType::INSTANCER;
+    job->Ratios = lodRatios;
+    job->NumThreads = numThreads;
+
+    UsdBridgeInstancerData& sourceData = job->SourceData;
+    sourceData = geomData;
+    job->Source.CopyAttributes(sourceData.Attributes, sourceData.NumAttributes);
+
+    uint64_t numPoints = sourceData.NumPoints;
+    uint64_t key = ubutils::HashData(lodRatios.data(), lodRatios.size()*sizeof(float));
+    key = HashCombineValue(key, sourceData.TimeVarying);
+    if(sourceData.TimeVarying != UsdBridgeInstancerData::DataMemberId::NONE)
+      key = HashCombineValue(key, timeStep);
+    key = HashCombineValue(HashCombineValue(HashCombineValue(key, sourceData.UseUsdGeomPoints), sourceData.Scale), sourceData.Orientation);
+    key = HashLodSourceArray(key, sourceData.Points, sourceData.PointsHash, GetElementSize(sourceData.PointsType), numPoints);
+    key = HashLodSourceArray(key, sourceData.Colors, sourceData.ColorsHash, GetElementSize(sourceData.ColorsType), numPoints);
+
+    // The other arrays have no content hash field
+    auto hashArray = [&key](const void* data, size_t eltSize, uint64_t numElements)
+    {
+      UsdBridgeDataHash arrayHash;
+      key = HashLodSourceArray(key, data, arrayHash, eltSize, numElements);
+    };
+    hashArray(sourceData.ShapeIndices, sizeof(int), numPoints);
+    hashArray(sourceData.Scales, GetElementSize(sourceData.ScalesType), numPoints);
+    hashArray(sourceData.Orientations, GetElementSize(sourceData.OrientationsType), numPoints);
+    hashArray(sourceData.LinearVelocities, 3*sizeof(float), numPoints);
+    hashArray(sourceData.AngularVelocities, 3*sizeof(float), numPoints);
+    hashArray(sourceData.InstanceIds, GetElementSize(sourceData.InstanceIdsType), numPoints);
+    hashArray(sourceData.InvisibleIds, GetElementSize(sourceData.InvisibleIdsType), sourceData.NumInvisibleIds);
+    job->LodKey = HashLodSourceAttributes(key, job->Source.Attributes.data(), sourceData.NumAttributes, numPoints, numPoints);
+
+    return job;
+  }
+
+  void RetainLodSource(UsdBridgeMeshLodJob& job)
+  {
+    UsdBridgeMeshData& sourceData = job.SourceData;
+    UsdBridgeLodSourceData& source = job.Source;
+    uint64_t numPrims = sourceData.NumIndices / static_cast<uint64_t>(sourceData.FaceVertexCount);
+
+    source.Retain(sourceData.Points, sourceData.PointsOwner, sourceData.NumPoints*GetElementSize(sourceData.PointsType));
+    sourceData.PointsOwner = nullptr;
+    source.Retain(sourceData.Indices, sourceData.IndicesOwner, sourceData.NumIndices*GetElementSize(sourceData.IndicesType));
+    sourceData.IndicesOwner = nullptr;
+    source.Retain(sourceData.Normals, sourceData.NormalsOwner,
+      (sourceData.PerPrimNormals ? numPrims : sourceData.NumPoints)*GetElementSize(sourceData.NormalsType));
+    sourceData.NormalsOwner = nullptr;
+    source.Retain(sourceData.Colors, nullptr, (sourceData.PerPrimColors ? numPrims : sourceData.NumPoints)*GetElementSize(sourceData.ColorsType));
+    source.RetainAttributes(sourceData.NumPoints, numPrims);
+  }
+
+  void RetainLodSource(UsdBridgeInstancerLodJob& job)
+  {
+    UsdBridgeInstancerData& sourceData = job.SourceData;
+    UsdBridgeLodSourceData& source = job.Source;
+    uint64_t numPoints = sourceData.NumPoints;
+
+    source.Retain(sourceData.Points, sourceData.PointsOwner, numPoints*GetElementSize(sourceData.PointsType));
+    sourceData.PointsOwner = nullptr;
+    source.Retain(sourceData.ShapeIndices, nullptr, numPoints*sizeof(int));
+    source.Retain(sourceData.Scales, nullptr, numPoints*GetElementSize(sourceData.ScalesType));
+    source.Retain(sourceData.Orientations, nullptr, numPoints*GetElementSize(sourceData.OrientationsType));
+    source.Retain(sourceData.Colors, nullptr, numPoints*GetElementSize(sourceData.ColorsType));
+    source.Retain(sourceData.LinearVelocities, nullptr, numPoints*3*sizeof(float));
+    source.Retain(sourceData.AngularVelocities, nullptr, numPoints*3*sizeof(float));
+    source.Retain(sourceData.InstanceIds, nullptr, numPoints*GetElementSize(sourceData.InstanceIdsType));
+    source.Retain(sourceData.InvisibleIds, nullptr, sourceData.NumInvisibleIds*GetElementSize(sourceData.InvisibleIdsType));
+    source.RetainAttributes(numPoints, numPoints);
+  }
+}
+
+UsdPrim UsdBridgeUsdWriter::InitializeUsdGeometry(UsdStageRefPtr geometryStage, const SdfPath& geomPath, const UsdBridgeMeshData& meshData, bool uniformPrim)
+{
+  return InitializeUsdGeometry_Impl(this, geometryStage, geomPath, meshData, uniformPrim, Settings);
+}
+
+UsdPrim UsdBridgeUsdWriter::InitializeUsdGeometry(UsdStageRefPtr geometryStage, const SdfPath& geomPath, const UsdBridgeInstancerData& instancerData, bool uniformPrim)
+{
+  return InitializeUsdGeometry_Impl(this, geometryStage, geomPath, instancerData, uniformPrim, Settings);
+}
+
+UsdPrim UsdBridgeUsdWriter::InitializeUsdGeometry(UsdStageRefPtr geometryStage, const SdfPath& geomPath, const UsdBridgeCurveData& curveData, bool uniformPrim)
+{
+  return InitializeUsdGeometry_Impl(this, geometryStage, geomPath, curveData, uniformPrim, Settings);
+}
+
+#ifdef VALUE_CLIP_RETIMING
+void UsdBridgeUsdWriter::UpdateUsdGeometryManifest(const UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& meshData)
+{
+  TimeEvaluator<UsdBridgeMeshData> timeEval(meshData);
+  InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, cacheEntry->PrimPath, meshData, false,
+    Settings, &timeEval);
+  for(const std::unique_ptr<UsdBridgePrimCache>& partCache : cacheEntry->GeometryParts)
+  {
+    InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, partCache->PrimPath, meshData, false,
+      Settings, &timeEval);
+  }
+  if(!cacheEntry->LodLevels.empty()) // Only the full resolution level has clip data
+  {
+    InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, cacheEntry->LodLevels[0]->PrimPath, meshData, false,
+      Settings, &timeEval);
+  }
+
+  MarkStageDirty(cacheEntry->ManifestStage.second);
+}
+
+void UsdBridgeUsdWriter::UpdateUsdGeometryManifest(const UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& instancerData)
+{
+  TimeEvaluator<UsdBridgeInstancerData> timeEval(instancerData);
+  InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, cacheEntry->PrimPath, instancerData, false,
+    Settings, &timeEval);
+  for(const std::unique_ptr<UsdBridgePrimCache>& tileCache : cacheEntry->GeometryParts)
+  {
+    InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, tileCache->PrimPath, instancerData, false,
+      Settings, &timeEval);
+  }
+  if(!cacheEntry->LodLevels.empty())
+  {
+    InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, cacheEntry->LodLevels[0]->PrimPath, instancerData, false,
+      Settings, &timeEval);
+  }
+
+  MarkStageDirty(cacheEntry->ManifestStage.second);
+}
+
+void UsdBridgeUsdWriter::UpdateUsdGeometryManifest(const UsdBridgePrimCache* cacheEntry, const UsdBridgeCurveData& curveData)
+{
+  TimeEvaluator<UsdBridgeCurveData> timeEval(curveData);
+  InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, cacheEntry->PrimPath, curveData, false,
+    Settings, &timeEval);
+
+  MarkStageDirty(cacheEntry->ManifestStage.second);
+}
+#endif
+
+#define UPDATE_USDGEOM_ARRAYS(FuncDef) \
+  FuncDef(this, timeVarGeom, uniformGeom, geomData, numPrims, updateEval, timeEval)
+
+#define UPDATE_USDGEOM_PRIMVAR_ARRAYS(FuncDef) \
+  FuncDef(this, timeVarPrimvars, uniformPrimvars, geomData, numPrims, updateEval, timeEval)
+
+#define UPDATE_USDGEOM_CACHED_ARRAYS(FuncDef) \
+  FuncDef(this, timeVarGeom, uniformGeom, geomData, numPrims, updateEval, timeEval, cacheEntry)
+
+#define UPDATE_USDGEOM_CACHED_PRIMVAR_ARRAYS(FuncDef) \
+  FuncDef(this, timeVarPrimvars, uniformPrimvars, geomData, numPrims, updateEval, timeEval, cacheEntry)
+
+void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& geomData, double timeStep)
+{
+  if(MeshRequiresParts(geomData))
+  {
+    UpdateUsdMeshParts(timeVarStage, cacheEntry, geomData, timeStep);
+    SetUsdGeometryLodsEnabled(cacheEntry, false);
+    return;
+  }
+
+  if(MeshLodsApply(geomData, LodRatios, LodMinPrimitives))
+    UpdateUsdMeshLods(timeVarStage, cacheEntry, geomData, timeStep);
+  else
+  {
+    UpdateUsdMeshGeometry(timeVarStage, cacheEntry, geomData, timeStep);
+    SetUsdGeometryLodsEnabled(cacheEntry, false);
+  }
+
+  if(!cacheEntry->GeometryParts.empty())
+  {
+    TimeEvaluator<bool> timeEval(geomData.TimeVarying != UsdBridgeMeshData::DataMemberId::NONE, timeStep);
+    SetUsdGeometryPartsVisibility(cacheEntry, 0, timeEval.Eval());
+  }
+}
+
+void UsdBridgeUsdWriter::UpdateUsdMeshGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& geomData, double timeStep)
+{
+  const SdfPath& meshPath = cacheEntry->PrimPath;
+
+  // To avoid data duplication when using of clip stages, we need to potentially use the scenestage prim for time-uniform data.
+  UsdGeomMesh uniformGeom = UsdGeomMesh::Get(this->SceneStage, meshPath);
+  assert(uniformGeom);
+  UsdGeomPrimvarsAPI uniformPrimvars(uniformGeom);
+
+  UsdGeomMesh timeVarGeom = UsdGeomMesh::Get(timeVarStage, meshPath);
+  assert(timeVarGeom);
+  UsdGeomPrimvarsAPI timeVarPrimvars(timeVarGeom);
+
+  // Update the mesh
+  UsdBridgeUpdateEvaluator<const UsdBridgeMeshData> updateEval(geomData);
+  TimeEvaluator<UsdBridgeMeshData> timeEval(geomData, timeStep);
+
+  assert((geomData.NumIndices % geomData.FaceVertexCount) == 0);
+  uint64_t numPrims = geomData.NumIndices / static_cast<uint64_t>(geomData.FaceVertexCount);
+
+  UPDATE_USDGEOM_CACHED_ARRAYS(UpdateUsdGeomPoints);
+  UPDATE_USDGEOM_CACHED_ARRAYS(UpdateUsdGeomNormals);
+  if( Settings.EnableStTexCoords && UsdGeomDataHasTexCoords(geomData) )
+    { UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomTexCoords); }
+  UPDATE_USDGEOM_CACHED_PRIMVAR_ARRAYS(UpdateUsdGeomAttributes);
+  UPDATE_USDGEOM_CACHED_PRIMVAR_ARRAYS(UpdateUsdGeomColors);
+  UPDATE_USDGEOM_CACHED_ARRAYS(UpdateUsdGeomIndices);
+}
+
+// Writes a mesh with more points or indices than 32-bit indices can address as child meshes (parts) of consecutive faces.
+// Each part holds the vertices referenced by its faces, with indices rebased accordingly. The mesh prim's own arrays are blocked.
+// Parts are built in parallel, a batch at a time to bound the memory of the gathered data, and written out sequentially.
+void UsdBridgeUsdWriter::UpdateUsdMeshParts(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& geomData, double timeStep)
+{
+  using DMI = UsdBridgeMeshData::DataMemberId;
+
+  if(geomData.FaceVertexCount <= 0 || !geomData.NumPoints)
+  {
+    UsdBridgeLogMacro(this->LogObject, UsdBridgeLogLevel::ERR, "Mesh at " << cacheEntry->PrimPath << " exceeds 32-bit indexing, but cannot be split without points and faces.");
+    return;
+  }
+  if(geomData.Indices && geomData.IndicesType != UsdBridgeType::INT && geomData.IndicesType != UsdBridgeType::UINT
+    && geomData.IndicesType != UsdBridgeType::LONG && geomData.IndicesType != UsdBridgeType::ULONG)
+  {
+    UsdBridgeLogMacro(this->LogObject, UsdBridgeLogLevel::ERR, "UsdGeom FaceVertexIndicesAttr should be (U)LONG or (U)INT.");
+    return;
+  }
+
+  UsdGeomMesh uniformGeom = UsdGeomMesh::Get(this->SceneStage, cacheEntry->PrimPath);
+  assert(uniformGeom);
+  UsdGeomMesh timeVarGeom = UsdGeomMesh::Get(timeVarStage, cacheEntry->PrimPath);
+  assert(timeVarGeom);
+
+  TimeEvaluator<UsdBridgeMeshData> timeEval(geomData, timeStep);
+  BlockUsdGeomArrays(this, timeVarGeom, uniformGeom, geomData, timeEval, cacheEntry);
+
+  uint64_t faceVertexCount = static_cast<uint64_t>(geomData.FaceVertexCount);
+  uint64_t numFaces = geomData.NumIndices / faceVertexCount;
+  uint64_t facesPerPart = std::max(MeshPartMaxIndices / faceVertexCount, uint64_t(1));
+  size_t numParts = static_cast<size_t>((numFaces + facesPerPart - 1) / facesPerPart);
+
+  UsdBridgeDataHash topologyHash = geomData.IndicesHash;
+  if(!geomData.Indices)
+  {
+    topologyHash = UsdBridgeDataHash();
+    topologyHash.Value = GetTopologyValueKey(TopologyArrayKind::IDENTITYINDICES, geomData.NumIndices);
+  }
+
+  // One partition per thread of usd::flush.threads at a time
+  unsigned int numThreads = ubutils::ResolveNumThreads(NumThreads);
+  size_t batchSize = std::min(static_cast<size_t>(numThreads), numParts);
+  std::vector<UsdBridgeMeshPartition> partitions(batchSize);
+
+  bool hasInvalidIndices = false;
+  bool manifestModified = false;
+  for(size_t batchBegin = 0; batchBegin < numParts; batchBegin += batchSize)
+  {
+    size_t numBatchParts = std::min(batchSize, numParts - batchBegin);
+
+    ubutils::ParallelFor(numBatchParts, numThreads, [&geomData, &partitions, batchBegin, facesPerPart, numFaces, &topologyHash](size_t jobIdx)
+    {
+      UsdBridgeMeshPartition& part = partitions[jobIdx];
+      part.FaceBegin = (batchBegin + jobIdx) * facesPerPart;
+      part.NumFaces = std::min(facesPerPart, numFaces - part.FaceBegin);
+      part.TopologyHash = topologyHash;
+      BuildMeshPartition(geomData, part);
+    });
+
+    for(size_t jobIdx = 0; jobIdx < numBatchParts; ++jobIdx)
+    {
+      const UsdBridgeMeshPartition& part = partitions[jobIdx];
+      hasInvalidIndices = hasInvalidIndices || part.HasInvalidIndices;
+
+      size_t partIdx = batchBegin + jobIdx;
+      manifestModified = manifestModified || (partIdx >= cacheEntry->GeometryParts.size());
+
+      UsdBridgePrimCache* partCache = InitializeUsdGeometryPart(timeVarStage, cacheEntry, cacheEntry->GeometryParts, partIdx, constring::meshPartPf, part.PartData);
+      UpdateUsdMeshGeometry(timeVarStage, partCache, part.PartData, timeStep);
+    }
+  }
+
+  if(hasInvalidIndices)
+  {
+    UsdBridgeLogMacro(this->LogObject, UsdBridgeLogLevel::WARNING, "Mesh at " << cacheEntry->PrimPath << " has indices out of range of its points, these have been replaced by 0.");
+  }
+
+  TimeEvaluator<bool> visibilityEval(geomData.TimeVarying != DMI::NONE, timeStep);
+  SetUsdGeometryPartsVisibility(cacheEntry, numParts, visibilityEval.Eval());
+
+#ifdef VALUE_CLIP_RETIMING
+  if(manifestModified)
+    MarkStageDirty(cacheEntry->ManifestStage.second);
+#endif
+}
+
+// Child prims of a geometry are cached in parts, in order of their index. Only child prims with timevarying data outside of the scene stage are in the manifest.
+template<typename GeomDataType>
+UsdBridgePrimCache* UsdBridgeUsdWriter::InitializeUsdGeometryPart(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry,
+  std::vector<std::unique_ptr<UsdBridgePrimCache>>& parts, size_t partIdx, const char* partPrefix, const GeomDataType& partData)
+{
+  assert(partIdx <= parts.size());
+  if(partIdx >= parts.size())
+  {
+    TfToken partName(partPrefix + std::to_string(partIdx));
+    SdfPath partPath = cacheEntry->PrimPath.AppendChild(partName);
+    parts.emplace_back(std::make_unique<UsdBridgePrimCache>(partPath, SdfPath(partName), nullptr));
+
+#ifdef VALUE_CLIP_RETIMING
+    if(get_pointer(timeVarStage) != get_pointer(this->SceneStage))
+    {
+      TimeEvaluator<GeomDataType> timeEval(partData);
+      InitializeUsdGeometry_Impl(this, cacheEntry->ManifestStage.second, partPath, partData, false,
+        Settings, &timeEval);
+    }
+#endif
+  }
+
+  UsdBridgePrimCache* partCache = parts[partIdx].get();
+  const SdfPath& partPath = partCache->PrimPath;
+
+  if(!this->SceneStage->GetPrimAtPath(partPath))
+    InitializeUsdGeometry_Impl(this, this->SceneStage, partPath, partData, true, Settings);
+  if(!timeVarStage->GetPrimAtPath(partPath)) // Only differs from the scene stage prim for clip stages
+    InitializeUsdGeometry_Impl(this, timeVarStage, partPath, partData, false, Settings);
+
+  return partCache;
+}
+
+// Parts are hidden rather than removed, so the data of other timesteps remains intact
+void UsdBridgeUsdWriter::SetUsdGeometryPartsVisibility(UsdBridgePrimCache* cacheEntry, size_t numVisibleParts, const UsdTimeCode& timeCode)
+{
+  for(size_t partIdx = 0; partIdx < cacheEntry->GeometryParts.size(); ++partIdx)
+  {
+    UsdGeomImageable partGeom = UsdGeomImageable::Get(this->SceneStage, cacheEntry->GeometryParts[partIdx]->PrimPath);
+    if(!partGeom)
+      continue;
+
+    UsdAttribute visAttrib = partGeom.CreateVisibilityAttr();
+    if(timeCode.IsDefault())
+      visAttrib.Clear();
+    visAttrib.Set(VtValue(partIdx < numVisibleParts ? UsdGeomTokens->inherited : UsdGeomTokens->invisible), timeCode);
+  }
+}
+
+// Writes the full resolution mesh to the first level of detail (blocking the mesh prim's own arrays, like parts do) and submits the generation
+// of the decimated levels to the background, unless the source data is unchanged since the last submission.
+// Finished levels are authored into the scene stage by UpdateUsdGeometryLods.
+void UsdBridgeUsdWriter::UpdateUsdMeshLods(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeMeshData& geomData, double timeStep)
+{
+  UsdGeomMesh uniformGeom = UsdGeomMesh::Get(this->SceneStage, cacheEntry->PrimPath);
+  assert(uniformGeom);
+  UsdGeomMesh timeVarGeom = UsdGeomMesh::Get(timeVarStage, cacheEntry->PrimPath);
+  assert(timeVarGeom);
+
+  TimeEvaluator<UsdBridgeMeshData> timeEval(geomData, timeStep);
+  BlockUsdGeomArrays(this, timeVarGeom, uniformGeom, geomData, timeEval, cacheEntry);
+
+  SetUsdGeometryLodsEnabled(cacheEntry, true);
+
+  bool manifestModified = cacheEntry->LodLevels.empty();
+  UsdBridgePrimCache* levelCache = InitializeUsdGeometryPart(timeVarStage, cacheEntry, cacheEntry->LodLevels, 0, constring::lodPf, geomData);
+  UpdateUsdMeshGeometry(timeVarStage, levelCache, geomData, timeStep);
+
+  std::unique_ptr<UsdBridgeMeshLodJob> job = CreateLodJob(cacheEntry, geomData, LodRatios, timeStep, NumThreads);
+  if(job->LodKey != cacheEntry->LodSourceKey)
+  {
+    cacheEntry->LodSourceKey = job->LodKey;
+    RetainLodSource(*job);
+    LodGenerator.Submit(std::move(job));
+  }
+
+#ifdef VALUE_CLIP_RETIMING
+  if(manifestModified)
+    MarkStageDirty(cacheEntry->ManifestStage.second);
+#endif
+}
+
+// Levels of detail only hold uniform data or timesamples in the scene stage, so they are not part of the manifest
+void UsdBridgeUsdWriter::UpdateUsdMeshLodLevels(UsdBridgePrimCache* cacheEntry, const std::vector<UsdBridgeMeshData>& levelDatas, double timeStep)
+{
+  for(size_t levelIdx = 0; levelIdx < levelDatas.size(); ++levelIdx)
+  {
+    UsdBridgePrimCache* levelCache = InitializeUsdGeometryPart(this->SceneStage, cacheEntry, cacheEntry->LodLevels, levelIdx + 1, constring::lodPf, levelDatas[levelIdx]);
+    UpdateUsdMeshGeometry(this->SceneStage, levelCache, levelDatas[levelIdx], timeStep);
+  }
+
+  UpdateUsdGeometryLodVariants(cacheEntry, levelDatas.size() + 1);
+}
+
+// Every variant of the lod variant set on the geometry prim shows one of its levels of detail and hides all others
+void UsdBridgeUsdWriter::UpdateUsdGeometryLodVariants(UsdBridgePrimCache* cacheEntry, size_t numLevels)
+{
+  UsdPrim geomPrim = this->SceneStage->GetPrimAtPath(cacheEntry->PrimPath);
+  if(!geomPrim)
+    return;
+
+  const std::vector<std::unique_ptr<UsdBridgePrimCache>>& lodLevels = cacheEntry->LodLevels;
+  numLevels = std::min(numLevels, lodLevels.size());
+  auto isLevelVariant = [&lodLevels, numLevels](const std::string& variantName)
+  {
+    for(size_t levelIdx = 0; levelIdx < numLevels; ++levelIdx)
+    {
+      if(lodLevels[levelIdx]->Name.GetString() == variantName)
+        return true;
+    }
+    return false;
+  };
+
+  UsdVariantSet lodSet = geomPrim.GetVariantSets().AddVariantSet(constring::lodVariantSetName);
+  std::string selection = lodSet.GetVariantSelection();
+
+  // Remove the variants of levels which are no longer generated
+  SdfPrimSpecHandle geomSpec = this->SceneStage->GetEditTarget().GetPrimSpecForScenePath(cacheEntry->PrimPath);
+  if(geomSpec)
+  {
+    auto lodSetIt = geomSpec->GetVariantSets().find(constring::lodVariantSetName);
+    if(lodSetIt != geomSpec->GetVariantSets().end())
+    {
+      SdfVariantSetSpecHandle lodSetSpec = lodSetIt->second;
+      for(const SdfVariantSpecHandle& variantSpec : lodSetSpec->GetVariantList())
+      {
+        if(!isLevelVariant(variantSpec->GetName()))
+          lodSetSpec->RemoveVariant(variantSpec);
+      }
+    }
+  }
+
+  for(size_t variantIdx = 0; variantIdx < numLevels; ++variantIdx)
+  {
+    const std::string& variantName = lodLevels[variantIdx]->Name.GetString();
+    lodSet.AddVariant(variantName);
+    lodSet.SetVariantSelection(variantName);
+
+    UsdEditContext variantContext(lodSet.GetVariantEditContext());
+    for(size_t levelIdx = 0; levelIdx < lodLevels.size(); ++levelIdx)
+    {
+      UsdGeomImageable levelGeom = UsdGeomImageable::Get(this->SceneStage, lodLevels[levelIdx]->PrimPath);
+      if(levelGeom)
+        levelGeom.CreateVisibilityAttr().Set(levelIdx == variantIdx ? UsdGeomTokens->inherited : UsdGeomTokens->invisible);
+    }
+  }
+
+  lodSet.SetVariantSelection(isLevelVariant(selection) ? selection : lodLevels[0]->Name.GetString());
+}
+
+// Levels of detail are hidden by a local opinion (stronger than the variants) rather than removed when no longer applicable, eg. with parts.
+// Unlike the geometry data, whether levels of detail are used is not timevarying.
+void UsdBridgeUsdWriter::SetUsdGeometryLodsEnabled(UsdBridgePrimCache* cacheEntry, bool enabled)
+{
+  if(cacheEntry->LodEnabled == enabled)
+    return;
+  cacheEntry->LodEnabled = enabled;
+
+  if(!enabled)
+  {
+    LodGenerator.Cancel(cacheEntry);
+    cacheEntry->LodSourceKey = 0;
+  }
+
+  for(const std::unique_ptr<UsdBridgePrimCache>& levelCache : cacheEntry->LodLevels)
+  {
+    UsdGeomImageable levelGeom = UsdGeomImageable::Get(this->SceneStage, levelCache->PrimPath);
+    if(!levelGeom)
+      continue;
+
+    if(enabled)
+      levelGeom.GetVisibilityAttr().Clear();
+    else
+      levelGeom.CreateVisibilityAttr().Set(UsdGeomTokens->invisible);
+  }
+}
+
+void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& geomData, double timeStep)
+{
+  if(geomData.MaxPointsPerTile && geomData.NumPoints > geomData.MaxPointsPerTile)
+  {
+    UpdateUsdInstancerTiles(timeVarStage, cacheEntry, geomData, timeStep);
+    SetUsdGeometryLodsEnabled(cacheEntry, false);
+    return;
+  }
+
+  if(InstancerLodsApply(geomData, LodRatios, LodMinPrimitives))
+    UpdateUsdInstancerLods(timeVarStage, cacheEntry, geomData, timeStep);
+  else
+  {
+    UpdateUsdInstancerGeometry(timeVarStage, cacheEntry, geomData, timeStep);
+    SetUsdGeometryLodsEnabled(cacheEntry, false);
+  }
+
+  if(!cacheEntry->GeometryParts.empty())
+  {
+    TimeEvaluator<bool> timeEval(geomData.TimeVarying != UsdBridgeInstancerData::DataMemberId::NONE, timeStep);
+    SetUsdGeometryPartsVisibility(cacheEntry, 0, timeEval.Eval());
+  }
+}
+
+// Writes a point cloud or instancer with more points than allowed per tile as child prims (tiles) of spatially coherent points.
+// Points are sorted along a Z-order curve through their bounds and split into tiles of consecutive sorted points,
+// so each tile gets a tight extent. All per-point arrays of a tile are permuted the same way. The parent prim's own arrays are blocked.
+void UsdBridgeUsdWriter::UpdateUsdInstancerTiles(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& geomData, double timeStep)
+{
+  using DMI = UsdBridgeInstancerData::DataMemberId;
+
+  if(!geomData.Points || (geomData.PointsType != UsdBridgeType::FLOAT3 && geomData.PointsType != UsdBridgeType::DOUBLE3))
+  {
+    UsdBridgeLogMacro(this->LogObject, UsdBridgeLogLevel::ERR, "Instancer at " << cacheEntry->PrimPath << " can only be tiled with FLOAT3 or DOUBLE3 points.");
+    return;
+  }
+
+  TimeEvaluator<UsdBridgeInstancerData> timeEval(geomData, timeStep);
+  UsdGeomPointInstancer uniformInstancer = BlockUsdInstancerArrays(this, this->SceneStage, timeVarStage, geomData, timeEval, cacheEntry);
+
+  std::vector<uint64_t> sortedPoints;
+  if(geomData.PointsType == UsdBridgeType::FLOAT3)
+    ubutils::MortonOrder(static_cast<const float*>(geomData.Points), geomData.NumPoints, sortedPoints, NumThreads);
+  else
+    ubutils::MortonOrder(static_cast<const double*>(geomData.Points), geomData.NumPoints, sortedPoints, NumThreads);
+
+  // The order follows from the points alone, so their content hash identifies it
+  const UsdBridgeDataHash& orderHash = geomData.PointsHash;
+
+  uint64_t numPoints = geomData.NumPoints;
+  size_t numTiles = static_cast<size_t>((numPoints + geomData.MaxPointsPerTile - 1) / geomData.MaxPointsPerTile);
+  uint64_t pointsPerTile = (numPoints + numTiles - 1) / numTiles; // Spread the points evenly over the tiles
+
+  // One tile per thread of usd::flush.threads at a time
+  unsigned int numThreads = ubutils::ResolveNumThreads(NumThreads);
+  size_t batchSize = std::min(static_cast<size_t>(numThreads), numTiles);
+  std::vector<UsdBridgeInstancerTile> tiles(batchSize);
+
+  bool manifestModified = false;
+  for(size_t batchBegin = 0; batchBegin < numTiles; batchBegin += batchSize)
+  {
+    size_t numBatchTiles = std::min(batchSize, numTiles - batchBegin);
+
+    ubutils::ParallelFor(numBatchTiles, numThreads, [&geomData, &sortedPoints, &tiles, batchBegin, pointsPerTile, numPoints, &orderHash](size_t jobIdx)
+    {
+      UsdBridgeInstancerTile& tile = tiles[jobIdx];
+      tile.PointBegin = (batchBegin + jobIdx) * pointsPerTile;
+      tile.NumPoints = std::min(pointsPerTile, numPoints - tile.PointBegin);
+      tile.OrderHash = orderHash;
+      BuildInstancerTile(geomData, sortedPoints, tile);
+    });
+
+    for(size_t jobIdx = 0; jobIdx < numBatchTiles; ++jobIdx)
+    {
+      const UsdBridgeInstancerTile& tile = tiles[jobIdx];
+
+      size_t tileIdx = batchBegin + jobIdx;
+      manifestModified = manifestModified || (tileIdx >= cacheEntry->GeometryParts.size());
+
+      UsdBridgePrimCache* tileCache = InitializeUsdGeometryPart(timeVarStage, cacheEntry, cacheEntry->GeometryParts, tileIdx, constring::tilePf, tile.TileData);
+      if(uniformInstancer)
+        CopyUsdInstancerPrototypes(uniformInstancer, UsdGeomPointInstancer::Get(this->SceneStage, tileCache->PrimPath));
+      UpdateUsdInstancerGeometry(timeVarStage, tileCache, tile.TileData, timeStep);
+    }
+  }
+
+  TimeEvaluator<bool> visibilityEval(geomData.TimeVarying != DMI::NONE, timeStep);
+  SetUsdGeometryPartsVisibility(cacheEntry, numTiles, visibilityEval.Eval());
+
+#ifdef VALUE_CLIP_RETIMING
+  if(manifestModified)
+    MarkStageDirty(cacheEntry->ManifestStage.second);
+#endif
+}
+
+// Writes the full resolution points to the first level of detail and submits the generation of the subsampled levels, see UpdateUsdMeshLods
+void UsdBridgeUsdWriter::UpdateUsdInstancerLods(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& geomData, double timeStep)
+{
+  TimeEvaluator<UsdBridgeInstancerData> timeEval(geomData, timeStep);
+  UsdGeomPointInstancer uniformInstancer = BlockUsdInstancerArrays(this, this->SceneStage, timeVarStage, geomData, timeEval, cacheEntry);
+
+  SetUsdGeometryLodsEnabled(cacheEntry, true);
+
+  bool manifestModified = cacheEntry->LodLevels.empty();
+  UsdBridgePrimCache* levelCache = InitializeUsdGeometryPart(timeVarStage, cacheEntry, cacheEntry->LodLevels, 0, constring::lodPf, geomData);
+  if(uniformInstancer)
+    CopyUsdInstancerPrototypes(uniformInstancer, UsdGeomPointInstancer::Get(this->SceneStage, levelCache->PrimPath));
+  UpdateUsdInstancerGeometry(timeVarStage, levelCache, geomData, timeStep);
+
+  std::unique_ptr<UsdBridgeInstancerLodJob> job = CreateLodJob(cacheEntry, geomData, LodRatios, timeStep, NumThreads);
+  if(job->LodKey != cacheEntry->LodSourceKey)
+  {
+    cacheEntry->LodSourceKey = job->LodKey;
+    RetainLodSource(*job);
+    LodGenerator.Submit(std::move(job));
+  }
+
+#ifdef VALUE_CLIP_RETIMING
+  if(manifestModified)
+    MarkStageDirty(cacheEntry->ManifestStage.second);
+#endif
+}
+
+void UsdBridgeUsdWriter::UpdateUsdInstancerLodLevels(UsdBridgePrimCache* cacheEntry, const std::vector<UsdBridgeInstancerData>& levelDatas, double timeStep)
+{
+  UsdGeomPointInstancer uniformInstancer = UsdGeomPointInstancer::Get(this->SceneStage, cacheEntry->PrimPath);
+  for(size_t levelIdx = 0; levelIdx < levelDatas.size(); ++levelIdx)
+  {
+    UsdBridgePrimCache* levelCache = InitializeUsdGeometryPart(this->SceneStage, cacheEntry, cacheEntry->LodLevels, levelIdx + 1, constring::lodPf, levelDatas[levelIdx]);
+    if(uniformInstancer)
+      CopyUsdInstancerPrototypes(uniformInstancer, UsdGeomPointInstancer::Get(this->SceneStage, levelCache->PrimPath));
+    UpdateUsdInstancerGeometry(this->SceneStage, levelCache, levelDatas[levelIdx], timeStep);
+  }
+
+  UpdateUsdGeometryLodVariants(cacheEntry, levelDatas.size() + 1);
+}
+
+void UsdBridgeUsdWriter::UpdateUsdInstancerGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeInstancerData& geomData, double timeStep)
+{
+  const SdfPath& instancerPath = cacheEntry->PrimPath;
+
+  UsdBridgeUpdateEvaluator<const UsdBridgeInstancerData> updateEval(geomData);
+  TimeEvaluator<UsdBridgeInstancerData> timeEval(geomData, timeStep);
+
+  bool useGeomPoints = geomData.UseUsdGeomPoints;
+
+  uint64_t numPrims = geomData.NumPoints;
 
   if (useGeomPoints)
   {
@@ -1166,14 +2694,14 @@ void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, cons
     assert(timeVarGeom);
     UsdGeomPrimvarsAPI timeVarPrimvars(timeVarGeom);
 
-    UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomPoints);
+    UPDATE_USDGEOM_CACHED_ARRAYS(UpdateUsdGeomPoints);
     UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomInstanceIds);
     UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomWidths);
     UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomOrientNormals);
     if( Settings.EnableStTexCoords && UsdGeomDataHasTexCoords(geomData) )
       { UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomTexCoords); }
-    UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomAttributes);
-    UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomColors);
+    UPDATE_USDGEOM_CACHED_PRIMVAR_ARRAYS(UpdateUsdGeomAttributes);
+    UPDATE_USDGEOM_CACHED_PRIMVAR_ARRAYS(UpdateUsdGeomColors);
   }
   else
   {
@@ -1185,14 +2713,14 @@ void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, cons
     assert(timeVarGeom);
     UsdGeomPrimvarsAPI timeVarPrimvars(timeVarGeom);
 
-    UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomPoints);
+    UPDATE_USDGEOM_CACHED_ARRAYS(UpdateUsdGeomPoints);
     UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomInstanceIds);
     UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomScales);
     UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomOrientations);
     if( Settings.EnableStTexCoords && UsdGeomDataHasTexCoords(geomData) )
       { UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomTexCoords); }
-    UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomAttributes);
-    UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomColors);
+    UPDATE_USDGEOM_CACHED_PRIMVAR_ARRAYS(UpdateUsdGeomAttributes);
+    UPDATE_USDGEOM_CACHED_PRIMVAR_ARRAYS(UpdateUsdGeomColors);
     UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomProtoIndices);
     //UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomLinearVelocities);
     //UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomAngularVelocities);
@@ -1200,8 +2728,10 @@ void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, cons
   }
 }
 
-void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, const SdfPath& curvePath, const UsdBridgeCurveData& geomData, double timeStep)
+void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, UsdBridgePrimCache* cacheEntry, const UsdBridgeCurveData& geomData, double timeStep)
 {
+  const SdfPath& curvePath = cacheEntry->PrimPath;
+
   // To avoid data duplication when using of clip stages, we need to potentially use the scenestage prim for time-uniform data.
   UsdGeomBasisCurves uniformGeom = UsdGeomBasisCurves::Get(this->SceneStage, curvePath);
   assert(uniformGeom);
@@ -1217,12 +2747,12 @@ void UsdBridgeUsdWriter::UpdateUsdGeometry(const UsdStagePtr& timeVarStage, cons
 
   uint64_t numPrims = geomData.NumCurveLengths;
 
-  UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomPoints);
-  UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomNormals);
+  UPDATE_USDGEOM_CACHED_ARRAYS(UpdateUsdGeomPoints);
+  UPDATE_USDGEOM_CACHED_ARRAYS(UpdateUsdGeomNormals);
   if( Settings.EnableStTexCoords && UsdGeomDataHasTexCoords(geomData) )
     { UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomTexCoords); }
-  UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomAttributes);
-  UPDATE_USDGEOM_PRIMVAR_ARRAYS(UpdateUsdGeomColors);
+  UPDATE_USDGEOM_CACHED_PRIMVAR_ARRAYS(UpdateUsdGeomAttributes);
+  UPDATE_USDGEOM_CACHED_PRIMVAR_ARRAYS(UpdateUsdGeomColors);
   UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomWidths);
   UPDATE_USDGEOM_ARRAYS(UpdateUsdGeomCurveLengths);
 }
@@ -1239,4 +2769,45 @@ void UsdBridgeUsdWriter::UpdateUsdInstancerPrototypes(const SdfPath& instancerPa
 
   // Very basic rel update, without any timevarying aspects
   UpdateUsdGeomPrototypes(this->LogObject, this->SceneStage, uniformGeom, geomRefData, refProtoGeomPrimPaths, protoShapePathRp);
+
+  // Tiles and levels of detail of the instancer reference the same prototypes
+  for(const UsdPrim& childPrim : uniformGeom.GetPrim().GetChildren())
+  {
+    UsdGeomPointInstancer childGeom(childPrim);
+    const char* childName = childPrim.GetName().GetText();
+    if(childGeom && (std::strncmp(childName, constring::tilePf, std::strlen(constring::tilePf)) == 0
+      || std::strncmp(childName, constring::lodPf, std::strlen(constring::lodPf)) == 0))
+      CopyUsdInstancerPrototypes(uniformGeom, childGeom);
+  }
+}
+
+bool UsdBridgeUsdWriter::UpdateUsdGeometryLods(bool waitForJobs)
+{
+  if(waitForJobs)
+    LodGenerator.WaitForJobs();
+
+  std::vector<std::unique_ptr<UsdBridgeLodGenerator::Job>> finishedJobs;
+  LodGenerator.TakeFinishedJobs(finishedJobs);
+
+  for(const std::unique_ptr<UsdBridgeLodGenerator::Job>& job : finishedJobs)
+  {
+    if(job->GeomType == UsdBridgeGeomType::MESH)
+    {
+      const UsdBridgeMeshLodJob& meshJob = static_cast<const UsdBridgeMeshLodJob&>(*job);
+      std::vector<UsdBridgeMeshData> levelDatas;
+      for(const UsdBridgeMeshPartition& level : meshJob.Levels)
+        levelDatas.push_back(level.PartData);
+      UpdateUsdMeshLodLevels(job->CacheEntry, levelDatas, job->TimeStep);
+    }
+    else if(job->GeomType == UsdBridgeGeomType::INSTANCER)
+    {
+      const UsdBridgeInstancerLodJob& instancerJob = static_cast<const UsdBridgeInstancerLodJob&>(*job);
+      std::vector<UsdBridgeInstancerData> levelDatas;
+      for(const UsdBridgeInstancerTile& level : instancerJob.Levels)
+        levelDatas.push_back(level.TileData);
+      UpdateUsdInstancerLodLevels(job->CacheEntry, levelDatas, job->TimeStep);
+    }
+  }
+
+  return !finishedJobs.empty();
 }
\ No newline at end of file
@@ -1059,8 +1059,7 @@ void UsdBridgeUsdWriter::UpdateUsdMaterialManifest(const UsdBridgePrimCache* cac
   InitializeAttributeReaders_Impl(cacheEntry->ManifestStage.second, cacheEntry->PrimPath,
     Settings, matData, &timeEval);
 
-  if(this->EnableSaving)
-    cacheEntry->ManifestStage.second->Save();
+  MarkStageDirty(cacheEntry->ManifestStage.second);
 }
 
 void UsdBridgeUsdWriter::UpdateUsdSamplerManifest(const UsdBridgePrimCache* cacheEntry, const UsdBridgeSamplerData& samplerData)
@@ -1070,8 +1069,7 @@ void UsdBridgeUsdWriter::UpdateUsdSamplerManifest(const UsdBridgePrimCache* cach
   InitializeSampler_Impl(cacheEntry->ManifestStage.second, cacheEntry->PrimPath, samplerData.Type,
     false, Settings, &timeEval);
 
-  if(this->EnableSaving)
-    cacheEntry->ManifestStage.second->Save();
+  MarkStageDirty(cacheEntry->ManifestStage.second);
 }
 #endif
 
@@ -1476,16 +1474,18 @@ void UsdBridgeUsdWriter::UpdateIndexVolumeMaterial(UsdStageRefPtr sceneStage, Us
   // Set the attributes
   UsdAttribute& outAttrib = valuesTimeVarying ? timeVarTfValueAttr : uniformTfValueAttr;
   UsdTimeCode outTimeCode = valuesTimeVarying ? timeEval.TimeCode : timeEval.Default();
-  VtVec4fArray* outArray = AssignColorArrayToPrimvar(LogObject, volumeData.TfData.TfColors, volumeData.TfData.TfNumColors, volumeData.TfData.TfColorsType,
+  VtVec4fArray outArray;
+  bool assigned = AssignColorArrayToPrimvar(LogObject, volumeData.TfData.TfColors, volumeData.TfData.TfNumColors, volumeData.TfData.TfColorsType,
     outTimeCode,
     outAttrib,
-    false); // Get the pointer, set the data manually here
+    NumThreads,
+    &outArray); // Get the colors, set the data manually here
 
-  for(size_t i = 0; i < outArray->size() && i < volumeData.TfData.TfNumOpacities; ++i)
-    (*outArray)[i][3] = tfOpacities[i]; // Set the alpha channel
+  for(size_t i = 0; i < outArray.size() && i < volumeData.TfData.TfNumOpacities; ++i)
+    outArray[i][3] = tfOpacities[i]; // Set the alpha channel
 
-  if(outArray)
-    outAttrib.Set(*outArray, outTimeCode);
+  if(assigned)
+    outAttrib.Set(outArray, outTimeCode);
 
   SET_TIMEVARYING_ATTRIB(rangeTimeVarying, timeVarDomainAttr, uniformDomainAttr, valueRange);
 }
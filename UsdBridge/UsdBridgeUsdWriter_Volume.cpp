@@ -107,8 +107,7 @@ void UsdBridgeUsdWriter::UpdateUsdVolumeManifest(const UsdBridgePrimCache* cache
   InitializeIndexVolumeMaterial_Impl(volumeStage, volumePath, false, &timeEval);
 #endif
 
-  if(this->EnableSaving)
-    cacheEntry->ManifestStage.second->Save();
+  MarkStageDirty(cacheEntry->ManifestStage.second);
 }
 #endif
 
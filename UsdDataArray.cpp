@@ -4,6 +4,7 @@
 #include "UsdDataArray.h"
 #include "UsdDevice.h"
 #include "UsdAnari.h"
+#include "UsdBridgeUtils.h"
 #include "anari/frontend/type_utility.h"
 
 DEFINE_PARAMETER_MAP(UsdDataArray,
@@ -107,16 +108,30 @@ void UsdDataArray::commit(UsdDevice* device)
 
 void * UsdDataArray::map(UsdDevice * device)
 {
+  {
+    std::lock_guard<std::mutex> lock(contentHashMutex);
+    contentHashValid = false; // Contents may change until the next unmap
+  }
+
   if (anari::isObject(type))
   {
     CreateMappedObjectCopy();
   }
+  else if (privateBlock && privateBlock->isShared())
+  {
+    detachSharedData();
+  }
 
   return const_cast<void *>(data);
 }
 
 void UsdDataArray::unmap(UsdDevice * device)
 {
+  {
+    std::lock_guard<std::mutex> lock(contentHashMutex);
+    contentHashValid = false;
+  }
+
   if (anari::isObject(type))
   {
     TransferAndRemoveMappedObjectCopy();
@@ -125,6 +140,17 @@ void UsdDataArray::unmap(UsdDevice * device)
   notify(this, device); // Any objects referencing this array need to recommit
 }
 
+uint64_t UsdDataArray::GetDataHash() const
+{
+  std::lock_guard<std::mutex> lock(contentHashMutex); // Geometries sharing the array may be written concurrently
+  if (!contentHashValid)
+  {
+    contentHash = (data && !anari::isObject(type)) ? ubutils::HashData(data, dataSizeInBytes) : 0;
+    contentHashValid = true;
+  }
+  return contentHash;
+}
+
 void UsdDataArray::privatize()
 {
   if(!isPrivate)
@@ -201,7 +227,8 @@ void UsdDataArray::decRef(const ANARIObject* anariObjects, uint64_t numAnariObje
 void UsdDataArray::allocPrivateData()
 {
   // Alloc the owned memory
-  char* newData = new char[dataSizeInBytes];
+  privateBlock = new UsdDataBlock(dataSizeInBytes);
+  char* newData = privateBlock->getMemory();
   memset(newData, 0, dataSizeInBytes);
   data = newData;
 
@@ -213,14 +240,19 @@ void UsdDataArray::allocPrivateData()
 void UsdDataArray::freePrivateData(bool mappedCopy)
 {
   const void*& memToFree = mappedCopy ? mappedObjectCopy : data;
+  UsdDataBlock*& blockToFree = mappedCopy ? mappedObjectBlock : privateBlock;
 
 #ifdef CHECK_MEMLEAKS
   allocDevice->logRawDeallocation(memToFree);
 #endif
 
-  // Deallocate owned memory
-  delete[](char*)memToFree;
+  // Deallocate owned memory, or leave that to the last USD value referencing it
+  if (blockToFree)
+    blockToFree->ReleaseDataRef();
+  else
+    delete[](char*)memToFree;
   memToFree = nullptr;
+  blockToFree = nullptr;
 }
 
 void UsdDataArray::freePublicData(const void* appMemory)
@@ -245,10 +277,26 @@ void UsdDataArray::publicToPrivateData()
   // No refcount modification necessary, public refcount managed by user
 }
 
+void UsdDataArray::detachSharedData()
+{
+  // USD values still reference the private memory, so give the array a copy to write to
+  const void* sharedData = data;
+  UsdDataBlock* sharedBlock = privateBlock;
+  allocPrivateData();
+
+  std::memcpy(const_cast<void *>(data), sharedData, dataSizeInBytes);
+
+#ifdef CHECK_MEMLEAKS
+  allocDevice->logRawDeallocation(sharedData);
+#endif
+  sharedBlock->ReleaseDataRef();
+}
+
 void UsdDataArray::CreateMappedObjectCopy()
 {
   // Move the original array to a different spot and allocate new memory for the mapped object array.
   mappedObjectCopy = data;
+  mappedObjectBlock = privateBlock;
   allocPrivateData();
 
   // Transfer contents over to new memory, keep old one for managing references later on.
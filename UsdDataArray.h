@@ -7,8 +7,30 @@
 #include "UsdParameterizedObject.h"
 #include "anari/frontend/anari_enums.h"
 
+#include <atomic>
+#include <mutex>
+
 class UsdDevice;
 
+// Privately owned array memory, which USD values can keep referencing after the array has moved on to other memory
+class UsdDataBlock : public UsdBridgeDataOwner
+{
+  public:
+    UsdDataBlock(size_t sizeInBytes) : memory(new char[sizeInBytes]) {}
+
+    void AddDataRef() override { ++refCount; }
+    void ReleaseDataRef() override { if(--refCount == 0) delete this; }
+
+    bool isShared() const { return refCount > 1; }
+    char* getMemory() const { return memory; }
+
+  protected:
+    ~UsdDataBlock() { delete[] memory; }
+
+    std::atomic<int> refCount = 1;
+    char* memory;
+};
+
 struct UsdDataLayout
 {
   bool isDense() const { return byteStride1 == typeSize && byteStride2 == numItems1*byteStride1 && byteStride3 == numItems2*byteStride2; }
@@ -35,7 +57,7 @@ struct UsdDataArrayParams
   UsdSharedString* usdName = nullptr;
 };
 
-class UsdDataArray : public UsdParameterizedBaseObject<UsdDataArray, UsdDataArrayParams>
+class UsdDataArray : public UsdParameterizedBaseObject<UsdDataArray, UsdDataArrayParams>, public UsdBridgeDataHashSource
 {
   public:
     UsdDataArray(const void *appMemory,
@@ -86,6 +108,13 @@ class UsdDataArray : public UsdParameterizedBaseObject<UsdDataArray, UsdDataArra
 
     size_t getDataSizeInBytes() const { return dataSizeInBytes; }
 
+    // Hash of the data contents, computed on the first request after the array has been created or mapped.
+    // Writes through a mapped pointer retained after unmap, or to shared application memory outside of map/unmap, are not detected.
+    uint64_t GetDataHash() const override;
+
+    // Owner of the memory returned by getData(), if it can be referenced directly by USD values (see UsdBridgeDataOwner)
+    UsdBridgeDataOwner* getDataOwner() const { return (!anari::isObject(type) && layout.isDense()) ? privateBlock : nullptr; }
+
   protected:
     bool deferCommit(UsdDevice* device) override { return false; }
     bool doCommitData(UsdDevice* device) override { return false; }
@@ -108,12 +137,14 @@ class UsdDataArray : public UsdParameterizedBaseObject<UsdDataArray, UsdDataArra
     void freePrivateData(bool mappedCopy = false);
     void freePublicData(const void* appMemory);
     void publicToPrivateData();
+    void detachSharedData();
 
     // Mapped memory management
     void CreateMappedObjectCopy();
     void TransferAndRemoveMappedObjectCopy();
 
     const void* data = nullptr;
+    UsdDataBlock* privateBlock = nullptr; // Owns data if private
     ANARIMemoryDeleter dataDeleter = nullptr;
     const void* deleterUserData = nullptr;
     ANARIDataType type;
@@ -121,7 +152,12 @@ class UsdDataArray : public UsdParameterizedBaseObject<UsdDataArray, UsdDataArra
     size_t dataSizeInBytes;
     bool isPrivate;
 
+    mutable uint64_t contentHash = 0;
+    mutable bool contentHashValid = false;
+    mutable std::mutex contentHashMutex;
+
     const void* mappedObjectCopy;
+    UsdDataBlock* mappedObjectBlock = nullptr;
 
 #ifdef CHECK_MEMLEAKS
     UsdDevice* allocDevice;
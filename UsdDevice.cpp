@@ -18,6 +18,7 @@
 #include "UsdLight.h"
 #include "UsdCamera.h"
 #include "UsdDeviceQueries.h"
+#include "UsdBridgeUtils.h"
 
 #include <cstdarg>
 #include <cstdio>
@@ -34,6 +35,13 @@ class UsdDeviceInternals
 public:
   UsdDeviceInternals()
   {
+    ubutils::AcquireThreadPool();
+  }
+
+  ~UsdDeviceInternals()
+  {
+    bridge = nullptr; // Its background threads may still use the thread pool
+    ubutils::ReleaseThreadPool();
   }
 
   bool CreateNewBridge(const UsdDeviceData& deviceParams, UsdBridgeLogCallback bridgeStatusFunc, void* userData)
@@ -41,13 +49,21 @@ public:
     if (bridge.get())
       bridge->CloseSession();
 
+    const char* outputPrecision = UsdSharedString::c_str(deviceParams.outputPrecision);
+    bool halfPrecisionOutput = outputPrecision && strEquals(outputPrecision, "half");
+    if(outputPrecision && !halfPrecisionOutput && !strEquals(outputPrecision, "full"))
+      bridgeStatusFunc(UsdBridgeLogLevel::WARNING, userData, "usd::output.precision should be \"full\" or \"half\", defaulting to full precision output.");
+
     UsdBridgeSettings bridgeSettings = {
       UsdSharedString::c_str(deviceParams.hostName),
       outputLocation.c_str(),
       deviceParams.createNewSession,
       deviceParams.outputBinary,
+      deviceParams.timestepsPerLayer > 0 ? static_cast<uint32_t>(deviceParams.timestepsPerLayer) : 0u,
       deviceParams.outputPreviewSurfaceShader,
-      deviceParams.outputMdlShader
+      deviceParams.outputMdlShader,
+      deviceParams.outputIndexedPrimvars,
+      halfPrecisionOutput
     };
 
     bridge = std::make_unique<UsdBridge>(bridgeSettings);
@@ -86,17 +102,29 @@ DEFINE_PARAMETER_MAP(UsdDevice,
   REGISTER_PARAMETER_MACRO("usd::serialize.location", ANARI_STRING, outputPath)
   REGISTER_PARAMETER_MACRO("usd::serialize.newSession", ANARI_BOOL, createNewSession)
   REGISTER_PARAMETER_MACRO("usd::serialize.outputBinary", ANARI_BOOL, outputBinary)
+  REGISTER_PARAMETER_MACRO("usd::serialize.async", ANARI_BOOL, asyncSave)
+  REGISTER_PARAMETER_MACRO("usd::serialize.asyncMaxFrames", ANARI_INT32, asyncMaxFrames)
+  REGISTER_PARAMETER_MACRO("usd::serialize.timestepsPerLayer", ANARI_INT32, timestepsPerLayer)
   REGISTER_PARAMETER_MACRO("usd::time", ANARI_FLOAT64, timeStep)
   REGISTER_PARAMETER_MACRO("usd::writeAtCommit", ANARI_BOOL, writeAtCommit)
+  REGISTER_PARAMETER_MACRO("usd::flush.threads", ANARI_INT32, flushThreads)
+  REGISTER_PARAMETER_MACRO("usd::memory.scratchLimit", ANARI_UINT64, scratchMemoryLimit)
+  REGISTER_PARAMETER_MACRO("usd::memory.keepTimesteps", ANARI_INT32, keepTimesteps)
+  REGISTER_PARAMETER_MACRO("usd::lod.ratios", ANARI_FLOAT32_VEC4, lodRatios)
+  REGISTER_PARAMETER_MACRO("usd::lod.minPrimitives", ANARI_UINT64, lodMinPrimitives)
+  REGISTER_PARAMETER_MACRO("usd::garbageCollect.timeBudget", ANARI_FLOAT32, garbageCollectTimeBudget)
   REGISTER_PARAMETER_MACRO("usd::output.material", ANARI_BOOL, outputMaterial)
   REGISTER_PARAMETER_MACRO("usd::output.previewSurfaceShader", ANARI_BOOL, outputPreviewSurfaceShader)
   REGISTER_PARAMETER_MACRO("usd::output.mdlShader", ANARI_BOOL, outputMdlShader)
+  REGISTER_PARAMETER_MACRO("usd::output.indexedPrimvars", ANARI_BOOL, outputIndexedPrimvars)
+  REGISTER_PARAMETER_MACRO("usd::output.precision", ANARI_STRING, outputPrecision)
 )
 
 void UsdDevice::clearDeviceParameters()
 {
   filterResetParam("usd::serialize.hostName");
   filterResetParam("usd::serialize.location");
+  filterResetParam("usd::output.precision");
   transferWriteToReadParams();
 }
 //----
@@ -205,7 +233,7 @@ void UsdDevice::filterSetParam(
   {
     // Perform garbage collection on usd objects (needs to move into the user interface)
     if(internals->bridge)
-      internals->bridge->GarbageCollect();
+      internals->bridge->GarbageCollect(getReadParams().garbageCollectTimeBudget);
   }
   else if(strEquals(name, "usd::removeUnusedNames"))
   {
@@ -265,6 +293,9 @@ void UsdDevice::commit(UsdDevice* device)
 {
   transferWriteToReadParams();
 
+  int flushThreads = getReadParams().flushThreads;
+  numThreads = flushThreads > 0 ? static_cast<unsigned int>(flushThreads) : 0u;
+
   if(!bridgeInitAttempt)
   {
     initializeBridge();
@@ -273,6 +304,10 @@ void UsdDevice::commit(UsdDevice* device)
   {
     const UsdDeviceData& paramData = getReadParams();
     internals->bridge->UpdateBeginEndTime(paramData.timeStep);
+    internals->bridge->SetScratchMemoryLimit(paramData.scratchMemoryLimit);
+    internals->bridge->SetLodSettings(paramData.lodRatios.Data, 4, paramData.lodMinPrimitives);
+    internals->bridge->SetKeepTimeSteps(paramData.keepTimesteps > 0 ? static_cast<uint32_t>(paramData.keepTimesteps) : 0u);
+    internals->bridge->SetNumThreads(numThreads);
   }
 }
 
@@ -308,6 +343,13 @@ void UsdDevice::initializeBridge()
   {
     reportStatus(this, ANARI_DEVICE, ANARI_SEVERITY_ERROR, ANARI_STATUS_UNKNOWN_ERROR, "Usd Bridge failed to load");
   }
+  else
+  {
+    internals->bridge->SetScratchMemoryLimit(paramData.scratchMemoryLimit);
+    internals->bridge->SetLodSettings(paramData.lodRatios.Data, 4, paramData.lodMinPrimitives);
+    internals->bridge->SetKeepTimeSteps(paramData.keepTimesteps > 0 ? static_cast<uint32_t>(paramData.keepTimesteps) : 0u);
+    internals->bridge->SetNumThreads(numThreads);
+  }
 }
 
 ANARIArray UsdDevice::CreateDataArray(const void *appMemory,
@@ -570,6 +612,20 @@ void UsdDevice::renderFrame(ANARIFrame frame)
     AnariToUsdObjectPtr(frame)->saveUsd(this);
 }
 
+int UsdDevice::frameReady(ANARIFrame frame, ANARIWaitMask waitMask)
+{
+  if(!frame || !isInitialized())
+    return 1;
+
+  return AnariToUsdObjectPtr(frame)->isReady(this, waitMask == ANARI_WAIT) ? 1 : 0;
+}
+
+void UsdDevice::discardFrame(ANARIFrame frame)
+{
+  if(frame && isInitialized())
+    AnariToUsdObjectPtr(frame)->discard(this);
+}
+
 const char* UsdDevice::makeUniqueName(const char* name)
 {
   std::string proposedBaseName(name);
@@ -604,12 +660,30 @@ void UsdDevice::addToCommitList(UsdBaseObject* object, bool commitData)
     this->reportStatus(object, object->getType(), ANARI_SEVERITY_FATAL_ERROR, ANARI_STATUS_INVALID_OPERATION,
       "Usd device internal error; addToCommitList called while list is locked");
   }
-  else
+  else if(!object->inCommitList)
   {
-    auto it = std::find_if(commitList.begin(), commitList.end(),
-      [&object](const CommitListType& entry) -> bool { return entry.first.ptr == object; });
-    if(it == commitList.end())
-      commitList.emplace_back(CommitListType(object, commitData));
+    object->inCommitList = true;
+    commitLists[getCommitListIndex(object->getType())].emplace_back(CommitListType(object, commitData));
+  }
+}
+
+int UsdDevice::getCommitListIndex(ANARIDataType type)
+{
+  // Same order as the writeTypeToUsd calls in flushCommitList
+  switch(type)
+  {
+    case ANARI_SAMPLER: return 0;
+    case ANARI_SPATIAL_FIELD: return 1;
+    case ANARI_GEOMETRY: return 2;
+    case ANARI_LIGHT: return 3;
+    case ANARI_MATERIAL: return 4;
+    case ANARI_SURFACE: return 5;
+    case ANARI_VOLUME: return 6;
+    case ANARI_GROUP: return 7;
+    case ANARI_INSTANCE: return 8;
+    case ANARI_WORLD: return 9;
+    case ANARI_CAMERA: return 10;
+    default: return NUM_COMMIT_LISTS-1;
   }
 }
 
@@ -617,20 +691,26 @@ void UsdDevice::clearCommitList()
 {
   removePrimsFromUsd(true); // removeList pointers are taken from commitlist
 
-#ifdef CHECK_MEMLEAKS
-  for(auto& commitEntry : commitList)
+  for(auto& commitList : commitLists)
   {
-    logObjDeallocation(commitEntry.first.ptr);
-  }
+    for(auto& commitEntry : commitList)
+    {
+#ifdef CHECK_MEMLEAKS
+      logObjDeallocation(commitEntry.first.ptr);
 #endif
+      commitEntry.first->inCommitList = false;
+    }
 
-  commitList.resize(0);
+    commitList.resize(0);
+  }
 }
 
 void UsdDevice::flushCommitList()
 {
   lockCommitList = true;
 
+  convertCommitListData();
+
   writeTypeToUsd<(int)ANARI_SAMPLER>();
 
   writeTypeToUsd<(int)ANARI_SPATIAL_FIELD>();
@@ -655,6 +735,28 @@ void UsdDevice::flushCommitList()
   lockCommitList = false;
 }
 
+void UsdDevice::convertCommitListData()
+{
+  // Serially select the objects which have data to convert before writing to USD
+  for(auto& commitList : commitLists)
+  {
+    for(auto& objCommitPair : commitList)
+    {
+      UsdBaseObject* object = objCommitPair.first.ptr;
+      bool commitData = objCommitPair.second;
+
+      if(commitData && object->prepareCommitData(this))
+        convertList.push_back(object);
+    }
+  }
+
+  // The conversions don't touch USD, so they can be distributed over the worker threads (usd::flush.threads)
+  ubutils::ParallelFor(convertList.size(), numThreads,
+    [this](size_t objIdx) { convertList[objIdx]->convertCommitData(this); });
+
+  convertList.resize(0);
+}
+
 void UsdDevice::addToVolumeList(UsdVolume* volume)
 {
   auto it = std::find(volumeList.begin(), volumeList.end(), volume);
@@ -685,34 +787,33 @@ void UsdDevice::removeFromVolumeList(UsdVolume* volume)
 template<int typeInt>
 void UsdDevice::writeTypeToUsd()
 {
-  for(auto objCommitPair : commitList)
+  using ObjectType = typename AnariToUsdBridgedObject<typeInt>::Type;
+
+  for(auto& objCommitPair : commitLists[getCommitListIndex((ANARIDataType)typeInt)])
   {
-    auto object = objCommitPair.first;
+    auto& object = objCommitPair.first;
     bool commitData = objCommitPair.second;
 
-    if((int)object->getType() == typeInt)
-    {
-      using ObjectType = typename AnariToUsdBridgedObject<typeInt>::Type;
-      ObjectType* typedObj = reinterpret_cast<ObjectType*>(object.ptr);
+    assert((int)object->getType() == typeInt);
+    ObjectType* typedObj = reinterpret_cast<ObjectType*>(object.ptr);
 
-      if(!object->deferCommit(this))
-      {
-        bool commitRefs = true;
-        if(commitData)
-          commitRefs = object->doCommitData(this);
-        if(commitRefs)
-          object->doCommitRefs(this);
-      }
-      else
-      {
-        this->reportStatus(object.ptr, object->getType(), ANARI_SEVERITY_ERROR, ANARI_STATUS_INVALID_OPERATION,
-          "User forgot to at least once commit an ANARI child object of parent object '%s'", typedObj->getName());
-      }
+    if(!object->deferCommit(this))
+    {
+      bool commitRefs = true;
+      if(commitData)
+        commitRefs = object->doCommitData(this);
+      if(commitRefs)
+        object->doCommitRefs(this);
+    }
+    else
+    {
+      this->reportStatus(object.ptr, object->getType(), ANARI_SEVERITY_ERROR, ANARI_STATUS_INVALID_OPERATION,
+        "User forgot to at least once commit an ANARI child object of parent object '%s'", typedObj->getName());
+    }
 
-      if(typedObj->getRemovePrim())
-      {
-        removeList.push_back(object.ptr); // Just raw pointer, removeList is purged upon commitList clear
-      }
+    if(typedObj->getRemovePrim())
+    {
+      removeList.push_back(object.ptr); // Just raw pointer, removeList is purged upon commitList clear
     }
   }
 }
@@ -778,6 +879,14 @@ int UsdDevice::getProperty(ANARIObject object,
       writeToVoidP(mem, maxIndex);
       return 1;
     }
+    else if ((strEquals(name, "usd::memory.scratchBytes") || strEquals(name, "usd::memory.scratchPeakBytes")) && type == ANARI_UINT64)
+    {
+      uint64_t currentBytes = 0, peakBytes = 0;
+      if(internals->bridge)
+        internals->bridge->GetScratchMemoryUsage(currentBytes, peakBytes);
+      writeToVoidP(mem, strEquals(name, "usd::memory.scratchBytes") ? currentBytes : peakBytes);
+      return 1;
+    }
     else if (strEquals(name, "extension") && type == ANARI_STRING_LIST)
     {
       writeToVoidP(mem, anari::usd::query_extensions());
@@ -808,7 +917,10 @@ const void * UsdDevice::frameBufferMap(
   ANARIDataType *pixelType)
 {
   if (fb)
+  {
+    frameReady(fb, ANARI_WAIT); // Mapping implies waiting for the frame to finish
     return AnariToUsdObjectPtr(fb)->mapBuffer(channel, width, height, pixelType);
+  }
   return nullptr;
 }
 
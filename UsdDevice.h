@@ -39,12 +39,23 @@ struct UsdDeviceData
   bool createNewSession = true;
   bool outputBinary = false;
   bool writeAtCommit = false;
+  int flushThreads = 0; // Worker threads for the conversion phase of flushCommitList, 0 for hardware concurrency
+  bool asyncSave = false; // Write the scene to disk on a background thread after anariRenderFrame
+  int asyncMaxFrames = 2; // Maximum number of frames with outstanding saves before anariRenderFrame blocks
+  int timestepsPerLayer = 0; // Timesteps per layer holding the scene's time samples, 0 keeps them in the scene layer
+  uint64_t scratchMemoryLimit = uint64_t(64) << 20; // Bytes of temporary conversion memory kept in between frames
+  int keepTimesteps = 0; // Clip stages per object kept in memory once saved, 0 keeps all
+  UsdFloat4 lodRatios = {0.0f, 0.0f, 0.0f, 0.0f}; // Primitive count ratio per generated level of detail, 0 terminates
+  uint64_t lodMinPrimitives = 65536; // Geometries with fewer primitives get no levels of detail
+  float garbageCollectTimeBudget = 0.0f; // Milliseconds spent per usd::garbageCollect, 0 for no limit
 
   double timeStep = 0.0;
 
   bool outputMaterial = true;
   bool outputPreviewSurfaceShader = true;
   bool outputMdlShader = true;
+  bool outputIndexedPrimvars = false;
+  UsdSharedString* outputPrecision = nullptr; // "full" or "half"
 };
 
 class UsdDevice : public anari::DeviceImpl, public UsdParameterizedBaseObject<UsdDevice, UsdDeviceData>
@@ -189,8 +200,8 @@ class UsdDevice : public anari::DeviceImpl, public UsdParameterizedBaseObject<Us
     ANARIRenderer newRenderer(const char *type) override;
 
     void renderFrame(ANARIFrame frame) override;
-    int frameReady(ANARIFrame, ANARIWaitMask) override { return 1; }
-    void discardFrame(ANARIFrame) override {}
+    int frameReady(ANARIFrame frame, ANARIWaitMask waitMask) override;
+    void discardFrame(ANARIFrame frame) override;
 
     // UsdParameterizedBaseObject interface ///////////////////////////////////////////////////////////
 
@@ -216,6 +227,7 @@ class UsdDevice : public anari::DeviceImpl, public UsdParameterizedBaseObject<Us
 
     void addToCommitList(UsdBaseObject* object, bool commitData);
     bool isFlushingCommitList() const { return lockCommitList; }
+    unsigned int getNumThreads() const { return numThreads; } // From usd::flush.threads, as passed to ubutils::ParallelFor
 
     void addToVolumeList(UsdVolume* volume);
     void removeFromVolumeList(UsdVolume* volume);
@@ -269,6 +281,7 @@ class UsdDevice : public anari::DeviceImpl, public UsdParameterizedBaseObject<Us
 
     void clearCommitList();
     void flushCommitList();
+    void convertCommitListData();
     void clearDeviceParameters();
     void clearResourceStringList();
 
@@ -299,11 +312,18 @@ class UsdDevice : public anari::DeviceImpl, public UsdParameterizedBaseObject<Us
     // Using object pointers as basis for deferred commits; another option would be to traverse
     // the bridge's internal cache handles, but a handle may map to multiple objects (with the same name)
     // so that's not 1-1 with the effects of a non-deferred commit order.
+    // The commit list is bucketed per object type (see getCommitListIndex), so flushCommitList can write out
+    // the types in dependency order without scanning; objects of unlisted types are only kept alive until the flush.
+    static constexpr int NUM_COMMIT_LISTS = 12;
+    static int getCommitListIndex(ANARIDataType type);
+
     using CommitListType = std::pair<helium::IntrusivePtr<UsdBaseObject>, bool>;
-    std::vector<CommitListType> commitList;
+    std::vector<CommitListType> commitLists[NUM_COMMIT_LISTS];
     std::vector<UsdBaseObject*> removeList;
+    std::vector<UsdBaseObject*> convertList; // Objects with a conversion phase during flushCommitList, pointers taken from commitLists
     std::vector<UsdVolume*> volumeList; // Tracks all volumes to auto-commit when child fields have been committed
     bool lockCommitList = false;
+    unsigned int numThreads = 0;
 
     std::vector<helium::IntrusivePtr<UsdSharedString>> resourceStringList;
 
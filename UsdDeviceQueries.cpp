@@ -32,7 +32,7 @@ static int subtype_hash(const char *str) {
    return -1;
 }
 static int param_hash(const char *str) {
-   static const uint32_t table[] = {0x756c0017u,0x62610055u,0x7061005eu,0x6a6100f6u,0x6e6d010au,0x70610112u,0x7365012bu,0x0u,0x736d0144u,0x0u,0x0u,0x6a690263u,0x66610268u,0x7061027bu,0x76630295u,0x736f02dbu,0x0u,0x7061032bu,0x7663034eu,0x73680480u,0x746e04a9u,0x70610840u,0x736f0918u,0x71700020u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x71700038u,0x7574003du,0x69680021u,0x62610022u,0x4e430023u,0x7675002eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0034u,0x7574002fu,0x706f0030u,0x67660031u,0x67660032u,0x1000033u,0x80000000u,0x65640035u,0x66650036u,0x1000037u,0x80000001u,0x66650039u,0x6463003au,0x7574003bu,0x100003cu,0x80000002u,0x6665003eu,0x6f6e003fu,0x76750040u,0x62610041u,0x75740042u,0x6a690043u,0x706f0044u,0x6f6e0045u,0x45430046u,0x706f0048u,0x6a69004du,0x6d6c0049u,0x706f004au,0x7372004bu,0x100004cu,0x80000003u,0x7473004eu,0x7574004fu,0x62610050u,0x6f6e0051u,0x64630052u,0x66650053u,0x1000054u,0x80000004u,0x74730056u,0x66650057u,0x44430058u,0x706f0059u,0x6d6c005au,0x706f005bu,0x7372005cu,0x100005du,0x80000005u,0x716d006du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610077u,0x0u,0x0u,0x0u,0x66650089u,0x0u,0x0u,0x6d6c00f2u,0x66650071u,0x0u,0x0u,0x74730075u,0x73720072u,0x62610073u,0x1000074u,0x80000006u,0x1000076u,0x80000007u,0x6f6e0078u,0x6f6e0079u,0x6665007au,0x6d6c007bu,0x2f2e007cu,0x6563007du,0x706f007fu,0x66650084u,0x6d6c0080u,0x706f0081u,0x73720082u,0x1000083u,0x80000008u,0x71700085u,0x75740086u,0x69680087u,0x1000088u,0x80000009u,0x6261008au,0x7372008bu,0x6463008cu,0x706f008du,0x6261008eu,0x7574008fu,0x53000090u,0x8000000au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f00e3u,0x0u,0x0u,0x0u,0x706f00e9u,0x737200e4u,0x6e6d00e5u,0x626100e6u,0x6d6c00e7u,0x10000e8u,0x8000000bu,0x767500eau,0x686700ebu,0x696800ecu,0x6f6e00edu,0x666500eeu,0x747300efu,0x747300f0u,0x10000f1u,0x8000000cu,0x706f00f3u,0x737200f4u,0x10000f5u,0x8000000du,0x757400ffu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720102u,0x62610100u,0x1000101u,0x8000000eu,0x66650103u,0x64630104u,0x75740105u,0x6a690106u,0x706f0107u,0x6f6e0108u,0x1000109u,0x8000000fu,0x6a69010bu,0x7473010cu,0x7473010du,0x6a69010eu,0x7776010fu,0x66650110u,0x1000111u,0x80000010u,0x73720121u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0123u,0x0u,0x0u,0x0u,0x0u,0x0u,0x77760128u,0x1000122u,0x80000011u,0x75740124u,0x66650125u,0x73720126u,0x1000127u,0x80000012u,0x7a790129u,0x100012au,0x80000013u,0x706f0139u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0140u,0x6e6d013au,0x6665013bu,0x7574013cu,0x7372013du,0x7a79013eu,0x100013fu,0x80000014u,0x76750141u,0x71700142u,0x1000143u,0x80000015u,0x6261014au,0x744101a6u,0x737201f7u,0x0u,0x0u,0x6a6901f9u,0x6867014bu,0x6665014cu,0x5300014du,0x80000016u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666501a0u,0x686701a1u,0x6a6901a2u,0x706f01a3u,0x6f6e01a4u,0x10001a5u,0x80000017u,0x757401d9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x676601e2u,0x0u,0x0u,0x0u,0x0u,0x737201e8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757401f1u,0x757401dau,0x737201dbu,0x6a6901dcu,0x636201ddu,0x767501deu,0x757401dfu,0x666501e0u,0x10001e1u,0x80000018u,0x676601e3u,0x747301e4u,0x666501e5u,0x757401e6u,0x10001e7u,0x80000019u,0x626101e9u,0x6f6e01eau,0x747301ebu,0x676601ecu,0x706f01edu,0x737201eeu,0x6e6d01efu,0x10001f0u,0x8000001au,0x626101f2u,0x6f6e01f3u,0x646301f4u,0x666501f5u,0x10001f6u,0x8000001bu,0x10001f8u,0x8000001cu,0x656401fau,0x666501fbu,0x747301fcu,0x646301fdu,0x666501feu,0x6f6e01ffu,0x64630200u,0x66650201u,0x55000202u,0x8000001du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0257u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6968025au,0x73720258u,0x1000259u,0x8000001eu,0x6a69025bu,0x6463025cu,0x6c6b025du,0x6f6e025eu,0x6665025fu,0x74730260u,0x74730261u,0x1000262u,0x8000001fu,0x68670264u,0x69680265u,0x75740266u,0x1000267u,0x80000020u,0x7574026du,0x0u,0x0u,0x0u,0x75740274u,0x6665026eu,0x7372026fu,0x6a690270u,0x62610271u,0x6d6c0272u,0x1000273u,0x80000021u,0x62610275u,0x6d6c0276u,0x6d6c0277u,0x6a690278u,0x64630279u,0x100027au,0x80000022u,0x6e6d028au,0x0u,0x0u,0x0u,0x6261028du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720290u,0x6665028bu,0x100028cu,0x80000023u,0x7372028eu,0x100028fu,0x80000024u,0x6e6d0291u,0x62610292u,0x6d6c0293u,0x1000294u,0x80000025u,0x646302a8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626102b0u,0x0u,0x6a6902b6u,0x0u,0x0u,0x757402c5u,0x6d6c02a9u,0x767502aau,0x747302abu,0x6a6902acu,0x706f02adu,0x6f6e02aeu,0x10002afu,0x80000026u,0x646302b1u,0x6a6902b2u,0x757402b3u,0x7a7902b4u,0x10002b5u,0x80000027u,0x686502b7u,0x6f6e02bau,0x0u,0x6a6902c2u,0x757402bbu,0x626102bcu,0x757402bdu,0x6a6902beu,0x706f02bfu,0x6f6e02c0u,0x10002c1u,0x80000028u,0x6f6e02c3u,0x10002c4u,0x80000029u,0x554f02c6u,0x676602ccu,0x0u,0x0u,0x0u,0x0u,0x737202d2u,0x676602cdu,0x747302ceu,0x666502cfu,0x757402d0u,0x10002d1u,0x8000002au,0x626102d3u,0x6f6e02d4u,0x747302d5u,0x676602d6u,0x706f02d7u,0x737202d8u,0x6e6d02d9u,0x10002dau,0x8000002bu,0x747302dfu,0x0u,0x0u,0x6a6902e6u,0x6a6902e0u,0x757402e1u,0x6a6902e2u,0x706f02e3u,0x6f6e02e4u,0x10002e5u,0x8000002cu,0x6e6d02e7u,0x6a6902e8u,0x757402e9u,0x6a6902eau,0x777602ebu,0x666502ecu,0x2f2e02edu,0x736102eeu,0x75740300u,0x0u,0x706f0310u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f640315u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610325u,0x75740301u,0x73720302u,0x6a690303u,0x63620304u,0x76750305u,0x75740306u,0x66650307u,0x34300308u,0x100030cu,0x100030du,0x100030eu,0x100030fu,0x8000002du,0x8000002eu,0x8000002fu,0x80000030u,0x6d6c0311u,0x706f0312u,0x73720313u,0x1000314u,0x80000031u,0x1000320u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640321u,0x80000032u,0x66650322u,0x79780323u,0x1000324u,0x80000033u,0x65640326u,0x6a690327u,0x76750328u,0x74730329u,0x100032au,0x80000034u,0x6564033au,0x0u,0x0u,0x0u,0x6f6e033fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x76750346u,0x6a69033bu,0x7675033cu,0x7473033du,0x100033eu,0x80000035u,0x65640340u,0x66650341u,0x73720342u,0x66650343u,0x73720344u,0x1000345u,0x80000036u,0x68670347u,0x69680348u,0x6f6e0349u,0x6665034au,0x7473034bu,0x7473034cu,0x100034du,0x80000037u,0x62610361u,0x0u,0x0u,0x0u,0x0u,0x66610365u,0x7b7a03b5u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666103b8u,0x0u,0x0u,0x0u,0x62610410u,0x7372047au,0x6d6c0362u,0x66650363u,0x1000364u,0x80000038u,0x7170036au,0x0u,0x0u,0x0u,0x66650395u,0x6665036bu,0x5547036cu,0x6665037au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7a720382u,0x706f037bu,0x6e6d037cu,0x6665037du,0x7574037eu,0x7372037fu,0x7a790380u,0x1000381u,0x80000039u,0x6261038au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x71700392u,0x6f6e038bu,0x7473038cu,0x6766038du,0x706f038eu,0x7372038fu,0x6e6d0390u,0x1000391u,0x8000003au,0x66650393u,0x1000394u,0x8000003bu,0x6f6e0396u,0x53430397u,0x706f03a7u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f03acu,0x6d6c03a8u,0x706f03a9u,0x737203aau,0x10003abu,0x8000003cu,0x767503adu,0x686703aeu,0x696803afu,0x6f6e03b0u,0x666503b1u,0x747303b2u,0x747303b3u,0x10003b4u,0x8000003du,0x666503b6u,0x10003b7u,0x8000003eu,0x646303bdu,0x0u,0x0u,0x0u,0x646303c2u,0x6a6903beu,0x6f6e03bfu,0x686703c0u,0x10003c1u,0x8000003fu,0x767503c3u,0x6d6c03c4u,0x626103c5u,0x737203c6u,0x440003c7u,0x80000040u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f040bu,0x6d6c040cu,0x706f040du,0x7372040eu,0x100040fu,0x80000041u,0x75740411u,0x76750412u,0x74730413u,0x44430414u,0x62610415u,0x6d6c0416u,0x6d6c0417u,0x63620418u,0x62610419u,0x6463041au,0x6c6b041bu,0x5600041cu,0x80000042u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730472u,0x66650473u,0x73720474u,0x45440475u,0x62610476u,0x75740477u,0x62610478u,0x1000479u,0x80000043u,0x6766047bu,0x6261047cu,0x6463047du,0x6665047eu,0x100047fu,0x80000044u,0x6a69048bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610493u,0x6463048cu,0x6c6b048du,0x6f6e048eu,0x6665048fu,0x74730490u,0x74730491u,0x1000492u,0x80000045u,0x6f6e0494u,0x74730495u,0x6e660496u,0x706f049eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6904a2u,0x7372049fu,0x6e6d04a0u,0x10004a1u,0x80000046u,0x747304a3u,0x747304a4u,0x6a6904a5u,0x706f04a6u,0x6f6e04a7u,0x10004a8u,0x80000047u,0x6a6904afu,0x0u,0x10004bau,0x0u,0x0u,0x656404bbu,0x757404b0u,0x454404b1u,0x6a6904b2u,0x747304b3u,0x757404b4u,0x626104b5u,0x6f6e04b6u,0x646304b7u,0x666504b8u,0x10004b9u,0x80000048u,0x80000049u,0x3b3a04bcu,0x3b3a04bdu,0x786104beu,0x757404d5u,0x0u,0x706f04f9u,0x0u,0x6f6e0510u,0x0u,0x6261051cu,0x0u,0x6e6d052au,0x0u,0x0u,0x0u,0x0u,0x0u,0x76750532u,0x73720563u,0x0u,0x66650570u,0x6663058au,0x6a6905ccu,0x74730823u,0x0u,0x73720833u,0x757404d6u,0x737204d7u,0x6a6904d8u,0x636204d9u,0x767504dau,0x757404dbu,0x666504dcu,0x343004ddu,0x2f2e04e1u,0x2f2e04e7u,0x2f2e04edu,0x2f2e04f3u,0x6f6e04e2u,0x626104e3u,0x6e6d04e4u,0x666504e5u,0x10004e6u,0x8000004au,0x6f6e04e8u,0x626104e9u,0x6e6d04eau,0x666504ebu,0x10004ecu,0x8000004bu,0x6f6e04eeu,0x626104efu,0x6e6d04f0u,0x666504f1u,0x10004f2u,0x8000004cu,0x6f6e04f4u,0x626104f5u,0x6e6d04f6u,0x666504f7u,0x10004f8u,0x8000004du,0x6f6e04fau,0x6f6e04fbu,0x666504fcu,0x646304fdu,0x757404feu,0x6a6904ffu,0x706f0500u,0x6f6e0501u,0x2f2e0502u,0x6d6c0503u,0x706f0504u,0x68670505u,0x57560506u,0x66650507u,0x73720508u,0x63620509u,0x706f050au,0x7473050bu,0x6a69050cu,0x7574050du,0x7a79050eu,0x100050fu,0x8000004eu,0x62610511u,0x63620512u,0x6d6c0513u,0x66650514u,0x54530515u,0x62610516u,0x77760517u,0x6a690518u,0x6f6e0519u,0x6867051au,0x100051bu,0x8000004fu,0x7372051du,0x6362051eu,0x6261051fu,0x68670520u,0x66650521u,0x44430522u,0x706f0523u,0x6d6c0524u,0x6d6c0525u,0x66650526u,0x64630527u,0x75740528u,0x1000529u,0x80000050u,0x6261052bu,0x6867052cu,0x6665052du,0x5655052eu,0x7372052fu,0x6d6c0530u,0x1000531u,0x80000051u,0x75740533u,0x71700534u,0x76750535u,0x75740536u,0x2f2e0537u,0x716d0538u,0x6561053cu,0x0u,0x0u,0x7372054fu,0x75740540u,0x0u,0x0u,0x6d6c0547u,0x66650541u,0x73720542u,0x6a690543u,0x62610544u,0x6d6c0545u,0x1000546u,0x80000052u,0x54530548u,0x69680549u,0x6261054au,0x6564054bu,0x6665054cu,0x7372054du,0x100054eu,0x80000053u,0x66650550u,0x77760551u,0x6a690552u,0x66650553u,0x78770554u,0x54530555u,0x76750556u,0x73720557u,0x67660558u,0x62610559u,0x6463055au,0x6665055bu,0x5453055cu,0x6968055du,0x6261055eu,0x6564055fu,0x66650560u,0x73720561u,0x1000562u,0x80000054u,0x66650564u,0x44430565u,0x6d6c0566u,0x62610567u,0x74730568u,0x74730569u,0x6a69056au,0x6766056bu,0x6a69056cu,0x6665056du,0x6564056eu,0x100056fu,0x80000055u,0x6e6d0571u,0x706f0572u,0x77760573u,0x66650574u,0x56500575u,0x7372057bu,0x0u,0x0u,0x0u,0x0u,0x6f6e057fu,0x6a69057cu,0x6e6d057du,0x100057eu,0x80000056u,0x76750580u,0x74730581u,0x66650582u,0x65640583u,0x4f4e0584u,0x62610585u,0x6e6d0586u,0x66650587u,0x74730588u,0x1000589u,0x80000057u,0x6665058du,0x0u,0x73720596u,0x6f6e058eu,0x6665058fu,0x54530590u,0x75740591u,0x62610592u,0x68670593u,0x66650594u,0x1000595u,0x80000058u,0x6a690597u,0x62610598u,0x6d6c0599u,0x6a69059au,0x7b7a059bu,0x6665059cu,0x2f2e059du,0x7068059eu,0x706f05a6u,0x0u,0x0u,0x0u,0x706f05aeu,0x0u,0x666505b6u,0x767505c0u,0x747305a7u,0x757405a8u,0x4f4e05a9u,0x626105aau,0x6e6d05abu,0x666505acu,0x10005adu,0x80000059u,0x646305afu,0x626105b0u,0x757405b1u,0x6a6905b2u,0x706f05b3u,0x6f6e05b4u,0x10005b5u,0x8000005au,0x787705b7u,0x545305b8u,0x666505b9u,0x747305bau,0x747305bbu,0x6a6905bcu,0x706f05bdu,0x6f6e05beu,0x10005bfu,0x8000005bu,0x757405c1u,0x717005c2u,0x767505c3u,0x757405c4u,0x434205c5u,0x6a6905c6u,0x6f6e05c7u,0x626105c8u,0x737205c9u,0x7a7905cau,0x10005cbu,0x8000005cu,0x6e6d05cdu,0x666505ceu,0x570005cfu,0x8000005du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x77670626u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626106a7u,0x66650636u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261063eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x69610646u,0x0u,0x0u,0x626106a2u,0x706f0637u,0x6e6d0638u,0x66650639u,0x7574063au,0x7372063bu,0x7a79063cu,0x100063du,0x8000005eu,0x7574063fu,0x66650640u,0x73720641u,0x6a690642u,0x62610643u,0x6d6c0644u,0x1000645u,0x8000005fu,0x6e6d064eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610696u,0x7170064fu,0x6d6c0650u,0x66650651u,0x73720652u,0x2f2e0653u,0x73620654u,0x62610665u,0x706f066eu,0x0u,0x6e6d0673u,0x0u,0x0u,0x0u,0x706f067bu,0x0u,0x0u,0x0u,0x6665067eu,0x0u,0x71700686u,0x0u,0x0u,0x706f068du,0x74730666u,0x66650667u,0x44430668u,0x706f0669u,0x6d6c066au,0x706f066bu,0x7372066cu,0x100066du,0x80000060u,0x6d6c066fu,0x706f0670u,0x73720671u,0x1000672u,0x80000061u,0x6a690674u,0x74730675u,0x74730676u,0x6a690677u,0x77760678u,0x66650679u,0x100067au,0x80000062u,0x7372067cu,0x100067du,0x80000063u,0x7574067fu,0x62610680u,0x6d6c0681u,0x6d6c0682u,0x6a690683u,0x64630684u,0x1000685u,0x80000064u,0x62610687u,0x64630688u,0x6a690689u,0x7574068au,0x7a79068bu,0x100068cu,0x80000065u,0x7675068eu,0x6867068fu,0x69680690u,0x6f6e0691u,0x66650692u,0x74730693u,0x74730694u,0x1000695u,0x80000066u,0x71700697u,0x66650698u,0x48470699u,0x6665069au,0x706f069bu,0x6e6d069cu,0x6665069du,0x7574069eu,0x7372069fu,0x7a7906a0u,0x10006a1u,0x80000067u,0x6d6c06a3u,0x767506a4u,0x666506a5u,0x10006a6u,0x80000068u,0x737206a8u,0x7a7906a9u,0x6a6906aau,0x6f6e06abu,0x686706acu,0x2f0006adu,0x80000069u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x786106dcu,0x757406f3u,0x62610703u,0x706f070cu,0x62610711u,0x6e6d0715u,0x0u,0x7372071du,0x0u,0x70640722u,0x0u,0x0u,0x0u,0x6665074eu,0x706f0756u,0x7370075cu,0x736f076fu,0x0u,0x70610783u,0x7663079fu,0x737207bcu,0x0u,0x706107c5u,0x737207e5u,0x757406f4u,0x737206f5u,0x6a6906f6u,0x636206f7u,0x767506f8u,0x757406f9u,0x666506fau,0x343006fbu,0x10006ffu,0x1000700u,0x1000701u,0x1000702u,0x8000006au,0x8000006bu,0x8000006cu,0x8000006du,0x74730704u,0x66650705u,0x44430706u,0x706f0707u,0x6d6c0708u,0x706f0709u,0x7372070au,0x100070bu,0x8000006eu,0x6d6c070du,0x706f070eu,0x7372070fu,0x1000710u,0x8000006fu,0x75740712u,0x62610713u,0x1000714u,0x80000070u,0x6a690716u,0x74730717u,0x74730718u,0x6a690719u,0x7776071au,0x6665071bu,0x100071cu,0x80000071u,0x706f071eu,0x7675071fu,0x71700720u,0x1000721u,0x80000072u,0x100072eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261072fu,0x74640733u,0x7372074cu,0x80000073u,0x68670730u,0x66650731u,0x1000732u,0x80000074u,0x66650743u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740746u,0x79780744u,0x1000745u,0x80000075u,0x62610747u,0x6f6e0748u,0x64630749u,0x6665074au,0x100074bu,0x80000076u,0x100074du,0x80000077u,0x7574074fu,0x62610750u,0x6d6c0751u,0x6d6c0752u,0x6a690753u,0x64630754u,0x1000755u,0x80000078u,0x73720757u,0x6e6d0758u,0x62610759u,0x6d6c075au,0x100075bu,0x80000079u,0x6261075fu,0x0u,0x6a690765u,0x64630760u,0x6a690761u,0x75740762u,0x7a790763u,0x1000764u,0x8000007au,0x66650766u,0x6f6e0767u,0x75740768u,0x62610769u,0x7574076au,0x6a69076bu,0x706f076cu,0x6f6e076du,0x100076eu,0x8000007bu,0x74730773u,0x0u,0x0u,0x706f077au,0x6a690774u,0x75740775u,0x6a690776u,0x706f0777u,0x6f6e0778u,0x1000779u,0x8000007cu,0x6b6a077bu,0x6665077cu,0x6463077du,0x7574077eu,0x6a69077fu,0x706f0780u,0x6f6e0781u,0x1000782u,0x8000007du,0x65640792u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x76750797u,0x6a690793u,0x76750794u,0x74730795u,0x1000796u,0x8000007eu,0x68670798u,0x69680799u,0x6f6e079au,0x6665079bu,0x7473079cu,0x7473079du,0x100079eu,0x8000007fu,0x626107b2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737207b6u,0x6d6c07b3u,0x666507b4u,0x10007b5u,0x80000080u,0x676607b7u,0x626107b8u,0x646307b9u,0x666507bau,0x10007bbu,0x80000081u,0x626107bdu,0x6f6e07beu,0x747307bfu,0x676607c0u,0x706f07c1u,0x737207c2u,0x6e6d07c3u,0x10007c4u,0x80000082u,0x6d6c07d4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666507ddu,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c07e0u,0x767507d5u,0x666507d6u,0x535207d7u,0x626107d8u,0x6f6e07d9u,0x686707dau,0x666507dbu,0x10007dcu,0x80000083u,0x787707deu,0x10007dfu,0x80000084u,0x767507e1u,0x6e6d07e2u,0x666507e3u,0x10007e4u,0x80000085u,0x626107e6u,0x717007e7u,0x4e4d07e8u,0x706f07e9u,0x656407eau,0x666507ebu,0x340007ecu,0x80000086u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x1000820u,0x1000821u,0x1000822u,0x80000087u,0x80000088u,0x80000089u,0x66650824u,0x56550825u,0x74730826u,0x65640827u,0x48470828u,0x66650829u,0x706f082au,0x6e6d082bu,0x5150082cu,0x706f082du,0x6a69082eu,0x6f6e082fu,0x75740830u,0x74730831u,0x1000832u,0x8000008au,0x6a690834u,0x75740835u,0x66650836u,0x42410837u,0x75740838u,0x44430839u,0x706f083au,0x6e6d083bu,0x6e6d083cu,0x6a69083du,0x7574083eu,0x100083fu,0x8000008bu,0x6d6c084fu,0x0u,0x0u,0x0u,0x737208aau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0913u,0x76750850u,0x66650851u,0x53000852u,0x8000008cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626108a5u,0x6f6e08a6u,0x686708a7u,0x666508a8u,0x10008a9u,0x8000008du,0x757408abu,0x666508acu,0x797808adu,0x2f2e08aeu,0x756108afu,0x757408c3u,0x0u,0x706108d3u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f08e8u,0x737208eeu,0x706f08f9u,0x0u,0x62610901u,0x64630907u,0x6261090cu,0x757408c4u,0x737208c5u,0x6a6908c6u,0x636208c7u,0x767508c8u,0x757408c9u,0x666508cau,0x343008cbu,0x10008cfu,0x10008d0u,0x10008d1u,0x10008d2u,0x8000008eu,0x8000008fu,0x80000090u,0x80000091u,0x717008e2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c08e4u,0x10008e3u,0x80000092u,0x706f08e5u,0x737208e6u,0x10008e7u,0x80000093u,0x737208e9u,0x6e6d08eau,0x626108ebu,0x6d6c08ecu,0x10008edu,0x80000094u,0x6a6908efu,0x666508f0u,0x6f6e08f1u,0x757408f2u,0x626108f3u,0x757408f4u,0x6a6908f5u,0x706f08f6u,0x6f6e08f7u,0x10008f8u,0x80000095u,0x747308fau,0x6a6908fbu,0x757408fcu,0x6a6908fdu,0x706f08feu,0x6f6e08ffu,0x1000900u,0x80000096u,0x65640902u,0x6a690903u,0x76750904u,0x74730905u,0x1000906u,0x80000097u,0x62610908u,0x6d6c0909u,0x6665090au,0x100090bu,0x80000098u,0x6f6e090du,0x6867090eu,0x6665090fu,0x6f6e0910u,0x75740911u,0x1000912u,0x80000099u,0x76750914u,0x6e6d0915u,0x66650916u,0x1000917u,0x8000009au,0x7372091cu,0x0u,0x0u,0x62610920u,0x6d6c091du,0x6564091eu,0x100091fu,0x8000009bu,0x71700921u,0x4e4d0922u,0x706f0923u,0x65640924u,0x66650925u,0x34310926u,0x1000929u,0x100092au,0x100092bu,0x8000009cu,0x8000009du,0x8000009eu};
+   static const uint32_t table[] = {0x756c0017u,0x62610055u,0x7061005eu,0x6a6100f6u,0x6e6d010au,0x70610112u,0x7365012bu,0x0u,0x736d0144u,0x0u,0x0u,0x6a690263u,0x66610268u,0x7061027bu,0x76630295u,0x736f02dbu,0x0u,0x7061032bu,0x7663034eu,0x73680480u,0x746e04a9u,0x7061098eu,0x736f0a66u,0x71700020u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x71700038u,0x7574003du,0x69680021u,0x62610022u,0x4e430023u,0x7675002eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0034u,0x7574002fu,0x706f0030u,0x67660031u,0x67660032u,0x1000033u,0x80000000u,0x65640035u,0x66650036u,0x1000037u,0x80000001u,0x66650039u,0x6463003au,0x7574003bu,0x100003cu,0x80000002u,0x6665003eu,0x6f6e003fu,0x76750040u,0x62610041u,0x75740042u,0x6a690043u,0x706f0044u,0x6f6e0045u,0x45430046u,0x706f0048u,0x6a69004du,0x6d6c0049u,0x706f004au,0x7372004bu,0x100004cu,0x80000003u,0x7473004eu,0x7574004fu,0x62610050u,0x6f6e0051u,0x64630052u,0x66650053u,0x1000054u,0x80000004u,0x74730056u,0x66650057u,0x44430058u,0x706f0059u,0x6d6c005au,0x706f005bu,0x7372005cu,0x100005du,0x80000005u,0x716d006du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610077u,0x0u,0x0u,0x0u,0x66650089u,0x0u,0x0u,0x6d6c00f2u,0x66650071u,0x0u,0x0u,0x74730075u,0x73720072u,0x62610073u,0x1000074u,0x80000006u,0x1000076u,0x80000007u,0x6f6e0078u,0x6f6e0079u,0x6665007au,0x6d6c007bu,0x2f2e007cu,0x6563007du,0x706f007fu,0x66650084u,0x6d6c0080u,0x706f0081u,0x73720082u,0x1000083u,0x80000008u,0x71700085u,0x75740086u,0x69680087u,0x1000088u,0x80000009u,0x6261008au,0x7372008bu,0x6463008cu,0x706f008du,0x6261008eu,0x7574008fu,0x53000090u,0x8000000au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f00e3u,0x0u,0x0u,0x0u,0x706f00e9u,0x737200e4u,0x6e6d00e5u,0x626100e6u,0x6d6c00e7u,0x10000e8u,0x8000000bu,0x767500eau,0x686700ebu,0x696800ecu,0x6f6e00edu,0x666500eeu,0x747300efu,0x747300f0u,0x10000f1u,0x8000000cu,0x706f00f3u,0x737200f4u,0x10000f5u,0x8000000du,0x757400ffu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720102u,0x62610100u,0x1000101u,0x8000000eu,0x66650103u,0x64630104u,0x75740105u,0x6a690106u,0x706f0107u,0x6f6e0108u,0x1000109u,0x8000000fu,0x6a69010bu,0x7473010cu,0x7473010du,0x6a69010eu,0x7776010fu,0x66650110u,0x1000111u,0x80000010u,0x73720121u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0123u,0x0u,0x0u,0x0u,0x0u,0x0u,0x77760128u,0x1000122u,0x80000011u,0x75740124u,0x66650125u,0x73720126u,0x1000127u,0x80000012u,0x7a790129u,0x100012au,0x80000013u,0x706f0139u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0140u,0x6e6d013au,0x6665013bu,0x7574013cu,0x7372013du,0x7a79013eu,0x100013fu,0x80000014u,0x76750141u,0x71700142u,0x1000143u,0x80000015u,0x6261014au,0x744101a6u,0x737201f7u,0x0u,0x0u,0x6a6901f9u,0x6867014bu,0x6665014cu,0x5300014du,0x80000016u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666501a0u,0x686701a1u,0x6a6901a2u,0x706f01a3u,0x6f6e01a4u,0x10001a5u,0x80000017u,0x757401d9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x676601e2u,0x0u,0x0u,0x0u,0x0u,0x737201e8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757401f1u,0x757401dau,0x737201dbu,0x6a6901dcu,0x636201ddu,0x767501deu,0x757401dfu,0x666501e0u,0x10001e1u,0x80000018u,0x676601e3u,0x747301e4u,0x666501e5u,0x757401e6u,0x10001e7u,0x80000019u,0x626101e9u,0x6f6e01eau,0x747301ebu,0x676601ecu,0x706f01edu,0x737201eeu,0x6e6d01efu,0x10001f0u,0x8000001au,0x626101f2u,0x6f6e01f3u,0x646301f4u,0x666501f5u,0x10001f6u,0x8000001bu,0x10001f8u,0x8000001cu,0x656401fau,0x666501fbu,0x747301fcu,0x646301fdu,0x666501feu,0x6f6e01ffu,0x64630200u,0x66650201u,0x55000202u,0x8000001du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0257u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6968025au,0x73720258u,0x1000259u,0x8000001eu,0x6a69025bu,0x6463025cu,0x6c6b025du,0x6f6e025eu,0x6665025fu,0x74730260u,0x74730261u,0x1000262u,0x8000001fu,0x68670264u,0x69680265u,0x75740266u,0x1000267u,0x80000020u,0x7574026du,0x0u,0x0u,0x0u,0x75740274u,0x6665026eu,0x7372026fu,0x6a690270u,0x62610271u,0x6d6c0272u,0x1000273u,0x80000021u,0x62610275u,0x6d6c0276u,0x6d6c0277u,0x6a690278u,0x64630279u,0x100027au,0x80000022u,0x6e6d028au,0x0u,0x0u,0x0u,0x6261028du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720290u,0x6665028bu,0x100028cu,0x80000023u,0x7372028eu,0x100028fu,0x80000024u,0x6e6d0291u,0x62610292u,0x6d6c0293u,0x1000294u,0x80000025u,0x646302a8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626102b0u,0x0u,0x6a6902b6u,0x0u,0x0u,0x757402c5u,0x6d6c02a9u,0x767502aau,0x747302abu,0x6a6902acu,0x706f02adu,0x6f6e02aeu,0x10002afu,0x80000026u,0x646302b1u,0x6a6902b2u,0x757402b3u,0x7a7902b4u,0x10002b5u,0x80000027u,0x686502b7u,0x6f6e02bau,0x0u,0x6a6902c2u,0x757402bbu,0x626102bcu,0x757402bdu,0x6a6902beu,0x706f02bfu,0x6f6e02c0u,0x10002c1u,0x80000028u,0x6f6e02c3u,0x10002c4u,0x80000029u,0x554f02c6u,0x676602ccu,0x0u,0x0u,0x0u,0x0u,0x737202d2u,0x676602cdu,0x747302ceu,0x666502cfu,0x757402d0u,0x10002d1u,0x8000002au,0x626102d3u,0x6f6e02d4u,0x747302d5u,0x676602d6u,0x706f02d7u,0x737202d8u,0x6e6d02d9u,0x10002dau,0x8000002bu,0x747302dfu,0x0u,0x0u,0x6a6902e6u,0x6a6902e0u,0x757402e1u,0x6a6902e2u,0x706f02e3u,0x6f6e02e4u,0x10002e5u,0x8000002cu,0x6e6d02e7u,0x6a6902e8u,0x757402e9u,0x6a6902eau,0x777602ebu,0x666502ecu,0x2f2e02edu,0x736102eeu,0x75740300u,0x0u,0x706f0310u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f640315u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610325u,0x75740301u,0x73720302u,0x6a690303u,0x63620304u,0x76750305u,0x75740306u,0x66650307u,0x34300308u,0x100030cu,0x100030du,0x100030eu,0x100030fu,0x8000002du,0x8000002eu,0x8000002fu,0x80000030u,0x6d6c0311u,0x706f0312u,0x73720313u,0x1000314u,0x80000031u,0x1000320u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640321u,0x80000032u,0x66650322u,0x79780323u,0x1000324u,0x80000033u,0x65640326u,0x6a690327u,0x76750328u,0x74730329u,0x100032au,0x80000034u,0x6564033au,0x0u,0x0u,0x0u,0x6f6e033fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x76750346u,0x6a69033bu,0x7675033cu,0x7473033du,0x100033eu,0x80000035u,0x65640340u,0x66650341u,0x73720342u,0x66650343u,0x73720344u,0x1000345u,0x80000036u,0x68670347u,0x69680348u,0x6f6e0349u,0x6665034au,0x7473034bu,0x7473034cu,0x100034du,0x80000037u,0x62610361u,0x0u,0x0u,0x0u,0x0u,0x66610365u,0x7b7a03b5u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666103b8u,0x0u,0x0u,0x0u,0x62610410u,0x7372047au,0x6d6c0362u,0x66650363u,0x1000364u,0x80000038u,0x7170036au,0x0u,0x0u,0x0u,0x66650395u,0x6665036bu,0x5547036cu,0x6665037au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7a720382u,0x706f037bu,0x6e6d037cu,0x6665037du,0x7574037eu,0x7372037fu,0x7a790380u,0x1000381u,0x80000039u,0x6261038au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x71700392u,0x6f6e038bu,0x7473038cu,0x6766038du,0x706f038eu,0x7372038fu,0x6e6d0390u,0x1000391u,0x8000003au,0x66650393u,0x1000394u,0x8000003bu,0x6f6e0396u,0x53430397u,0x706f03a7u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f03acu,0x6d6c03a8u,0x706f03a9u,0x737203aau,0x10003abu,0x8000003cu,0x767503adu,0x686703aeu,0x696803afu,0x6f6e03b0u,0x666503b1u,0x747303b2u,0x747303b3u,0x10003b4u,0x8000003du,0x666503b6u,0x10003b7u,0x8000003eu,0x646303bdu,0x0u,0x0u,0x0u,0x646303c2u,0x6a6903beu,0x6f6e03bfu,0x686703c0u,0x10003c1u,0x8000003fu,0x767503c3u,0x6d6c03c4u,0x626103c5u,0x737203c6u,0x440003c7u,0x80000040u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f040bu,0x6d6c040cu,0x706f040du,0x7372040eu,0x100040fu,0x80000041u,0x75740411u,0x76750412u,0x74730413u,0x44430414u,0x62610415u,0x6d6c0416u,0x6d6c0417u,0x63620418u,0x62610419u,0x6463041au,0x6c6b041bu,0x5600041cu,0x80000042u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730472u,0x66650473u,0x73720474u,0x45440475u,0x62610476u,0x75740477u,0x62610478u,0x1000479u,0x80000043u,0x6766047bu,0x6261047cu,0x6463047du,0x6665047eu,0x100047fu,0x80000044u,0x6a69048bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610493u,0x6463048cu,0x6c6b048du,0x6f6e048eu,0x6665048fu,0x74730490u,0x74730491u,0x1000492u,0x80000045u,0x6f6e0494u,0x74730495u,0x6e660496u,0x706f049eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6904a2u,0x7372049fu,0x6e6d04a0u,0x10004a1u,0x80000046u,0x747304a3u,0x747304a4u,0x6a6904a5u,0x706f04a6u,0x6f6e04a7u,0x10004a8u,0x80000047u,0x6a6904afu,0x0u,0x10004bau,0x0u,0x0u,0x656404bbu,0x757404b0u,0x454404b1u,0x6a6904b2u,0x747304b3u,0x757404b4u,0x626104b5u,0x6f6e04b6u,0x646304b7u,0x666504b8u,0x10004b9u,0x80000048u,0x80000049u,0x3b3a04bcu,0x3b3a04bdu,0x786104beu,0x757404d5u,0x0u,0x706f04f9u,0x0u,0x6f6e0510u,0x6d6c051cu,0x62610529u,0x0u,0x6f6d0570u,0x0u,0x0u,0x706f0582u,0x6665059eu,0x0u,0x767505c6u,0x73720623u,0x0u,0x66650630u,0x6663064au,0x6a690704u,0x74730971u,0x0u,0x73720981u,0x757404d6u,0x737204d7u,0x6a6904d8u,0x636204d9u,0x767504dau,0x757404dbu,0x666504dcu,0x343004ddu,0x2f2e04e1u,0x2f2e04e7u,0x2f2e04edu,0x2f2e04f3u,0x6f6e04e2u,0x626104e3u,0x6e6d04e4u,0x666504e5u,0x10004e6u,0x8000004au,0x6f6e04e8u,0x626104e9u,0x6e6d04eau,0x666504ebu,0x10004ecu,0x8000004bu,0x6f6e04eeu,0x626104efu,0x6e6d04f0u,0x666504f1u,0x10004f2u,0x8000004cu,0x6f6e04f4u,0x626104f5u,0x6e6d04f6u,0x666504f7u,0x10004f8u,0x8000004du,0x6f6e04fau,0x6f6e04fbu,0x666504fcu,0x646304fdu,0x757404feu,0x6a6904ffu,0x706f0500u,0x6f6e0501u,0x2f2e0502u,0x6d6c0503u,0x706f0504u,0x68670505u,0x57560506u,0x66650507u,0x73720508u,0x63620509u,0x706f050au,0x7473050bu,0x6a69050cu,0x7574050du,0x7a79050eu,0x100050fu,0x8000004eu,0x62610511u,0x63620512u,0x6d6c0513u,0x66650514u,0x54530515u,0x62610516u,0x77760517u,0x6a690518u,0x6f6e0519u,0x6867051au,0x100051bu,0x8000004fu,0x7675051du,0x7473051eu,0x6968051fu,0x2f2e0520u,0x75740521u,0x69680522u,0x73720523u,0x66650524u,0x62610525u,0x65640526u,0x74730527u,0x1000528u,0x80000050u,0x7372052au,0x6362052bu,0x6261052cu,0x6867052du,0x6665052eu,0x4443052fu,0x706f0530u,0x6d6c0531u,0x6d6c0532u,0x66650533u,0x64630534u,0x75740535u,0x2f000536u,0x80000051u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740565u,0x6a690566u,0x6e6d0567u,0x66650568u,0x43420569u,0x7675056au,0x6564056bu,0x6867056cu,0x6665056du,0x7574056eu,0x100056fu,0x80000052u,0x62610572u,0x74730579u,0x68670573u,0x66650574u,0x56550575u,0x73720576u,0x6d6c0577u,0x1000578u,0x80000053u,0x7574057au,0x6261057bu,0x6f6e057cu,0x6463057du,0x6a69057eu,0x6f6e057fu,0x68670580u,0x1000581u,0x80000054u,0x65640583u,0x2f2e0584u,0x736d0585u,0x6a69058bu,0x0u,0x0u,0x0u,0x0u,0x62610598u,0x6f6e058cu,0x5150058du,0x7372058eu,0x6a69058fu,0x6e6d0590u,0x6a690591u,0x75740592u,0x6a690593u,0x77760594u,0x66650595u,0x74730596u,0x1000597u,0x80000055u,0x75740599u,0x6a69059au,0x706f059bu,0x7473059cu,0x100059du,0x80000056u,0x6e6d059fu,0x706f05a0u,0x737205a1u,0x7a7905a2u,0x2f2e05a3u,0x746b05a4u,0x666505adu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x646305bau,0x666505aeu,0x717005afu,0x555405b0u,0x6a6905b1u,0x6e6d05b2u,0x666505b3u,0x747305b4u,0x757405b5u,0x666505b6u,0x717005b7u,0x747305b8u,0x10005b9u,0x80000057u,0x737205bbu,0x626105bcu,0x757405bdu,0x646305beu,0x696805bfu,0x4d4c05c0u,0x6a6905c1u,0x6e6d05c2u,0x6a6905c3u,0x757405c4u,0x10005c5u,0x80000058u,0x757405c7u,0x717005c8u,0x767505c9u,0x757405cau,0x2f2e05cbu,0x716905ccu,0x6f6e05d4u,0x0u,0x0u,0x0u,0x656105e3u,0x0u,0x0u,0x737205f6u,0x656405d5u,0x666505d6u,0x797805d7u,0x666505d8u,0x656405d9u,0x515005dau,0x737205dbu,0x6a6905dcu,0x6e6d05ddu,0x777605deu,0x626105dfu,0x737205e0u,0x747305e1u,0x10005e2u,0x80000059u,0x757405e7u,0x0u,0x0u,0x6d6c05eeu,0x666505e8u,0x737205e9u,0x6a6905eau,0x626105ebu,0x6d6c05ecu,0x10005edu,0x8000005au,0x545305efu,0x696805f0u,0x626105f1u,0x656405f2u,0x666505f3u,0x737205f4u,0x10005f5u,0x8000005bu,0x666505f7u,0x776305f8u,0x6a69060cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690612u,0x7473060du,0x6a69060eu,0x706f060fu,0x6f6e0610u,0x1000611u,0x8000005cu,0x66650613u,0x78770614u,0x54530615u,0x76750616u,0x73720617u,0x67660618u,0x62610619u,0x6463061au,0x6665061bu,0x5453061cu,0x6968061du,0x6261061eu,0x6564061fu,0x66650620u,0x73720621u,0x1000622u,0x8000005du,0x66650624u,0x44430625u,0x6d6c0626u,0x62610627u,0x74730628u,0x74730629u,0x6a69062au,0x6766062bu,0x6a69062cu,0x6665062du,0x6564062eu,0x100062fu,0x8000005eu,0x6e6d0631u,0x706f0632u,0x77760633u,0x66650634u,0x56500635u,0x7372063bu,0x0u,0x0u,0x0u,0x0u,0x6f6e063fu,0x6a69063cu,0x6e6d063du,0x100063eu,0x8000005fu,0x76750640u,0x74730641u,0x66650642u,0x65640643u,0x4f4e0644u,0x62610645u,0x6e6d0646u,0x66650647u,0x74730648u,0x1000649u,0x80000060u,0x6665064du,0x0u,0x73720656u,0x6f6e064eu,0x6665064fu,0x54530650u,0x75740651u,0x62610652u,0x68670653u,0x66650654u,0x1000655u,0x80000061u,0x6a690657u,0x62610658u,0x6d6c0659u,0x6a69065au,0x7b7a065bu,0x6665065cu,0x2f2e065du,0x7561065eu,0x74730672u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f06cdu,0x0u,0x0u,0x0u,0x706f06d5u,0x0u,0x666506ddu,0x767506e7u,0x0u,0x0u,0x0u,0x0u,0x6a6906f3u,0x7a790673u,0x6f6e0674u,0x64630675u,0x4e000676u,0x80000062u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626106c4u,0x797806c5u,0x474606c6u,0x737206c7u,0x626106c8u,0x6e6d06c9u,0x666506cau,0x747306cbu,0x10006ccu,0x80000063u,0x747306ceu,0x757406cfu,0x4f4e06d0u,0x626106d1u,0x6e6d06d2u,0x666506d3u,0x10006d4u,0x80000064u,0x646306d6u,0x626106d7u,0x757406d8u,0x6a6906d9u,0x706f06dau,0x6f6e06dbu,0x10006dcu,0x80000065u,0x787706deu,0x545306dfu,0x666506e0u,0x747306e1u,0x747306e2u,0x6a6906e3u,0x706f06e4u,0x6f6e06e5u,0x10006e6u,0x80000066u,0x757406e8u,0x717006e9u,0x767506eau,0x757406ebu,0x434206ecu,0x6a6906edu,0x6f6e06eeu,0x626106efu,0x737206f0u,0x7a7906f1u,0x10006f2u,0x80000067u,0x6e6d06f4u,0x666506f5u,0x747306f6u,0x757406f7u,0x666506f8u,0x717006f9u,0x747306fau,0x515006fbu,0x666506fcu,0x737206fdu,0x4d4c06feu,0x626106ffu,0x7a790700u,0x66650701u,0x73720702u,0x1000703u,0x80000068u,0x6e6c0705u,0x6a690707u,0x6665071cu,0x6f6e0708u,0x68670709u,0x2f2e070au,0x6e6d070bu,0x6261070cu,0x7978070du,0x5150070eu,0x706f070fu,0x6a690710u,0x6f6e0711u,0x75740712u,0x74730713u,0x51500714u,0x66650715u,0x73720716u,0x55540717u,0x6a690718u,0x6d6c0719u,0x6665071au,0x100071bu,0x80000069u,0x5700071du,0x8000006au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x77670774u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626107f5u,0x66650784u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261078cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x69610794u,0x0u,0x0u,0x626107f0u,0x706f0785u,0x6e6d0786u,0x66650787u,0x75740788u,0x73720789u,0x7a79078au,0x100078bu,0x8000006bu,0x7574078du,0x6665078eu,0x7372078fu,0x6a690790u,0x62610791u,0x6d6c0792u,0x1000793u,0x8000006cu,0x6e6d079cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626107e4u,0x7170079du,0x6d6c079eu,0x6665079fu,0x737207a0u,0x2f2e07a1u,0x736207a2u,0x626107b3u,0x706f07bcu,0x0u,0x6e6d07c1u,0x0u,0x0u,0x0u,0x706f07c9u,0x0u,0x0u,0x0u,0x666507ccu,0x0u,0x717007d4u,0x0u,0x0u,0x706f07dbu,0x747307b4u,0x666507b5u,0x444307b6u,0x706f07b7u,0x6d6c07b8u,0x706f07b9u,0x737207bau,0x10007bbu,0x8000006du,0x6d6c07bdu,0x706f07beu,0x737207bfu,0x10007c0u,0x8000006eu,0x6a6907c2u,0x747307c3u,0x747307c4u,0x6a6907c5u,0x777607c6u,0x666507c7u,0x10007c8u,0x8000006fu,0x737207cau,0x10007cbu,0x80000070u,0x757407cdu,0x626107ceu,0x6d6c07cfu,0x6d6c07d0u,0x6a6907d1u,0x646307d2u,0x10007d3u,0x80000071u,0x626107d5u,0x646307d6u,0x6a6907d7u,0x757407d8u,0x7a7907d9u,0x10007dau,0x80000072u,0x767507dcu,0x686707ddu,0x696807deu,0x6f6e07dfu,0x666507e0u,0x747307e1u,0x747307e2u,0x10007e3u,0x80000073u,0x717007e5u,0x666507e6u,0x484707e7u,0x666507e8u,0x706f07e9u,0x6e6d07eau,0x666507ebu,0x757407ecu,0x737207edu,0x7a7907eeu,0x10007efu,0x80000074u,0x6d6c07f1u,0x767507f2u,0x666507f3u,0x10007f4u,0x80000075u,0x737207f6u,0x7a7907f7u,0x6a6907f8u,0x6f6e07f9u,0x686707fau,0x2f0007fbu,0x80000076u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7861082au,0x75740841u,0x62610851u,0x706f085au,0x6261085fu,0x6e6d0863u,0x0u,0x7372086bu,0x0u,0x70640870u,0x0u,0x0u,0x0u,0x6665089cu,0x706f08a4u,0x737008aau,0x736f08bdu,0x0u,0x706108d1u,0x766308edu,0x7372090au,0x0u,0x70610913u,0x73720933u,0x75740842u,0x73720843u,0x6a690844u,0x63620845u,0x76750846u,0x75740847u,0x66650848u,0x34300849u,0x100084du,0x100084eu,0x100084fu,0x1000850u,0x80000077u,0x80000078u,0x80000079u,0x8000007au,0x74730852u,0x66650853u,0x44430854u,0x706f0855u,0x6d6c0856u,0x706f0857u,0x73720858u,0x1000859u,0x8000007bu,0x6d6c085bu,0x706f085cu,0x7372085du,0x100085eu,0x8000007cu,0x75740860u,0x62610861u,0x1000862u,0x8000007du,0x6a690864u,0x74730865u,0x74730866u,0x6a690867u,0x77760868u,0x66650869u,0x100086au,0x8000007eu,0x706f086cu,0x7675086du,0x7170086eu,0x100086fu,0x8000007fu,0x100087cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261087du,0x74640881u,0x7372089au,0x80000080u,0x6867087eu,0x6665087fu,0x1000880u,0x80000081u,0x66650891u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740894u,0x79780892u,0x1000893u,0x80000082u,0x62610895u,0x6f6e0896u,0x64630897u,0x66650898u,0x1000899u,0x80000083u,0x100089bu,0x80000084u,0x7574089du,0x6261089eu,0x6d6c089fu,0x6d6c08a0u,0x6a6908a1u,0x646308a2u,0x10008a3u,0x80000085u,0x737208a5u,0x6e6d08a6u,0x626108a7u,0x6d6c08a8u,0x10008a9u,0x80000086u,0x626108adu,0x0u,0x6a6908b3u,0x646308aeu,0x6a6908afu,0x757408b0u,0x7a7908b1u,0x10008b2u,0x80000087u,0x666508b4u,0x6f6e08b5u,0x757408b6u,0x626108b7u,0x757408b8u,0x6a6908b9u,0x706f08bau,0x6f6e08bbu,0x10008bcu,0x80000088u,0x747308c1u,0x0u,0x0u,0x706f08c8u,0x6a6908c2u,0x757408c3u,0x6a6908c4u,0x706f08c5u,0x6f6e08c6u,0x10008c7u,0x80000089u,0x6b6a08c9u,0x666508cau,0x646308cbu,0x757408ccu,0x6a6908cdu,0x706f08ceu,0x6f6e08cfu,0x10008d0u,0x8000008au,0x656408e0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x767508e5u,0x6a6908e1u,0x767508e2u,0x747308e3u,0x10008e4u,0x8000008bu,0x686708e6u,0x696808e7u,0x6f6e08e8u,0x666508e9u,0x747308eau,0x747308ebu,0x10008ecu,0x8000008cu,0x62610900u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720904u,0x6d6c0901u,0x66650902u,0x1000903u,0x8000008du,0x67660905u,0x62610906u,0x64630907u,0x66650908u,0x1000909u,0x8000008eu,0x6261090bu,0x6f6e090cu,0x7473090du,0x6766090eu,0x706f090fu,0x73720910u,0x6e6d0911u,0x1000912u,0x8000008fu,0x6d6c0922u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6665092bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c092eu,0x76750923u,0x66650924u,0x53520925u,0x62610926u,0x6f6e0927u,0x68670928u,0x66650929u,0x100092au,0x80000090u,0x7877092cu,0x100092du,0x80000091u,0x7675092fu,0x6e6d0930u,0x66650931u,0x1000932u,0x80000092u,0x62610934u,0x71700935u,0x4e4d0936u,0x706f0937u,0x65640938u,0x66650939u,0x3400093au,0x80000093u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x100096eu,0x100096fu,0x1000970u,0x80000094u,0x80000095u,0x80000096u,0x66650972u,0x56550973u,0x74730974u,0x65640975u,0x48470976u,0x66650977u,0x706f0978u,0x6e6d0979u,0x5150097au,0x706f097bu,0x6a69097cu,0x6f6e097du,0x7574097eu,0x7473097fu,0x1000980u,0x80000097u,0x6a690982u,0x75740983u,0x66650984u,0x42410985u,0x75740986u,0x44430987u,0x706f0988u,0x6e6d0989u,0x6e6d098au,0x6a69098bu,0x7574098cu,0x100098du,0x80000098u,0x6d6c099du,0x0u,0x0u,0x0u,0x737209f8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0a61u,0x7675099eu,0x6665099fu,0x530009a0u,0x80000099u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626109f3u,0x6f6e09f4u,0x686709f5u,0x666509f6u,0x10009f7u,0x8000009au,0x757409f9u,0x666509fau,0x797809fbu,0x2f2e09fcu,0x756109fdu,0x75740a11u,0x0u,0x70610a21u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0a36u,0x73720a3cu,0x706f0a47u,0x0u,0x62610a4fu,0x64630a55u,0x62610a5au,0x75740a12u,0x73720a13u,0x6a690a14u,0x63620a15u,0x76750a16u,0x75740a17u,0x66650a18u,0x34300a19u,0x1000a1du,0x1000a1eu,0x1000a1fu,0x1000a20u,0x8000009bu,0x8000009cu,0x8000009du,0x8000009eu,0x71700a30u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0a32u,0x1000a31u,0x8000009fu,0x706f0a33u,0x73720a34u,0x1000a35u,0x800000a0u,0x73720a37u,0x6e6d0a38u,0x62610a39u,0x6d6c0a3au,0x1000a3bu,0x800000a1u,0x6a690a3du,0x66650a3eu,0x6f6e0a3fu,0x75740a40u,0x62610a41u,0x75740a42u,0x6a690a43u,0x706f0a44u,0x6f6e0a45u,0x1000a46u,0x800000a2u,0x74730a48u,0x6a690a49u,0x75740a4au,0x6a690a4bu,0x706f0a4cu,0x6f6e0a4du,0x1000a4eu,0x800000a3u,0x65640a50u,0x6a690a51u,0x76750a52u,0x74730a53u,0x1000a54u,0x800000a4u,0x62610a56u,0x6d6c0a57u,0x66650a58u,0x1000a59u,0x800000a5u,0x6f6e0a5bu,0x68670a5cu,0x66650a5du,0x6f6e0a5eu,0x75740a5fu,0x1000a60u,0x800000a6u,0x76750a62u,0x6e6d0a63u,0x66650a64u,0x1000a65u,0x800000a7u,0x73720a6au,0x0u,0x0u,0x62610a6eu,0x6d6c0a6bu,0x65640a6cu,0x1000a6du,0x800000a8u,0x71700a6fu,0x4e4d0a70u,0x706f0a71u,0x65640a72u,0x66650a73u,0x34310a74u,0x1000a77u,0x1000a78u,0x1000a79u,0x800000a9u,0x800000aau,0x800000abu};
    uint32_t cur = 0x78610000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
@@ -321,6 +321,116 @@ static const void * ANARI_DEVICE_usd__serialize_outputBinary_info(ANARIDataType
       default: return nullptr;
    }
 }
+static const void * ANARI_DEVICE_usd__serialize_async_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Write the scene to disk on a background thread after anariRenderFrame, use anariFrameReady to wait for completion";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_usd__serialize_asyncMaxFrames_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(2)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Maximum number of frames with outstanding background saves, before anariRenderFrame blocks";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_usd__serialize_timestepsPerLayer_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Move the time samples of the scene layer into value clip layers holding this many timesteps each, so saving a frame does not rewrite the sample history. 0 keeps all samples in the scene layer";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_DEVICE_usd__time_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -385,6 +495,194 @@ static const void * ANARI_DEVICE_usd__writeAtCommit_info(ANARIDataType paramType
       default: return nullptr;
    }
 }
+static const void * ANARI_DEVICE_usd__flush_threads_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Number of threads used for converting object data before it is written to USD at anariRenderFrame, and for splitting up large conversions and layer saves while writing. 0 selects the hardware concurrency, 1 disables threading.";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_usd__memory_scratchLimit_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(67108864)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Maximum number of bytes of temporary conversion memory that is kept after the scene has been saved, for reuse in the next frame.";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_usd__memory_keepTimesteps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Maximum number of timestep clip stages per object kept in memory; the least recently used ones are released once saved and reopened from disk when needed. 0 keeps all.";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_usd__lod_ratios_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Fractions of the primitive count of up to four levels of detail generated in the background for large meshes and point sets. Components outside of (0,1) are ignored; all zeros disables level of detail generation.";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_usd__lod_minPrimitives_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(65536)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Minimum number of triangles/quads of a mesh or points of a point set for levels of detail to be generated.";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_DEVICE_usd__output_material_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -481,6 +779,70 @@ static const void * ANARI_DEVICE_usd__output_mdlShader_info(ANARIDataType paramT
       default: return nullptr;
    }
 }
+static const void * ANARI_DEVICE_usd__output_indexedPrimvars_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Output geometry color and attribute arrays with few distinct values as indexed primvars, whenever that is smaller than the flat array";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_usd__output_precision_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "full";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Precision of geometry colors, normals, widths and float attributes, either full (float) or half. Vertex positions are always output at full precision";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_DEVICE_usd__garbageCollect_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -506,6 +868,45 @@ static const void * ANARI_DEVICE_usd__garbageCollect_info(ANARIDataType paramTyp
       default: return nullptr;
    }
 }
+static const void * ANARI_DEVICE_usd__garbageCollect_timeBudget_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Maximum time in milliseconds spent by a single usd::garbageCollect, objects left over are removed by the next ones. 0 sets no limit";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_DEVICE_usd__removeUnusedNames_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -642,31 +1043,53 @@ static const void * ANARI_DEVICE_param_info(const char *paramName, ANARIDataType
          return ANARI_DEVICE_statusCallback_info(paramType, infoName, infoType);
       case 67:
          return ANARI_DEVICE_statusCallbackUserData_info(paramType, infoName, infoType);
-      case 89:
+      case 100:
          return ANARI_DEVICE_usd__serialize_hostName_info(paramType, infoName, infoType);
-      case 90:
+      case 101:
          return ANARI_DEVICE_usd__serialize_location_info(paramType, infoName, infoType);
-      case 91:
+      case 102:
          return ANARI_DEVICE_usd__serialize_newSession_info(paramType, infoName, infoType);
-      case 92:
+      case 103:
          return ANARI_DEVICE_usd__serialize_outputBinary_info(paramType, infoName, infoType);
-      case 93:
+      case 98:
+         return ANARI_DEVICE_usd__serialize_async_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_DEVICE_usd__serialize_asyncMaxFrames_info(paramType, infoName, infoType);
+      case 104:
+         return ANARI_DEVICE_usd__serialize_timestepsPerLayer_info(paramType, infoName, infoType);
+      case 106:
          return ANARI_DEVICE_usd__time_info(paramType, infoName, infoType);
-      case 139:
+      case 152:
          return ANARI_DEVICE_usd__writeAtCommit_info(paramType, infoName, infoType);
-      case 82:
+      case 80:
+         return ANARI_DEVICE_usd__flush_threads_info(paramType, infoName, infoType);
+      case 88:
+         return ANARI_DEVICE_usd__memory_scratchLimit_info(paramType, infoName, infoType);
+      case 87:
+         return ANARI_DEVICE_usd__memory_keepTimesteps_info(paramType, infoName, infoType);
+      case 86:
+         return ANARI_DEVICE_usd__lod_ratios_info(paramType, infoName, infoType);
+      case 85:
+         return ANARI_DEVICE_usd__lod_minPrimitives_info(paramType, infoName, infoType);
+      case 90:
          return ANARI_DEVICE_usd__output_material_info(paramType, infoName, infoType);
-      case 84:
+      case 93:
          return ANARI_DEVICE_usd__output_previewSurfaceShader_info(paramType, infoName, infoType);
-      case 83:
+      case 91:
          return ANARI_DEVICE_usd__output_mdlShader_info(paramType, infoName, infoType);
-      case 80:
+      case 89:
+         return ANARI_DEVICE_usd__output_indexedPrimvars_info(paramType, infoName, infoType);
+      case 92:
+         return ANARI_DEVICE_usd__output_precision_info(paramType, infoName, infoType);
+      case 81:
          return ANARI_DEVICE_usd__garbageCollect_info(paramType, infoName, infoType);
-      case 87:
+      case 82:
+         return ANARI_DEVICE_usd__garbageCollect_timeBudget_info(paramType, infoName, infoType);
+      case 96:
          return ANARI_DEVICE_usd__removeUnusedNames_info(paramType, infoName, infoType);
       case 78:
          return ANARI_DEVICE_usd__connection_logVerbosity_info(paramType, infoName, infoType);
-      case 88:
+      case 97:
          return ANARI_DEVICE_usd__sceneStage_info(paramType, infoName, infoType);
       case 79:
          return ANARI_DEVICE_usd__enableSaving_info(paramType, infoName, infoType);
@@ -886,7 +1309,7 @@ static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType
    switch(param_hash(paramName)) {
       case 35:
          return ANARI_FRAME_name_info(paramType, infoName, infoType);
-      case 155:
+      case 168:
          return ANARI_FRAME_world_info(paramType, infoName, infoType);
       case 54:
          return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
@@ -1118,17 +1541,17 @@ static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType
          return ANARI_GROUP_name_info(paramType, infoName, infoType);
       case 68:
          return ANARI_GROUP_surface_info(paramType, infoName, infoType);
-      case 154:
+      case 167:
          return ANARI_GROUP_volume_info(paramType, infoName, infoType);
       case 32:
          return ANARI_GROUP_light_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_GROUP_usd__timeVarying_info(paramType, infoName, infoType);
-      case 129:
+      case 142:
          return ANARI_GROUP_usd__timeVarying_surface_info(paramType, infoName, infoType);
-      case 133:
+      case 146:
          return ANARI_GROUP_usd__timeVarying_volume_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_GROUP_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1368,6 +1791,38 @@ static const void * ANARI_WORLD_usd__timeVarying_volume_info(ANARIDataType param
       default: return nullptr;
    }
 }
+static const void * ANARI_WORLD_usd__instancing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "reference";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "How the world writes its instances, either reference (an Xform prim referencing the group per instance) or pointInstancer (a UsdGeomPointInstancer per group, with the decomposed instance transforms as arrays)";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_WORLD_usd__removePrim_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -1408,19 +1863,21 @@ static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType
          return ANARI_WORLD_instance_info(paramType, infoName, infoType);
       case 68:
          return ANARI_WORLD_surface_info(paramType, infoName, infoType);
-      case 154:
+      case 167:
          return ANARI_WORLD_volume_info(paramType, infoName, infoType);
       case 32:
          return ANARI_WORLD_light_info(paramType, infoName, infoType);
-      case 105:
-         return ANARI_WORLD_usd__timeVarying_info(paramType, infoName, infoType);
       case 118:
+         return ANARI_WORLD_usd__timeVarying_info(paramType, infoName, infoType);
+      case 131:
          return ANARI_WORLD_usd__timeVarying_instance_info(paramType, infoName, infoType);
-      case 129:
+      case 142:
          return ANARI_WORLD_usd__timeVarying_surface_info(paramType, infoName, infoType);
-      case 133:
+      case 146:
          return ANARI_WORLD_usd__timeVarying_volume_info(paramType, infoName, infoType);
-      case 86:
+      case 84:
+         return ANARI_WORLD_usd__instancing_info(paramType, infoName, infoType);
+      case 95:
          return ANARI_WORLD_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1617,13 +2074,13 @@ static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataTyp
          return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
       case 33:
          return ANARI_SURFACE_material_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_SURFACE_usd__timeVarying_info(paramType, infoName, infoType);
-      case 94:
+      case 107:
          return ANARI_SURFACE_usd__time_geometry_info(paramType, infoName, infoType);
-      case 95:
+      case 108:
          return ANARI_SURFACE_usd__time_material_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_SURFACE_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -2518,6 +2975,38 @@ static const void * ANARI_GEOMETRY_cone_usd__timeVarying_attribute3_info(ANARIDa
       default: return nullptr;
    }
 }
+static const void * ANARI_GEOMETRY_cone_usd__tiling_maxPointsPerTile_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "If nonzero, geometries with more points are written as child prims (tiles) of spatially sorted points, each with a tight extent. 0 disables tiling.";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_GEOMETRY_cone_usd__removePrim_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -2566,49 +3055,51 @@ static const void * ANARI_GEOMETRY_cone_param_info(const char *paramName, ANARID
          return ANARI_GEOMETRY_cone_primitive_attribute3_info(paramType, infoName, infoType);
       case 50:
          return ANARI_GEOMETRY_cone_primitive_id_info(paramType, infoName, infoType);
-      case 150:
+      case 163:
          return ANARI_GEOMETRY_cone_vertex_position_info(paramType, infoName, infoType);
-      case 151:
+      case 164:
          return ANARI_GEOMETRY_cone_vertex_radius_info(paramType, infoName, infoType);
-      case 146:
+      case 159:
          return ANARI_GEOMETRY_cone_vertex_cap_info(paramType, infoName, infoType);
-      case 147:
+      case 160:
          return ANARI_GEOMETRY_cone_vertex_color_info(paramType, infoName, infoType);
-      case 142:
+      case 155:
          return ANARI_GEOMETRY_cone_vertex_attribute0_info(paramType, infoName, infoType);
-      case 143:
+      case 156:
          return ANARI_GEOMETRY_cone_vertex_attribute1_info(paramType, infoName, infoType);
-      case 144:
+      case 157:
          return ANARI_GEOMETRY_cone_vertex_attribute2_info(paramType, infoName, infoType);
-      case 145:
+      case 158:
          return ANARI_GEOMETRY_cone_vertex_attribute3_info(paramType, infoName, infoType);
       case 51:
          return ANARI_GEOMETRY_cone_primitive_index_info(paramType, infoName, infoType);
       case 7:
          return ANARI_GEOMETRY_cone_caps_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_GEOMETRY_cone_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_GEOMETRY_cone_usd__timeVarying_info(paramType, infoName, infoType);
-      case 124:
+      case 137:
          return ANARI_GEOMETRY_cone_usd__timeVarying_position_info(paramType, infoName, infoType);
-      case 111:
+      case 124:
          return ANARI_GEOMETRY_cone_usd__timeVarying_color_info(paramType, infoName, infoType);
-      case 117:
+      case 130:
          return ANARI_GEOMETRY_cone_usd__timeVarying_index_info(paramType, infoName, infoType);
-      case 126:
+      case 139:
          return ANARI_GEOMETRY_cone_usd__timeVarying_radius_info(paramType, infoName, infoType);
-      case 115:
+      case 128:
          return ANARI_GEOMETRY_cone_usd__timeVarying_id_info(paramType, infoName, infoType);
-      case 106:
+      case 119:
          return ANARI_GEOMETRY_cone_usd__timeVarying_attribute0_info(paramType, infoName, infoType);
-      case 107:
+      case 120:
          return ANARI_GEOMETRY_cone_usd__timeVarying_attribute1_info(paramType, infoName, infoType);
-      case 108:
+      case 121:
          return ANARI_GEOMETRY_cone_usd__timeVarying_attribute2_info(paramType, infoName, infoType);
-      case 109:
+      case 122:
          return ANARI_GEOMETRY_cone_usd__timeVarying_attribute3_info(paramType, infoName, infoType);
-      case 86:
+      case 105:
+         return ANARI_GEOMETRY_cone_usd__tiling_maxPointsPerTile_info(paramType, infoName, infoType);
+      case 95:
          return ANARI_GEOMETRY_cone_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -3505,47 +3996,47 @@ static const void * ANARI_GEOMETRY_curve_param_info(const char *paramName, ANARI
          return ANARI_GEOMETRY_curve_primitive_attribute3_info(paramType, infoName, infoType);
       case 50:
          return ANARI_GEOMETRY_curve_primitive_id_info(paramType, infoName, infoType);
-      case 150:
+      case 163:
          return ANARI_GEOMETRY_curve_vertex_position_info(paramType, infoName, infoType);
-      case 151:
+      case 164:
          return ANARI_GEOMETRY_curve_vertex_radius_info(paramType, infoName, infoType);
-      case 147:
+      case 160:
          return ANARI_GEOMETRY_curve_vertex_color_info(paramType, infoName, infoType);
-      case 142:
+      case 155:
          return ANARI_GEOMETRY_curve_vertex_attribute0_info(paramType, infoName, infoType);
-      case 143:
+      case 156:
          return ANARI_GEOMETRY_curve_vertex_attribute1_info(paramType, infoName, infoType);
-      case 144:
+      case 157:
          return ANARI_GEOMETRY_curve_vertex_attribute2_info(paramType, infoName, infoType);
-      case 145:
+      case 158:
          return ANARI_GEOMETRY_curve_vertex_attribute3_info(paramType, infoName, infoType);
       case 51:
          return ANARI_GEOMETRY_curve_primitive_index_info(paramType, infoName, infoType);
       case 53:
          return ANARI_GEOMETRY_curve_radius_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_GEOMETRY_curve_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_GEOMETRY_curve_usd__timeVarying_info(paramType, infoName, infoType);
-      case 124:
+      case 137:
          return ANARI_GEOMETRY_curve_usd__timeVarying_position_info(paramType, infoName, infoType);
-      case 111:
+      case 124:
          return ANARI_GEOMETRY_curve_usd__timeVarying_color_info(paramType, infoName, infoType);
-      case 117:
+      case 130:
          return ANARI_GEOMETRY_curve_usd__timeVarying_index_info(paramType, infoName, infoType);
-      case 126:
+      case 139:
          return ANARI_GEOMETRY_curve_usd__timeVarying_radius_info(paramType, infoName, infoType);
-      case 115:
+      case 128:
          return ANARI_GEOMETRY_curve_usd__timeVarying_id_info(paramType, infoName, infoType);
-      case 106:
+      case 119:
          return ANARI_GEOMETRY_curve_usd__timeVarying_attribute0_info(paramType, infoName, infoType);
-      case 107:
+      case 120:
          return ANARI_GEOMETRY_curve_usd__timeVarying_attribute1_info(paramType, infoName, infoType);
-      case 108:
+      case 121:
          return ANARI_GEOMETRY_curve_usd__timeVarying_attribute2_info(paramType, infoName, infoType);
-      case 109:
+      case 122:
          return ANARI_GEOMETRY_curve_usd__timeVarying_attribute3_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_GEOMETRY_curve_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -4465,6 +4956,38 @@ static const void * ANARI_GEOMETRY_cylinder_usd__timeVarying_attribute3_info(ANA
       default: return nullptr;
    }
 }
+static const void * ANARI_GEOMETRY_cylinder_usd__tiling_maxPointsPerTile_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "If nonzero, geometries with more points are written as child prims (tiles) of spatially sorted points, each with a tight extent. 0 disables tiling.";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_GEOMETRY_cylinder_usd__removePrim_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -4513,19 +5036,19 @@ static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, AN
          return ANARI_GEOMETRY_cylinder_primitive_attribute3_info(paramType, infoName, infoType);
       case 50:
          return ANARI_GEOMETRY_cylinder_primitive_id_info(paramType, infoName, infoType);
-      case 150:
+      case 163:
          return ANARI_GEOMETRY_cylinder_vertex_position_info(paramType, infoName, infoType);
-      case 146:
+      case 159:
          return ANARI_GEOMETRY_cylinder_vertex_cap_info(paramType, infoName, infoType);
-      case 147:
+      case 160:
          return ANARI_GEOMETRY_cylinder_vertex_color_info(paramType, infoName, infoType);
-      case 142:
+      case 155:
          return ANARI_GEOMETRY_cylinder_vertex_attribute0_info(paramType, infoName, infoType);
-      case 143:
+      case 156:
          return ANARI_GEOMETRY_cylinder_vertex_attribute1_info(paramType, infoName, infoType);
-      case 144:
+      case 157:
          return ANARI_GEOMETRY_cylinder_vertex_attribute2_info(paramType, infoName, infoType);
-      case 145:
+      case 158:
          return ANARI_GEOMETRY_cylinder_vertex_attribute3_info(paramType, infoName, infoType);
       case 51:
          return ANARI_GEOMETRY_cylinder_primitive_index_info(paramType, infoName, infoType);
@@ -4535,29 +5058,31 @@ static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, AN
          return ANARI_GEOMETRY_cylinder_radius_info(paramType, infoName, infoType);
       case 7:
          return ANARI_GEOMETRY_cylinder_caps_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_GEOMETRY_cylinder_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_info(paramType, infoName, infoType);
-      case 124:
+      case 137:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_position_info(paramType, infoName, infoType);
-      case 111:
+      case 124:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_color_info(paramType, infoName, infoType);
-      case 117:
+      case 130:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_index_info(paramType, infoName, infoType);
-      case 126:
+      case 139:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_radius_info(paramType, infoName, infoType);
-      case 115:
+      case 128:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_id_info(paramType, infoName, infoType);
-      case 106:
+      case 119:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_attribute0_info(paramType, infoName, infoType);
-      case 107:
+      case 120:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_attribute1_info(paramType, infoName, infoType);
-      case 108:
+      case 121:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_attribute2_info(paramType, infoName, infoType);
-      case 109:
+      case 122:
          return ANARI_GEOMETRY_cylinder_usd__timeVarying_attribute3_info(paramType, infoName, infoType);
-      case 86:
+      case 105:
+         return ANARI_GEOMETRY_cylinder_usd__tiling_maxPointsPerTile_info(paramType, infoName, infoType);
+      case 95:
          return ANARI_GEOMETRY_cylinder_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -5461,47 +5986,47 @@ static const void * ANARI_GEOMETRY_quad_param_info(const char *paramName, ANARID
          return ANARI_GEOMETRY_quad_primitive_attribute3_info(paramType, infoName, infoType);
       case 50:
          return ANARI_GEOMETRY_quad_primitive_id_info(paramType, infoName, infoType);
-      case 150:
+      case 163:
          return ANARI_GEOMETRY_quad_vertex_position_info(paramType, infoName, infoType);
-      case 148:
+      case 161:
          return ANARI_GEOMETRY_quad_vertex_normal_info(paramType, infoName, infoType);
-      case 153:
+      case 166:
          return ANARI_GEOMETRY_quad_vertex_tangent_info(paramType, infoName, infoType);
-      case 147:
+      case 160:
          return ANARI_GEOMETRY_quad_vertex_color_info(paramType, infoName, infoType);
-      case 142:
+      case 155:
          return ANARI_GEOMETRY_quad_vertex_attribute0_info(paramType, infoName, infoType);
-      case 143:
+      case 156:
          return ANARI_GEOMETRY_quad_vertex_attribute1_info(paramType, infoName, infoType);
-      case 144:
+      case 157:
          return ANARI_GEOMETRY_quad_vertex_attribute2_info(paramType, infoName, infoType);
-      case 145:
+      case 158:
          return ANARI_GEOMETRY_quad_vertex_attribute3_info(paramType, infoName, infoType);
       case 51:
          return ANARI_GEOMETRY_quad_primitive_index_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_GEOMETRY_quad_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_GEOMETRY_quad_usd__timeVarying_info(paramType, infoName, infoType);
-      case 124:
+      case 137:
          return ANARI_GEOMETRY_quad_usd__timeVarying_position_info(paramType, infoName, infoType);
-      case 121:
+      case 134:
          return ANARI_GEOMETRY_quad_usd__timeVarying_normal_info(paramType, infoName, infoType);
-      case 111:
+      case 124:
          return ANARI_GEOMETRY_quad_usd__timeVarying_color_info(paramType, infoName, infoType);
-      case 117:
+      case 130:
          return ANARI_GEOMETRY_quad_usd__timeVarying_index_info(paramType, infoName, infoType);
-      case 115:
+      case 128:
          return ANARI_GEOMETRY_quad_usd__timeVarying_id_info(paramType, infoName, infoType);
-      case 106:
+      case 119:
          return ANARI_GEOMETRY_quad_usd__timeVarying_attribute0_info(paramType, infoName, infoType);
-      case 107:
+      case 120:
          return ANARI_GEOMETRY_quad_usd__timeVarying_attribute1_info(paramType, infoName, infoType);
-      case 108:
+      case 121:
          return ANARI_GEOMETRY_quad_usd__timeVarying_attribute2_info(paramType, infoName, infoType);
-      case 109:
+      case 122:
          return ANARI_GEOMETRY_quad_usd__timeVarying_attribute3_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_GEOMETRY_quad_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6382,6 +6907,38 @@ static const void * ANARI_GEOMETRY_sphere_usd__useUsdGeomPoints_info(ANARIDataTy
       default: return nullptr;
    }
 }
+static const void * ANARI_GEOMETRY_sphere_usd__tiling_maxPointsPerTile_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "If nonzero, geometries with more points are written as child prims (tiles) of spatially sorted points, each with a tight extent. 0 disables tiling.";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_GEOMETRY_sphere_usd__removePrim_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -6430,49 +6987,51 @@ static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANAR
          return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
       case 50:
          return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
-      case 150:
+      case 163:
          return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
-      case 151:
+      case 164:
          return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
-      case 147:
+      case 160:
          return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
-      case 142:
+      case 155:
          return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
-      case 143:
+      case 156:
          return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
-      case 144:
+      case 157:
          return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
-      case 145:
+      case 158:
          return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
       case 51:
          return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
       case 53:
          return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_GEOMETRY_sphere_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_info(paramType, infoName, infoType);
-      case 124:
+      case 137:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_position_info(paramType, infoName, infoType);
-      case 111:
+      case 124:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_color_info(paramType, infoName, infoType);
-      case 117:
+      case 130:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_index_info(paramType, infoName, infoType);
-      case 126:
+      case 139:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_radius_info(paramType, infoName, infoType);
-      case 115:
+      case 128:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_id_info(paramType, infoName, infoType);
-      case 106:
+      case 119:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_attribute0_info(paramType, infoName, infoType);
-      case 107:
+      case 120:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_attribute1_info(paramType, infoName, infoType);
-      case 108:
+      case 121:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_attribute2_info(paramType, infoName, infoType);
-      case 109:
+      case 122:
          return ANARI_GEOMETRY_sphere_usd__timeVarying_attribute3_info(paramType, infoName, infoType);
-      case 138:
+      case 151:
          return ANARI_GEOMETRY_sphere_usd__useUsdGeomPoints_info(paramType, infoName, infoType);
-      case 86:
+      case 105:
+         return ANARI_GEOMETRY_sphere_usd__tiling_maxPointsPerTile_info(paramType, infoName, infoType);
+      case 95:
          return ANARI_GEOMETRY_sphere_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7476,45 +8035,45 @@ static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, AN
          return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
       case 50:
          return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
-      case 150:
+      case 163:
          return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
-      case 148:
+      case 161:
          return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
-      case 153:
+      case 166:
          return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
-      case 147:
+      case 160:
          return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
-      case 142:
+      case 155:
          return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
-      case 143:
+      case 156:
          return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
-      case 144:
+      case 157:
          return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
-      case 145:
+      case 158:
          return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
       case 51:
          return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_GEOMETRY_triangle_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_info(paramType, infoName, infoType);
-      case 124:
+      case 137:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_position_info(paramType, infoName, infoType);
-      case 121:
+      case 134:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_normal_info(paramType, infoName, infoType);
-      case 111:
+      case 124:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_color_info(paramType, infoName, infoType);
-      case 117:
+      case 130:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_index_info(paramType, infoName, infoType);
-      case 115:
+      case 128:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_id_info(paramType, infoName, infoType);
-      case 106:
+      case 119:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_attribute0_info(paramType, infoName, infoType);
-      case 107:
+      case 120:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_attribute1_info(paramType, infoName, infoType);
-      case 108:
+      case 121:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_attribute2_info(paramType, infoName, infoType);
-      case 109:
+      case 122:
          return ANARI_GEOMETRY_triangle_usd__timeVarying_attribute3_info(paramType, infoName, infoType);
       case 74:
          return ANARI_GEOMETRY_triangle_usd__attribute0_name_info(paramType, infoName, infoType);
@@ -7524,7 +8083,7 @@ static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, AN
          return ANARI_GEOMETRY_triangle_usd__attribute2_name_info(paramType, infoName, infoType);
       case 77:
          return ANARI_GEOMETRY_triangle_usd__attribute3_name_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_GEOMETRY_triangle_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -8633,6 +9192,38 @@ static const void * ANARI_GEOMETRY_glyph_usd__time_shapeGeometry_info(ANARIDataT
       default: return nullptr;
    }
 }
+static const void * ANARI_GEOMETRY_glyph_usd__tiling_maxPointsPerTile_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "If nonzero, geometries with more points are written as child prims (tiles) of spatially sorted points, each with a tight extent. 0 disables tiling.";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "USD_DEVICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_GEOMETRY_glyph_usd__removePrim_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -8681,23 +9272,23 @@ static const void * ANARI_GEOMETRY_glyph_param_info(const char *paramName, ANARI
          return ANARI_GEOMETRY_glyph_primitive_attribute3_info(paramType, infoName, infoType);
       case 50:
          return ANARI_GEOMETRY_glyph_primitive_id_info(paramType, infoName, infoType);
-      case 150:
+      case 163:
          return ANARI_GEOMETRY_glyph_vertex_position_info(paramType, infoName, infoType);
-      case 152:
+      case 165:
          return ANARI_GEOMETRY_glyph_vertex_scale_info(paramType, infoName, infoType);
-      case 149:
+      case 162:
          return ANARI_GEOMETRY_glyph_vertex_orientation_info(paramType, infoName, infoType);
-      case 146:
+      case 159:
          return ANARI_GEOMETRY_glyph_vertex_cap_info(paramType, infoName, infoType);
-      case 147:
+      case 160:
          return ANARI_GEOMETRY_glyph_vertex_color_info(paramType, infoName, infoType);
-      case 142:
+      case 155:
          return ANARI_GEOMETRY_glyph_vertex_attribute0_info(paramType, infoName, infoType);
-      case 143:
+      case 156:
          return ANARI_GEOMETRY_glyph_vertex_attribute1_info(paramType, infoName, infoType);
-      case 144:
+      case 157:
          return ANARI_GEOMETRY_glyph_vertex_attribute2_info(paramType, infoName, infoType);
-      case 145:
+      case 158:
          return ANARI_GEOMETRY_glyph_vertex_attribute3_info(paramType, infoName, infoType);
       case 51:
          return ANARI_GEOMETRY_glyph_primitive_index_info(paramType, infoName, infoType);
@@ -8713,33 +9304,35 @@ static const void * ANARI_GEOMETRY_glyph_param_info(const char *paramName, ANARI
          return ANARI_GEOMETRY_glyph_shapeGeometry_info(paramType, infoName, infoType);
       case 58:
          return ANARI_GEOMETRY_glyph_shapeTransform_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_GEOMETRY_glyph_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_info(paramType, infoName, infoType);
-      case 124:
+      case 137:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_position_info(paramType, infoName, infoType);
-      case 111:
+      case 124:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_color_info(paramType, infoName, infoType);
-      case 117:
+      case 130:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_index_info(paramType, infoName, infoType);
-      case 128:
+      case 141:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_scale_info(paramType, infoName, infoType);
-      case 123:
+      case 136:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_orientation_info(paramType, infoName, infoType);
-      case 115:
+      case 128:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_id_info(paramType, infoName, infoType);
-      case 106:
+      case 119:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_attribute0_info(paramType, infoName, infoType);
-      case 107:
+      case 120:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_attribute1_info(paramType, infoName, infoType);
-      case 108:
+      case 121:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_attribute2_info(paramType, infoName, infoType);
-      case 109:
+      case 122:
          return ANARI_GEOMETRY_glyph_usd__timeVarying_attribute3_info(paramType, infoName, infoType);
-      case 103:
+      case 116:
          return ANARI_GEOMETRY_glyph_usd__time_shapeGeometry_info(paramType, infoName, infoType);
-      case 86:
+      case 105:
+         return ANARI_GEOMETRY_glyph_usd__tiling_maxPointsPerTile_info(paramType, infoName, infoType);
+      case 95:
          return ANARI_GEOMETRY_glyph_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -9171,13 +9764,13 @@ static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, A
          return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
       case 17:
          return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_CAMERA_perspective_usd__timeVarying_info(paramType, infoName, infoType);
-      case 132:
+      case 145:
          return ANARI_CAMERA_perspective_usd__timeVarying_view_info(paramType, infoName, infoType);
-      case 125:
+      case 138:
          return ANARI_CAMERA_perspective_usd__timeVarying_projection_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_CAMERA_perspective_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -9394,13 +9987,13 @@ static const void * ANARI_INSTANCE_transform_param_info(const char *paramName, A
          return ANARI_INSTANCE_transform_transform_info(paramType, infoName, infoType);
       case 21:
          return ANARI_INSTANCE_transform_group_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_INSTANCE_transform_usd__timeVarying_info(paramType, infoName, infoType);
-      case 114:
+      case 127:
          return ANARI_INSTANCE_transform_usd__timeVarying_group_info(paramType, infoName, infoType);
-      case 130:
+      case 143:
          return ANARI_INSTANCE_transform_usd__timeVarying_transform_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_INSTANCE_transform_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -9769,17 +10362,17 @@ static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARI
          return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
       case 0:
          return ANARI_MATERIAL_matte_alphaCutoff_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_MATERIAL_matte_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_MATERIAL_matte_usd__timeVarying_info(paramType, infoName, infoType);
-      case 111:
+      case 124:
          return ANARI_MATERIAL_matte_usd__timeVarying_color_info(paramType, infoName, infoType);
-      case 97:
+      case 110:
          return ANARI_MATERIAL_matte_usd__time_sampler_color_info(paramType, infoName, infoType);
-      case 101:
+      case 114:
          return ANARI_MATERIAL_matte_usd__time_sampler_opacity_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_MATERIAL_matte_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -11189,35 +11782,35 @@ static const void * ANARI_MATERIAL_physicallyBased_param_info(const char *paramN
          return ANARI_MATERIAL_physicallyBased_iridescenceIor_info(paramType, infoName, infoType);
       case 31:
          return ANARI_MATERIAL_physicallyBased_iridescenceThickness_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_MATERIAL_physicallyBased_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_MATERIAL_physicallyBased_usd__timeVarying_info(paramType, infoName, infoType);
-      case 110:
+      case 123:
          return ANARI_MATERIAL_physicallyBased_usd__timeVarying_baseColor_info(paramType, infoName, infoType);
-      case 122:
+      case 135:
          return ANARI_MATERIAL_physicallyBased_usd__timeVarying_opacity_info(paramType, infoName, infoType);
-      case 113:
+      case 126:
          return ANARI_MATERIAL_physicallyBased_usd__timeVarying_emissive_info(paramType, infoName, infoType);
-      case 127:
+      case 140:
          return ANARI_MATERIAL_physicallyBased_usd__timeVarying_roughness_info(paramType, infoName, infoType);
-      case 120:
+      case 133:
          return ANARI_MATERIAL_physicallyBased_usd__timeVarying_metallic_info(paramType, infoName, infoType);
-      case 119:
+      case 132:
          return ANARI_MATERIAL_physicallyBased_usd__timeVarying_ior_info(paramType, infoName, infoType);
-      case 96:
+      case 109:
          return ANARI_MATERIAL_physicallyBased_usd__time_sampler_baseColor_info(paramType, infoName, infoType);
-      case 101:
+      case 114:
          return ANARI_MATERIAL_physicallyBased_usd__time_sampler_opacity_info(paramType, infoName, infoType);
-      case 98:
+      case 111:
          return ANARI_MATERIAL_physicallyBased_usd__time_sampler_emissive_info(paramType, infoName, infoType);
-      case 102:
+      case 115:
          return ANARI_MATERIAL_physicallyBased_usd__time_sampler_roughness_info(paramType, infoName, infoType);
-      case 100:
+      case 113:
          return ANARI_MATERIAL_physicallyBased_usd__time_sampler_metallic_info(paramType, infoName, infoType);
-      case 99:
+      case 112:
          return ANARI_MATERIAL_physicallyBased_usd__time_sampler_ior_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_MATERIAL_physicallyBased_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -11713,7 +12306,7 @@ static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANAR
          return ANARI_SAMPLER_image1D_inAttribute_info(paramType, infoName, infoType);
       case 18:
          return ANARI_SAMPLER_image1D_filter_info(paramType, infoName, infoType);
-      case 156:
+      case 169:
          return ANARI_SAMPLER_image1D_wrapMode1_info(paramType, infoName, infoType);
       case 26:
          return ANARI_SAMPLER_image1D_inTransform_info(paramType, infoName, infoType);
@@ -11723,17 +12316,17 @@ static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANAR
          return ANARI_SAMPLER_image1D_outTransform_info(paramType, infoName, infoType);
       case 42:
          return ANARI_SAMPLER_image1D_outOffset_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_SAMPLER_image1D_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_SAMPLER_image1D_usd__timeVarying_info(paramType, infoName, infoType);
-      case 116:
+      case 129:
          return ANARI_SAMPLER_image1D_usd__timeVarying_image_info(paramType, infoName, infoType);
-      case 134:
+      case 147:
          return ANARI_SAMPLER_image1D_usd__timeVarying_wrapMode_info(paramType, infoName, infoType);
-      case 81:
+      case 83:
          return ANARI_SAMPLER_image1D_usd__imageUrl_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_SAMPLER_image1D_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -12300,9 +12893,9 @@ static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANAR
          return ANARI_SAMPLER_image2D_inAttribute_info(paramType, infoName, infoType);
       case 18:
          return ANARI_SAMPLER_image2D_filter_info(paramType, infoName, infoType);
-      case 156:
+      case 169:
          return ANARI_SAMPLER_image2D_wrapMode1_info(paramType, infoName, infoType);
-      case 157:
+      case 170:
          return ANARI_SAMPLER_image2D_wrapMode2_info(paramType, infoName, infoType);
       case 26:
          return ANARI_SAMPLER_image2D_inTransform_info(paramType, infoName, infoType);
@@ -12312,19 +12905,19 @@ static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANAR
          return ANARI_SAMPLER_image2D_outTransform_info(paramType, infoName, infoType);
       case 42:
          return ANARI_SAMPLER_image2D_outOffset_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_SAMPLER_image2D_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_SAMPLER_image2D_usd__timeVarying_info(paramType, infoName, infoType);
-      case 116:
+      case 129:
          return ANARI_SAMPLER_image2D_usd__timeVarying_image_info(paramType, infoName, infoType);
-      case 135:
+      case 148:
          return ANARI_SAMPLER_image2D_usd__timeVarying_wrapMode1_info(paramType, infoName, infoType);
-      case 136:
+      case 149:
          return ANARI_SAMPLER_image2D_usd__timeVarying_wrapMode2_info(paramType, infoName, infoType);
-      case 81:
+      case 83:
          return ANARI_SAMPLER_image2D_usd__imageUrl_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_SAMPLER_image2D_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -12962,11 +13555,11 @@ static const void * ANARI_SAMPLER_image3D_param_info(const char *paramName, ANAR
          return ANARI_SAMPLER_image3D_inAttribute_info(paramType, infoName, infoType);
       case 18:
          return ANARI_SAMPLER_image3D_filter_info(paramType, infoName, infoType);
-      case 156:
+      case 169:
          return ANARI_SAMPLER_image3D_wrapMode1_info(paramType, infoName, infoType);
-      case 157:
+      case 170:
          return ANARI_SAMPLER_image3D_wrapMode2_info(paramType, infoName, infoType);
-      case 158:
+      case 171:
          return ANARI_SAMPLER_image3D_wrapMode3_info(paramType, infoName, infoType);
       case 26:
          return ANARI_SAMPLER_image3D_inTransform_info(paramType, infoName, infoType);
@@ -12976,21 +13569,21 @@ static const void * ANARI_SAMPLER_image3D_param_info(const char *paramName, ANAR
          return ANARI_SAMPLER_image3D_outTransform_info(paramType, infoName, infoType);
       case 42:
          return ANARI_SAMPLER_image3D_outOffset_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_SAMPLER_image3D_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_SAMPLER_image3D_usd__timeVarying_info(paramType, infoName, infoType);
-      case 116:
+      case 129:
          return ANARI_SAMPLER_image3D_usd__timeVarying_image_info(paramType, infoName, infoType);
-      case 135:
+      case 148:
          return ANARI_SAMPLER_image3D_usd__timeVarying_wrapMode1_info(paramType, infoName, infoType);
-      case 136:
+      case 149:
          return ANARI_SAMPLER_image3D_usd__timeVarying_wrapMode2_info(paramType, infoName, infoType);
-      case 137:
+      case 150:
          return ANARI_SAMPLER_image3D_usd__timeVarying_wrapMode3_info(paramType, infoName, infoType);
-      case 81:
+      case 83:
          return ANARI_SAMPLER_image3D_usd__imageUrl_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_SAMPLER_image3D_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -13289,13 +13882,13 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char
          return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
       case 18:
          return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
-      case 93:
+      case 106:
          return ANARI_SPATIAL_FIELD_structuredRegular_usd__time_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_SPATIAL_FIELD_structuredRegular_usd__timeVarying_info(paramType, infoName, infoType);
-      case 112:
+      case 125:
          return ANARI_SPATIAL_FIELD_structuredRegular_usd__timeVarying_data_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_SPATIAL_FIELD_structuredRegular_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -13693,9 +14286,9 @@ static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *param
    switch(param_hash(paramName)) {
       case 35:
          return ANARI_VOLUME_transferFunction1D_name_info(paramType, infoName, infoType);
-      case 140:
+      case 153:
          return ANARI_VOLUME_transferFunction1D_value_info(paramType, infoName, infoType);
-      case 141:
+      case 154:
          return ANARI_VOLUME_transferFunction1D_valueRange_info(paramType, infoName, infoType);
       case 13:
          return ANARI_VOLUME_transferFunction1D_color_info(paramType, infoName, infoType);
@@ -13703,19 +14296,19 @@ static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *param
          return ANARI_VOLUME_transferFunction1D_opacity_info(paramType, infoName, infoType);
       case 72:
          return ANARI_VOLUME_transferFunction1D_unitDistance_info(paramType, infoName, infoType);
-      case 105:
+      case 118:
          return ANARI_VOLUME_transferFunction1D_usd__timeVarying_info(paramType, infoName, infoType);
-      case 111:
+      case 124:
          return ANARI_VOLUME_transferFunction1D_usd__timeVarying_color_info(paramType, infoName, infoType);
-      case 122:
+      case 135:
          return ANARI_VOLUME_transferFunction1D_usd__timeVarying_opacity_info(paramType, infoName, infoType);
-      case 131:
+      case 144:
          return ANARI_VOLUME_transferFunction1D_usd__timeVarying_valueRange_info(paramType, infoName, infoType);
-      case 85:
+      case 94:
          return ANARI_VOLUME_transferFunction1D_usd__preClassified_info(paramType, infoName, infoType);
-      case 104:
+      case 117:
          return ANARI_VOLUME_transferFunction1D_usd__time_value_info(paramType, infoName, infoType);
-      case 86:
+      case 95:
          return ANARI_VOLUME_transferFunction1D_usd__removePrim_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -13862,11 +14455,22 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
                {"usd::serialize.location", ANARI_STRING},
                {"usd::serialize.newSession", ANARI_BOOL},
                {"usd::serialize.outputBinary", ANARI_BOOL},
+               {"usd::serialize.async", ANARI_BOOL},
+               {"usd::serialize.asyncMaxFrames", ANARI_INT32},
+               {"usd::serialize.timestepsPerLayer", ANARI_INT32},
                {"usd::time", ANARI_FLOAT64},
                {"usd::writeAtCommit", ANARI_BOOL},
+               {"usd::flush.threads", ANARI_INT32},
+               {"usd::memory.scratchLimit", ANARI_UINT64},
+               {"usd::memory.keepTimesteps", ANARI_INT32},
+               {"usd::lod.ratios", ANARI_FLOAT32_VEC4},
+               {"usd::lod.minPrimitives", ANARI_UINT64},
                {"usd::output.material", ANARI_BOOL},
                {"usd::output.previewSurfaceShader", ANARI_BOOL},
                {"usd::output.mdlShader", ANARI_BOOL},
+               {"usd::output.indexedPrimvars", ANARI_BOOL},
+               {"usd::output.precision", ANARI_STRING},
+               {"usd::garbageCollect.timeBudget", ANARI_FLOAT32},
                {"usd::connection.logVerbosity", ANARI_INT32},
                {"usd::sceneStage", ANARI_VOID_POINTER},
                {"usd::enableSaving", ANARI_BOOL},
@@ -14048,6 +14652,7 @@ static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
                {"usd::timeVarying.instance", ANARI_BOOL},
                {"usd::timeVarying.surface", ANARI_BOOL},
                {"usd::timeVarying.volume", ANARI_BOOL},
+               {"usd::instancing", ANARI_STRING},
                {"usd::removePrim", ANARI_BOOL},
                {0, ANARI_UNKNOWN}
             };
@@ -14168,6 +14773,7 @@ static const void * ANARI_GEOMETRY_cone_info(int infoName, ANARIDataType infoTyp
                {"usd::timeVarying.attribute1", ANARI_BOOL},
                {"usd::timeVarying.attribute2", ANARI_BOOL},
                {"usd::timeVarying.attribute3", ANARI_BOOL},
+               {"usd::tiling.maxPointsPerTile", ANARI_UINT64},
                {"usd::removePrim", ANARI_BOOL},
                {0, ANARI_UNKNOWN}
             };
@@ -14284,6 +14890,7 @@ static const void * ANARI_GEOMETRY_cylinder_info(int infoName, ANARIDataType inf
                {"usd::timeVarying.attribute1", ANARI_BOOL},
                {"usd::timeVarying.attribute2", ANARI_BOOL},
                {"usd::timeVarying.attribute3", ANARI_BOOL},
+               {"usd::tiling.maxPointsPerTile", ANARI_UINT64},
                {"usd::removePrim", ANARI_BOOL},
                {0, ANARI_UNKNOWN}
             };
@@ -14399,6 +15006,7 @@ static const void * ANARI_GEOMETRY_sphere_info(int infoName, ANARIDataType infoT
                {"usd::timeVarying.attribute2", ANARI_BOOL},
                {"usd::timeVarying.attribute3", ANARI_BOOL},
                {"usd::useUsdGeomPoints", ANARI_BOOL},
+               {"usd::tiling.maxPointsPerTile", ANARI_UINT64},
                {"usd::removePrim", ANARI_BOOL},
                {0, ANARI_UNKNOWN}
             };
@@ -14526,6 +15134,7 @@ static const void * ANARI_GEOMETRY_glyph_info(int infoName, ANARIDataType infoTy
                {"usd::timeVarying.attribute2", ANARI_BOOL},
                {"usd::timeVarying.attribute3", ANARI_BOOL},
                {"usd::time.shapeGeometry", ANARI_INT32},
+               {"usd::tiling.maxPointsPerTile", ANARI_UINT64},
                {"usd::removePrim", ANARI_BOOL},
                {0, ANARI_UNKNOWN}
             };
@@ -7,6 +7,8 @@
 #include "UsdDevice.h"
 #include "anari/frontend/type_utility.h"
 
+#include <algorithm>
+
 DEFINE_PARAMETER_MAP(UsdFrame,
   REGISTER_PARAMETER_MACRO("size", ANARI_UINT32_VEC2, size)
   REGISTER_PARAMETER_MACRO("channel.color", ANARI_DATA_TYPE, color)
@@ -88,5 +90,38 @@ char* UsdFrame::ReserveBuffer(ANARIDataType format)
 
 void UsdFrame::saveUsd(UsdDevice* device)
 {
-  device->getUsdBridge()->SaveScene();
+  const UsdDeviceData& deviceParams = device->getReadParams();
+  UsdBridge* usdBridge = device->getUsdBridge();
+
+  if(deviceParams.asyncSave)
+  {
+    uint32_t maxPendingSaves = (uint32_t)std::max(deviceParams.asyncMaxFrames, 1);
+    saveId = usdBridge->SaveSceneAsync(maxPendingSaves);
+  }
+  else
+  {
+    usdBridge->SaveScene();
+    saveId = 0;
+  }
+}
+
+bool UsdFrame::isReady(UsdDevice* device, bool wait)
+{
+  if(!saveId)
+    return true;
+
+  if(!device->getUsdBridge()->IsSaveFinished(saveId, wait))
+    return false;
+
+  saveId = 0;
+  return true;
+}
+
+void UsdFrame::discard(UsdDevice* device)
+{
+  if(!saveId)
+    return;
+
+  device->getUsdBridge()->CancelSave(saveId);
+  saveId = 0;
 }
@@ -31,6 +31,8 @@ class UsdFrame : public UsdParameterizedBaseObject<UsdFrame, UsdFrameData>
     void unmapBuffer(const char* channel);
 
     void saveUsd(UsdDevice* device);
+    bool isReady(UsdDevice* device, bool wait); // Whether the save issued by the last saveUsd has finished
+    void discard(UsdDevice* device);
 
   protected:
     bool deferCommit(UsdDevice* device) override;
@@ -41,4 +43,6 @@ class UsdFrame : public UsdParameterizedBaseObject<UsdFrame, UsdFrameData>
 
     char* mappedColorMem = nullptr;
     char* mappedDepthMem = nullptr;
+
+    uint64_t saveId = 0; // Outstanding background save, see UsdBridge::SaveSceneAsync
 };
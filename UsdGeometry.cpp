@@ -8,7 +8,10 @@
 #include "UsdBridgeUtils.h"
 #include "anari/frontend/type_utility.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <memory>
 
 DEFINE_PARAMETER_MAP(UsdGeometry,
   REGISTER_PARAMETER_MACRO("name", ANARI_STRING, name)
@@ -17,6 +20,7 @@ DEFINE_PARAMETER_MAP(UsdGeometry,
   REGISTER_PARAMETER_MACRO("usd::timeVarying", ANARI_INT32, timeVarying)
   REGISTER_PARAMETER_MACRO("usd::time.shapeGeometry", ANARI_FLOAT64, shapeGeometryRefTimeStep)
   REGISTER_PARAMETER_MACRO("usd::useUsdGeomPoints", ANARI_BOOL, UseUsdGeomPoints)
+  REGISTER_PARAMETER_MACRO("usd::tiling.maxPointsPerTile", ANARI_UINT64, maxPointsPerTile)
   REGISTER_PARAMETER_MACRO("primitive.index", ANARI_ARRAY, indices)
   REGISTER_PARAMETER_MACRO("primitive.normal", ANARI_ARRAY, primitiveNormals)
   REGISTER_PARAMETER_MACRO("primitive.color", ANARI_ARRAY, primitiveColors)
@@ -69,29 +73,6 @@ struct UsdGeometryTempArrays
     ColorsArrayType = type;
   }
 
-  void reserveColorsArray(size_t numElements)
-  {
-    ColorsArray.reserve(numElements*anari::sizeOf(ColorsArrayType));
-  }
-
-  size_t expandColorsArray(size_t numElements)
-  {
-    size_t startByte = ColorsArray.size();
-    size_t typeSize = anari::sizeOf(ColorsArrayType);
-    ColorsArray.resize(startByte+numElements*typeSize);
-    return startByte/typeSize;
-  }
-
-  void copyToColorsArray(const void* source, size_t srcIdx, size_t destIdx, size_t numElements)
-  {
-    size_t typeSize = anari::sizeOf(ColorsArrayType);
-    size_t srcStart = srcIdx*typeSize;
-    size_t dstStart = destIdx*typeSize;
-    size_t numBytes = numElements*typeSize;
-    assert(dstStart+numBytes <= ColorsArray.size());
-    memcpy(ColorsArray.data()+dstStart, reinterpret_cast<const char*>(source)+srcStart, numBytes);
-  }
-
   void resetAttributeDataArray(size_t attribIdx, size_t numElements)
   {
     if(Attributes[attribIdx].Data)
@@ -102,41 +83,6 @@ struct UsdGeometryTempArrays
     else
       AttributeDataArrays[attribIdx].resize(0);
   }
-
-  void reserveAttributeDataArray(size_t attribIdx, size_t numElements)
-  {
-    if(Attributes[attribIdx].Data)
-    {
-      uint32_t eltSize = Attributes[attribIdx].EltSize;
-      AttributeDataArrays[attribIdx].reserve(numElements*eltSize);
-    }
-  }
-
-  size_t expandAttributeDataArray(size_t attribIdx, size_t numElements)
-  {
-    if(Attributes[attribIdx].Data)
-    {
-      uint32_t eltSize = Attributes[attribIdx].EltSize;
-      size_t startByte = AttributeDataArrays[attribIdx].size();
-      AttributeDataArrays[attribIdx].resize(startByte+numElements*eltSize);
-      return startByte/eltSize;
-    }
-    return 0;
-  }
-
-  void copyToAttributeDataArray(size_t attribIdx, size_t srcIdx, size_t destIdx, size_t numElements)
-  {
-    if(Attributes[attribIdx].Data)
-    {
-      uint32_t eltSize = Attributes[attribIdx].EltSize;
-      const void* attribSrc = reinterpret_cast<const char*>(Attributes[attribIdx].Data) + srcIdx*eltSize;
-      size_t dstStart = destIdx*eltSize;
-      size_t numBytes = numElements*eltSize;
-      assert(dstStart+numBytes <= AttributeDataArrays[attribIdx].size());
-      void* attribDest = &AttributeDataArrays[attribIdx][dstStart];
-      memcpy(attribDest, attribSrc, numElements*eltSize);
-    }
-  }
 };
 
 namespace
@@ -203,222 +149,418 @@ namespace
     return (bool)(value & (1 << bit));
   }
 
-  size_t getIndex(const void* indices, ANARIDataType type, size_t elt)
+  // Element conversions are split into chunks, which are processed in parallel above a threshold
+  constexpr uint64_t convertChunkSize = 1 << 16;
+  constexpr uint64_t convertParallelThreshold = 4 * convertChunkSize;
+
+  inline uint64_t getNumConvertChunks(uint64_t numElements)
   {
-    size_t result;
-    switch (type)
+    return (numElements + convertChunkSize - 1) / convertChunkSize;
+  }
+
+  // Calls func(chunkIdx, begin, end) for all chunks of [0, numElements), over numThreads as passed to ubutils::ParallelFor
+  template<typename FuncType>
+  void forEachConvertChunk(uint64_t numElements, unsigned int numThreads, const FuncType& func)
+  {
+    if(numElements < convertParallelThreshold)
+      numThreads = 1;
+    ubutils::ParallelFor(getNumConvertChunks(numElements), numThreads, [numElements, &func](size_t chunkIdx)
+    {
+      uint64_t begin = chunkIdx * convertChunkSize;
+      func(chunkIdx, begin, std::min(begin + convertChunkSize, numElements));
+    });
+  }
+
+  // Stands in for a missing index array
+  struct IdentityIndices
+  {
+    size_t operator[](size_t idx) const { return idx; }
+  };
+
+  // Reads every stride-th element of an index array
+  template<typename IndexType, size_t stride>
+  struct StridedIndices
+  {
+    IndexType Indices;
+    size_t operator[](size_t idx) const { return static_cast<size_t>(Indices[idx*stride]); }
+  };
+
+  // Calls func with a typed pointer to the (1 or 2-component) indices, or IdentityIndices if there are none
+  template<typename FuncType>
+  void dispatchIndices(const void* indices, ANARIDataType indexType, const FuncType& func)
+  {
+    if (!indices)
+    {
+      func(IdentityIndices());
+      return;
+    }
+    switch (indexType)
     {
       case ANARI_INT32:
       case ANARI_INT32_VEC2:
-        result = (reinterpret_cast<const int*>(indices))[elt];
-        break;
+        func(reinterpret_cast<const int32_t*>(indices)); break;
       case ANARI_UINT32:
       case ANARI_UINT32_VEC2:
-        result = (reinterpret_cast<const uint32_t*>(indices))[elt];
-        break;
+        func(reinterpret_cast<const uint32_t*>(indices)); break;
       case ANARI_INT64:
       case ANARI_INT64_VEC2:
-        result = (reinterpret_cast<const int64_t*>(indices))[elt];
-        break;
+        func(reinterpret_cast<const int64_t*>(indices)); break;
       case ANARI_UINT64:
       case ANARI_UINT64_VEC2:
-        result = (reinterpret_cast<const uint64_t*>(indices))[elt];
-        break;
-      default:
-        result = 0;
-        break;
+        func(reinterpret_cast<const uint64_t*>(indices)); break;
+      default: break; // Rejected by checkGeomParams
     }
-    return result;
   }
 
-  void getValues1(const void* vertices, ANARIDataType type, size_t idx, float* result)
+  // Calls func with a typed pointer to 3-component float or double vertex data
+  template<typename FuncType>
+  void dispatchVertices(const void* vertices, ANARIDataType vertexType, const FuncType& func)
+  {
+    if (vertexType == ANARI_FLOAT32_VEC3)
+      func(reinterpret_cast<const float*>(vertices));
+    else if (vertexType == ANARI_FLOAT64_VEC3)
+      func(reinterpret_cast<const double*>(vertices));
+  }
+
+  // With vertices referenced by multiple primitives, only the last referencing primitive (stored as primIdx+1) may write,
+  // so the outcome of a parallel scatter equals that of a serial loop. A null owner array means the range is processed serially.
+  using VertexOwner = std::atomic<uint64_t>;
+
+  inline bool ownsVertex(const VertexOwner* vertOwners, size_t vertIdx, uint64_t primIdx)
   {
-    if (type == ANARI_FLOAT32)
+    return !vertOwners || vertOwners[vertIdx].load(std::memory_order_relaxed) == primIdx+1;
+  }
+
+  template<typename IndexType>
+  void claimVertexOwners(IndexType indices, uint64_t primBegin, uint64_t primEnd, VertexOwner* vertOwners)
+  {
+    for (uint64_t primIdx = primBegin; primIdx < primEnd; ++primIdx)
     {
-      const float* vertf = reinterpret_cast<const float*>(vertices);
-      result[0] = vertf[idx];
+      VertexOwner& owner = vertOwners[static_cast<size_t>(indices[primIdx])];
+      uint64_t claim = primIdx+1;
+      uint64_t current = owner.load(std::memory_order_relaxed);
+      while (current < claim && !owner.compare_exchange_weak(current, claim, std::memory_order_relaxed))
+        ;
     }
-    else if (type == ANARI_FLOAT64)
+  }
+
+  template<typename IndexType, typename SrcType, int numComps>
+  void scatterPerPrimValues(IndexType indices, const SrcType* source, float* dest, uint64_t primBegin, uint64_t primEnd, const VertexOwner* vertOwners)
+  {
+    for (uint64_t primIdx = primBegin; primIdx < primEnd; ++primIdx)
     {
-      const double* vertd = reinterpret_cast<const double*>(vertices);
-      result[0] = (float)vertd[idx];
+      size_t vertIdx = static_cast<size_t>(indices[primIdx]);
+      if (ownsVertex(vertOwners, vertIdx, primIdx))
+      {
+        for (int comp = 0; comp < numComps; ++comp)
+          dest[vertIdx*numComps + comp] = static_cast<float>(source[primIdx*numComps + comp]);
+      }
     }
   }
 
-  void getValues2(const void* vertices, ANARIDataType type, size_t idx, float* result)
+  template<typename IndexType, int numComps>
+  void scatterPerPrimFloats(IndexType indices, const UsdDataArray* source, float* dest, uint64_t primBegin, uint64_t primEnd, const VertexOwner* vertOwners)
   {
-    if (type == ANARI_FLOAT32_VEC2)
+    constexpr ANARIDataType float32Types[] = {ANARI_UNKNOWN, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4};
+    constexpr ANARIDataType float64Types[] = {ANARI_UNKNOWN, ANARI_FLOAT64, ANARI_FLOAT64_VEC2, ANARI_FLOAT64_VEC3, ANARI_FLOAT64_VEC4};
+
+    ANARIDataType sourceType = source->getType();
+    if (sourceType == float32Types[numComps])
+      scatterPerPrimValues<IndexType, float, numComps>(indices, reinterpret_cast<const float*>(source->getData()), dest, primBegin, primEnd, vertOwners);
+    else if (sourceType == float64Types[numComps])
+      scatterPerPrimValues<IndexType, double, numComps>(indices, reinterpret_cast<const double*>(source->getData()), dest, primBegin, primEnd, vertOwners);
+  }
+
+  template<typename IndexType, size_t fixedEltSize>
+  void scatterPerPrimBytes(IndexType indices, const void* source, void* dest, size_t eltSize, uint64_t primBegin, uint64_t primEnd, const VertexOwner* vertOwners)
+  {
+    const size_t copySize = fixedEltSize ? fixedEltSize : eltSize; // Fixed sizes turn the memcpy into plain moves
+    const char* srcBytes = reinterpret_cast<const char*>(source);
+    char* dstBytes = reinterpret_cast<char*>(dest);
+    for (uint64_t primIdx = primBegin; primIdx < primEnd; ++primIdx)
     {
-      const float* vertf = reinterpret_cast<const float*>(vertices);
-      result[0] = vertf[idx * 2];
-      result[1] = vertf[idx * 2 + 1];
+      size_t vertIdx = static_cast<size_t>(indices[primIdx]);
+      if (ownsVertex(vertOwners, vertIdx, primIdx))
+        memcpy(dstBytes + vertIdx*copySize, srcBytes + primIdx*copySize, copySize);
     }
-    else if (type == ANARI_FLOAT64_VEC2)
+  }
+
+  template<typename IndexType>
+  void scatterPerPrimBytes(IndexType indices, const void* source, void* dest, size_t eltSize, uint64_t primBegin, uint64_t primEnd, const VertexOwner* vertOwners)
+  {
+    switch (eltSize)
     {
-      const double* vertd = reinterpret_cast<const double*>(vertices);
-      result[0] = (float)vertd[idx * 2];
-      result[1] = (float)vertd[idx * 2 + 1];
+      case 1: scatterPerPrimBytes<IndexType, 1>(indices, source, dest, eltSize, primBegin, primEnd, vertOwners); break;
+      case 2: scatterPerPrimBytes<IndexType, 2>(indices, source, dest, eltSize, primBegin, primEnd, vertOwners); break;
+      case 4: scatterPerPrimBytes<IndexType, 4>(indices, source, dest, eltSize, primBegin, primEnd, vertOwners); break;
+      case 8: scatterPerPrimBytes<IndexType, 8>(indices, source, dest, eltSize, primBegin, primEnd, vertOwners); break;
+      case 12: scatterPerPrimBytes<IndexType, 12>(indices, source, dest, eltSize, primBegin, primEnd, vertOwners); break;
+      case 16: scatterPerPrimBytes<IndexType, 16>(indices, source, dest, eltSize, primBegin, primEnd, vertOwners); break;
+      default: scatterPerPrimBytes<IndexType, 0>(indices, source, dest, eltSize, primBegin, primEnd, vertOwners); break;
     }
   }
 
-  void getValues3(const void* vertices, ANARIDataType type, size_t idx, float* result)
+  // Returns the max of all ids in the range, including those of primitives which don't own their vertex
+  template<typename IndexType, typename IdType>
+  int64_t scatterPerPrimIds(IndexType indices, const IdType* ids, int64_t* dest, uint64_t primBegin, uint64_t primEnd, const VertexOwner* vertOwners)
   {
-    if (type == ANARI_FLOAT32_VEC3)
+    int64_t maxId = -1;
+    for (uint64_t primIdx = primBegin; primIdx < primEnd; ++primIdx)
     {
-      const float* vertf = reinterpret_cast<const float*>(vertices);
-      result[0] = vertf[idx * 3];
-      result[1] = vertf[idx * 3 + 1];
-      result[2] = vertf[idx * 3 + 2];
+      size_t vertIdx = static_cast<size_t>(indices[primIdx]);
+      int64_t id = ids ? static_cast<int64_t>(ids[primIdx]) : static_cast<int64_t>(vertIdx);
+      if (ownsVertex(vertOwners, vertIdx, primIdx))
+        dest[vertIdx] = id;
+      if (id > maxId)
+        maxId = id;
     }
-    else if (type == ANARI_FLOAT64_VEC3)
+    return maxId;
+  }
+
+  template<typename IndexType>
+  int64_t scatterPerPrimIds(IndexType indices, const UsdDataArray* ids, int64_t* dest, uint64_t primBegin, uint64_t primEnd, const VertexOwner* vertOwners)
+  {
+    if (!ids)
+      return scatterPerPrimIds<IndexType, int32_t>(indices, nullptr, dest, primBegin, primEnd, vertOwners);
+
+    const void* idData = ids->getData();
+    switch (ids->getType())
     {
-      const double* vertd = reinterpret_cast<const double*>(vertices);
-      result[0] = (float)vertd[idx * 3];
-      result[1] = (float)vertd[idx * 3 + 1];
-      result[2] = (float)vertd[idx * 3 + 2];
+      case ANARI_INT32: return scatterPerPrimIds(indices, reinterpret_cast<const int32_t*>(idData), dest, primBegin, primEnd, vertOwners);
+      case ANARI_UINT32: return scatterPerPrimIds(indices, reinterpret_cast<const uint32_t*>(idData), dest, primBegin, primEnd, vertOwners);
+      case ANARI_INT64: return scatterPerPrimIds(indices, reinterpret_cast<const int64_t*>(idData), dest, primBegin, primEnd, vertOwners);
+      case ANARI_UINT64: return scatterPerPrimIds(indices, reinterpret_cast<const uint64_t*>(idData), dest, primBegin, primEnd, vertOwners);
+      default: return -1; // Rejected by checkGeomParams
     }
   }
 
-  void getValues4(const void* vertices, ANARIDataType type, size_t idx, float* result)
+  template<typename IndexType, typename SrcType, int numComps>
+  void gatherValues(IndexType srcIndices, const SrcType* source, float* dest, uint64_t begin, uint64_t end)
   {
-    if (type == ANARI_FLOAT32_VEC4)
+    for (uint64_t idx = begin; idx < end; ++idx)
     {
-      const float* vertf = reinterpret_cast<const float*>(vertices);
-      result[0] = vertf[idx * 4];
-      result[1] = vertf[idx * 4 + 1];
-      result[2] = vertf[idx * 4 + 2];
-      result[3] = vertf[idx * 4 + 3];
+      size_t srcIdx = static_cast<size_t>(srcIndices[idx]);
+      for (int comp = 0; comp < numComps; ++comp)
+        dest[idx*numComps + comp] = static_cast<float>(source[srcIdx*numComps + comp]);
     }
-    else if (type == ANARI_FLOAT64_VEC4)
+  }
+
+  template<typename IndexType, int numComps>
+  void gatherFloats(IndexType srcIndices, const UsdDataArray* source, float* dest, uint64_t begin, uint64_t end)
+  {
+    constexpr ANARIDataType float32Types[] = {ANARI_UNKNOWN, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4};
+    constexpr ANARIDataType float64Types[] = {ANARI_UNKNOWN, ANARI_FLOAT64, ANARI_FLOAT64_VEC2, ANARI_FLOAT64_VEC3, ANARI_FLOAT64_VEC4};
+
+    ANARIDataType sourceType = source->getType();
+    if (sourceType == float32Types[numComps])
+      gatherValues<IndexType, float, numComps>(srcIndices, reinterpret_cast<const float*>(source->getData()), dest, begin, end);
+    else if (sourceType == float64Types[numComps])
+      gatherValues<IndexType, double, numComps>(srcIndices, reinterpret_cast<const double*>(source->getData()), dest, begin, end);
+  }
+
+  template<typename IndexType, size_t fixedEltSize>
+  void gatherBytes(IndexType srcIndices, const void* source, void* dest, size_t eltSize, uint64_t begin, uint64_t end)
+  {
+    const size_t copySize = fixedEltSize ? fixedEltSize : eltSize;
+    const char* srcBytes = reinterpret_cast<const char*>(source);
+    char* dstBytes = reinterpret_cast<char*>(dest);
+    for (uint64_t idx = begin; idx < end; ++idx)
+      memcpy(dstBytes + idx*copySize, srcBytes + static_cast<size_t>(srcIndices[idx])*copySize, copySize);
+  }
+
+  template<typename IndexType>
+  void gatherBytes(IndexType srcIndices, const void* source, void* dest, size_t eltSize, uint64_t begin, uint64_t end)
+  {
+    switch (eltSize)
     {
-      const double* vertd = reinterpret_cast<const double*>(vertices);
-      result[0] = (float)vertd[idx * 4];
-      result[1] = (float)vertd[idx * 4 + 1];
-      result[2] = (float)vertd[idx * 4 + 2];
-      result[3] = (float)vertd[idx * 4 + 3];
+      case 1: gatherBytes<IndexType, 1>(srcIndices, source, dest, eltSize, begin, end); break;
+      case 2: gatherBytes<IndexType, 2>(srcIndices, source, dest, eltSize, begin, end); break;
+      case 4: gatherBytes<IndexType, 4>(srcIndices, source, dest, eltSize, begin, end); break;
+      case 8: gatherBytes<IndexType, 8>(srcIndices, source, dest, eltSize, begin, end); break;
+      case 12: gatherBytes<IndexType, 12>(srcIndices, source, dest, eltSize, begin, end); break;
+      case 16: gatherBytes<IndexType, 16>(srcIndices, source, dest, eltSize, begin, end); break;
+      default: gatherBytes<IndexType, 0>(srcIndices, source, dest, eltSize, begin, end); break;
     }
   }
 
-  void generateIndexedSphereData(const UsdGeometryData& paramData, const UsdGeometry::AttributeArray& attributeArray, UsdGeometryTempArrays* tempArrays)
+  template<typename IndexType>
+  void generateIndexedSphereDataTyped(const UsdGeometryData& paramData, const UsdGeometry::AttributeArray& attributeArray, UsdGeometryTempArrays* tempArrays,
+    IndexType indices, uint64_t numIndices, unsigned int numThreads)
   {
-    if (paramData.indices)
+    auto& attribDataArrays = tempArrays->AttributeDataArrays;
+    assert(attribDataArrays.size() == attributeArray.size());
+
+    uint64_t numVertices = paramData.vertexPositions->getLayout().numItems1;
+
+    ANARIDataType scaleType = paramData.vertexScales ? paramData.vertexScales->getType()
+      : (paramData.primitiveScales ? paramData.primitiveScales->getType() : ANARI_UNKNOWN);
+    size_t scaleComps = anari::componentsOf(scaleType);
+
+    bool perPrimNormals = !paramData.vertexNormals && paramData.primitiveNormals;
+    bool perPrimRadii = !paramData.vertexRadii && paramData.primitiveRadii;
+    bool perPrimScales = !paramData.vertexScales && paramData.primitiveScales;
+    bool perPrimColors = !paramData.vertexColors && paramData.primitiveColors;
+    bool perPrimOrientations = !paramData.vertexOrientations && paramData.primitiveOrientations;
+
+    ANARIDataType colorType = perPrimColors ? paramData.primitiveColors->getType() : ANARI_UINT8; // Vertex colors aren't reordered
+
+    // Effectively only has to reorder if the source array is perPrim, otherwise this function effectively falls through and the source array is assigned directly at parent scope.
+    tempArrays->NormalsArray.resize(perPrimNormals ? numVertices*3 : 0);
+    tempArrays->RadiiArray.resize(perPrimRadii ?  numVertices : 0);
+    tempArrays->ScalesArray.resize(perPrimScales ?  numVertices*scaleComps : 0);
+    tempArrays->OrientationsArray.resize(perPrimOrientations ? numVertices*4 : 0);
+    tempArrays->IdsArray.resize(numVertices, -1); // Always filled, since indices implies necessity for invisibleIds, and therefore also an Id array
+    tempArrays->resetColorsArray(perPrimColors ?  numVertices : 0, colorType);
+    for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
     {
-      auto& attribDataArrays = tempArrays->AttributeDataArrays;
-      assert(attribDataArrays.size() == attributeArray.size());
-
-      uint64_t numVertices = paramData.vertexPositions->getLayout().numItems1;
-
-      ANARIDataType scaleType = paramData.vertexScales ? paramData.vertexScales->getType()
-        : (paramData.primitiveScales ? paramData.primitiveScales->getType() : ANARI_UNKNOWN);
-      size_t scaleComps = anari::componentsOf(scaleType);
-
-      bool perPrimNormals = !paramData.vertexNormals && paramData.primitiveNormals;
-      bool perPrimRadii = !paramData.vertexRadii && paramData.primitiveRadii;
-      bool perPrimScales = !paramData.vertexScales && paramData.primitiveScales;
-      bool perPrimColors = !paramData.vertexColors && paramData.primitiveColors;
-      bool perPrimOrientations = !paramData.vertexOrientations && paramData.primitiveOrientations;
-
-      ANARIDataType colorType = perPrimColors ? paramData.primitiveColors->getType() : ANARI_UINT8; // Vertex colors aren't reordered
-
-      // Effectively only has to reorder if the source array is perPrim, otherwise this function effectively falls through and the source array is assigned directly at parent scope.
-      tempArrays->NormalsArray.resize(perPrimNormals ? numVertices*3 : 0);
-      tempArrays->RadiiArray.resize(perPrimScales ?  numVertices : 0);
-      tempArrays->ScalesArray.resize(perPrimScales ?  numVertices*scaleComps : 0);
-      tempArrays->OrientationsArray.resize(perPrimOrientations ? numVertices*4 : 0);
-      tempArrays->IdsArray.resize(numVertices, -1); // Always filled, since indices implies necessity for invisibleIds, and therefore also an Id array
-      tempArrays->resetColorsArray(perPrimColors ?  numVertices : 0, colorType);
+      tempArrays->resetAttributeDataArray(attribIdx, attributeArray[attribIdx].PerPrimData ? numVertices : 0);
+    }
+
+    assert(!perPrimColors || numIndices <= paramData.primitiveColors->getLayout().numItems1);
+
+    // Scatters all per-primitive data of a primitive range to the referenced vertices, one attribute at a time
+    auto scatterRange = [&](uint64_t primBegin, uint64_t primEnd, const VertexOwner* vertOwners) -> int64_t
+    {
+      if (perPrimNormals)
+        scatterPerPrimFloats<IndexType, 3>(indices, paramData.primitiveNormals, tempArrays->NormalsArray.data(), primBegin, primEnd, vertOwners);
+      if (perPrimOrientations)
+        scatterPerPrimFloats<IndexType, 4>(indices, paramData.primitiveOrientations, tempArrays->OrientationsArray.data(), primBegin, primEnd, vertOwners);
+      if (perPrimRadii)
+        scatterPerPrimFloats<IndexType, 1>(indices, paramData.primitiveRadii, tempArrays->RadiiArray.data(), primBegin, primEnd, vertOwners);
+      if (perPrimScales)
+      {
+        if(scaleComps == 1)
+          scatterPerPrimFloats<IndexType, 1>(indices, paramData.primitiveScales, tempArrays->ScalesArray.data(), primBegin, primEnd, vertOwners);
+        else if(scaleComps == 3)
+          scatterPerPrimFloats<IndexType, 3>(indices, paramData.primitiveScales, tempArrays->ScalesArray.data(), primBegin, primEnd, vertOwners);
+      }
+      if (perPrimColors)
+        scatterPerPrimBytes(indices, paramData.primitiveColors->getData(), tempArrays->ColorsArray.data(), anari::sizeOf(colorType), primBegin, primEnd, vertOwners);
       for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
       {
-        tempArrays->resetAttributeDataArray(attribIdx, attributeArray[attribIdx].PerPrimData ? numVertices : 0);
+        const UsdBridgeAttribute& attrib = tempArrays->Attributes[attribIdx];
+        if(attributeArray[attribIdx].PerPrimData && attrib.Data)
+          scatterPerPrimBytes(indices, attrib.Data, attribDataArrays[attribIdx].data(), attrib.EltSize, primBegin, primEnd, vertOwners);
       }
+      return scatterPerPrimIds(indices, paramData.primitiveIds, tempArrays->IdsArray.data(), primBegin, primEnd, vertOwners);
+    };
 
-      const void* indices = paramData.indices->getData();
-      uint64_t numIndices = paramData.indices->getLayout().numItems1;
-      ANARIDataType indexType = paramData.indices->getType();
+    int64_t maxId = -1;
+    if (numIndices < convertParallelThreshold)
+    {
+      maxId = scatterRange(0, numIndices, nullptr);
+    }
+    else
+    {
+      std::unique_ptr<VertexOwner[]> vertOwners(new VertexOwner[numVertices]);
+      forEachConvertChunk(numVertices, numThreads, [&vertOwners](size_t chunkIdx, uint64_t vertBegin, uint64_t vertEnd)
+      {
+        for (uint64_t vertIdx = vertBegin; vertIdx < vertEnd; ++vertIdx)
+          vertOwners[vertIdx].store(0, std::memory_order_relaxed);
+      });
 
-      int64_t maxId = -1;
-      for (uint64_t primIdx = 0; primIdx < numIndices; ++primIdx)
+      forEachConvertChunk(numIndices, numThreads, [&](size_t chunkIdx, uint64_t primBegin, uint64_t primEnd)
       {
-        size_t vertIdx = getIndex(indices, indexType, primIdx);
+        claimVertexOwners(indices, primBegin, primEnd, vertOwners.get());
+      });
 
-        // Normals
-        if (perPrimNormals)
-        {
-          float* normalsDest = &tempArrays->NormalsArray[vertIdx * 3];
-          getValues3(paramData.primitiveNormals->getData(), paramData.primitiveNormals->getType(), primIdx, normalsDest);
-        }
+      std::vector<int64_t> chunkMaxIds(getNumConvertChunks(numIndices));
+      forEachConvertChunk(numIndices, numThreads, [&](size_t chunkIdx, uint64_t primBegin, uint64_t primEnd)
+      {
+        chunkMaxIds[chunkIdx] = scatterRange(primBegin, primEnd, vertOwners.get());
+      });
+      for (int64_t chunkMaxId : chunkMaxIds)
+        maxId = std::max(maxId, chunkMaxId);
+    }
 
-        // Orientations
-        if (perPrimOrientations)
-        {
-          float* orientsDest = &tempArrays->OrientationsArray[vertIdx*4];
-          getValues4(paramData.primitiveOrientations->getData(), paramData.primitiveOrientations->getType(), primIdx, orientsDest);
-        }
+    // Without explicit ids, the unused ids continue from the vertex index of the last primitive
+    if (!paramData.primitiveIds && numIndices)
+      maxId = static_cast<int64_t>(indices[numIndices-1]);
 
-        // Radii
-        if (perPrimRadii)
-        {
-          float* radiiDest = &tempArrays->RadiiArray[vertIdx];
-          getValues1(paramData.primitiveRadii->getData(), paramData.primitiveRadii->getType(), primIdx, radiiDest);
-        }
+    // Assign unused ids to untouched vertices, then add those ids to invisible array
+    tempArrays->InvisIdsArray.resize(0);
+    tempArrays->InvisIdsArray.reserve(numVertices);
 
-        // Scales
-        if (perPrimScales)
-        {
-          float* scalesDest = &tempArrays->ScalesArray[vertIdx*scaleComps];
-          if(scaleComps == 1)
-            getValues1(paramData.primitiveScales->getData(), paramData.primitiveScales->getType(), primIdx, scalesDest);
-          else if(scaleComps == 3)
-            getValues3(paramData.primitiveScales->getData(), paramData.primitiveScales->getType(), primIdx, scalesDest);
-        }
+    for (uint64_t vertIdx = 0; vertIdx < numVertices; ++vertIdx)
+    {
+      if (tempArrays->IdsArray[vertIdx] == -1)
+      {
+        tempArrays->IdsArray[vertIdx] = ++maxId;
+        tempArrays->InvisIdsArray.push_back(maxId);
+      }
+    }
+  }
 
-        // Colors
-        if (perPrimColors)
-        {
-          assert(primIdx < paramData.primitiveColors->getLayout().numItems1);
-          tempArrays->copyToColorsArray(paramData.primitiveColors->getData(), primIdx, vertIdx, 1);
-        }
+  void generateIndexedSphereData(const UsdGeometryData& paramData, const UsdGeometry::AttributeArray& attributeArray, UsdGeometryTempArrays* tempArrays,
+    unsigned int numThreads)
+  {
+    if (paramData.indices)
+    {
+      uint64_t numIndices = paramData.indices->getLayout().numItems1;
+      dispatchIndices(paramData.indices->getData(), paramData.indices->getType(), [&](auto indices)
+      {
+        generateIndexedSphereDataTyped(paramData, attributeArray, tempArrays, indices, numIndices, numThreads);
+      });
+    }
+  }
 
-        // Attributes
-        for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
-        {
-          if(attributeArray[attribIdx].PerPrimData)
-          {
-            tempArrays->copyToAttributeDataArray(attribIdx, primIdx, vertIdx, 1);
-          }
-        }
+  template<typename IndexType, typename VertexType>
+  void convertLinesToSticksRange(IndexType indices, const VertexType* vertices, uint64_t numVertices, float radiusConstant, UsdGeometryTempArrays* tempArrays,
+    uint64_t primBegin, uint64_t primEnd)
+  {
+    float* points = tempArrays->PointsArray.data();
+    float* scales = tempArrays->ScalesArray.data();
+    float* orientations = tempArrays->OrientationsArray.data();
 
-        // Ids
-        if (paramData.primitiveIds)
-        {
-          int64_t id = static_cast<int64_t>(getIndex(paramData.primitiveIds->getData(), paramData.primitiveIds->getType(), primIdx));
-          tempArrays->IdsArray[vertIdx] = id;
-          if (id > maxId)
-            maxId = id;
-        }
-        else
-        {
-          int64_t id = static_cast<int64_t>(vertIdx);
-          maxId = tempArrays->IdsArray[vertIdx] = id;
-        }
-      }
+    for (uint64_t primIdx = primBegin; primIdx < primEnd; ++primIdx)
+    {
+      size_t vertIdx0 = static_cast<size_t>(indices[primIdx*2]);
+      size_t vertIdx1 = static_cast<size_t>(indices[primIdx*2 + 1]);
+      assert(vertIdx0 < numVertices);
+      assert(vertIdx1 < numVertices);
 
-      // Assign unused ids to untouched vertices, then add those ids to invisible array
-      tempArrays->InvisIdsArray.resize(0);
-      tempArrays->InvisIdsArray.reserve(numVertices);
+      const VertexType* vert0 = vertices + vertIdx0*3;
+      const VertexType* vert1 = vertices + vertIdx1*3;
+      float point0[3] = { static_cast<float>(vert0[0]), static_cast<float>(vert0[1]), static_cast<float>(vert0[2]) };
+      float point1[3] = { static_cast<float>(vert1[0]), static_cast<float>(vert1[1]), static_cast<float>(vert1[2]) };
 
-      for (uint64_t vertIdx = 0; vertIdx < numVertices; ++vertIdx)
-      {
-        if (tempArrays->IdsArray[vertIdx] == -1)
-        {
-          tempArrays->IdsArray[vertIdx] = ++maxId;
-          tempArrays->InvisIdsArray.push_back(maxId);
-        }
-      }
+      points[primIdx * 3] = (point0[0] + point1[0]) * 0.5f;
+      points[primIdx * 3 + 1] = (point0[1] + point1[1]) * 0.5f;
+      points[primIdx * 3 + 2] = (point0[2] + point1[2]) * 0.5f;
+
+      float segDir[3] = {
+        point1[0] - point0[0],
+        point1[1] - point0[1],
+        point1[2] - point0[2],
+      };
+      float segLength = sqrtf(segDir[0] * segDir[0] + segDir[1] * segDir[1] + segDir[2] * segDir[2]);
+      scales[primIdx * 3] = radiusConstant; // Overwritten by radius arrays, if present
+      scales[primIdx * 3 + 1] = radiusConstant;
+      scales[primIdx * 3 + 2] = segLength * 0.5f;
+
+      // Rotation
+      // USD shapes are always lengthwise-oriented along the z axis
+      usdbridgenumerics::DirectionToQuaternionZ(segDir, segLength, orientations + primIdx*4);
     }
   }
 
-  void convertLinesToSticks(const UsdGeometryData& paramData, const UsdGeometry::AttributeArray& attributeArray, UsdGeometryTempArrays* tempArrays)
+  template<typename IndexType>
+  void gatherStickRadii(IndexType srcIndices, const UsdDataArray* radii, float* scales, uint64_t primBegin, uint64_t primEnd)
+  {
+    auto gatherRadii = [=](const auto* typedRadii)
+    {
+      for (uint64_t primIdx = primBegin; primIdx < primEnd; ++primIdx)
+        scales[primIdx * 3] = scales[primIdx * 3 + 1] = static_cast<float>(typedRadii[static_cast<size_t>(srcIndices[primIdx])]);
+    };
+
+    if (radii->getType() == ANARI_FLOAT32)
+      gatherRadii(reinterpret_cast<const float*>(radii->getData()));
+    else if (radii->getType() == ANARI_FLOAT64)
+      gatherRadii(reinterpret_cast<const double*>(radii->getData()));
+  }
+
+  void convertLinesToSticks(const UsdGeometryData& paramData, const UsdGeometry::AttributeArray& attributeArray, UsdGeometryTempArrays* tempArrays,
+    unsigned int numThreads)
   {
     // Converts arrays of vertex endpoint 2-tuples (optionally obtained via index 2-tuples) into center vertices with correct seglengths.
 
@@ -432,7 +574,6 @@ namespace
 
     const UsdDataArray* indexArray = paramData.indices;
     uint64_t numSticks = indexArray ? indexArray->getLayout().numItems1 : numVertices/2;
-    uint64_t numIndices = numSticks * 2; // Indices are 2-element vectors in ANARI
     const void* indices = indexArray ? indexArray->getData() : nullptr;
     ANARIDataType indexType = indexArray ? indexArray->getType() : ANARI_UINT32;
 
@@ -448,216 +589,175 @@ namespace
       tempArrays->resetAttributeDataArray(attribIdx, !attributeArray[attribIdx].PerPrimData ? numSticks : 0);
     }
 
-    for (size_t i = 0; i < numIndices; i += 2)
+    // All output arrays are presized, so every stick can be converted independently
+    dispatchIndices(indices, indexType, [&](auto typedIndices)
     {
-      size_t primIdx = i / 2;
-      size_t vertIdx0 = indices ? getIndex(indices, indexType, i) : i;
-      size_t vertIdx1 = indices ? getIndex(indices, indexType, i + 1) : i + 1;
-      assert(vertIdx0 < numVertices);
-      assert(vertIdx1 < numVertices);
-
-      float point0[3], point1[3];
-      getValues3(vertices, vertexType, vertIdx0, point0);
-      getValues3(vertices, vertexType, vertIdx1, point1);
+      using IndexType = decltype(typedIndices);
+      StridedIndices<IndexType, 2> firstVertIndices{typedIndices}; // Per-vertex data is taken from the first vertex of each stick
 
-      tempArrays->PointsArray[primIdx * 3] = (point0[0] + point1[0]) * 0.5f;
-      tempArrays->PointsArray[primIdx * 3 + 1] = (point0[1] + point1[1]) * 0.5f;
-      tempArrays->PointsArray[primIdx * 3 + 2] = (point0[2] + point1[2]) * 0.5f;
-
-      float scaleVal = paramData.radiusConstant;
-      if (paramData.vertexRadii)
-      {
-        getValues1(paramData.vertexRadii->getData(), paramData.vertexRadii->getType(), vertIdx0, &scaleVal);
-      }
-      else if (paramData.primitiveRadii)
+      forEachConvertChunk(numSticks, numThreads, [&](size_t chunkIdx, uint64_t primBegin, uint64_t primEnd)
       {
-        getValues1(paramData.primitiveRadii->getData(), paramData.primitiveRadii->getType(), primIdx, &scaleVal);
-      }
+        dispatchVertices(vertices, vertexType, [&](auto typedVertices)
+        {
+          convertLinesToSticksRange(typedIndices, typedVertices, numVertices, paramData.radiusConstant, tempArrays, primBegin, primEnd);
+        });
 
-      float segDir[3] = {
-        point1[0] - point0[0],
-        point1[1] - point0[1],
-        point1[2] - point0[2],
-      };
-      float segLength = sqrtf(segDir[0] * segDir[0] + segDir[1] * segDir[1] + segDir[2] * segDir[2]);
-      tempArrays->ScalesArray[primIdx * 3] = scaleVal;
-      tempArrays->ScalesArray[primIdx * 3 + 1] = scaleVal;
-      tempArrays->ScalesArray[primIdx * 3 + 2] = segLength * 0.5f;
+        if (paramData.vertexRadii)
+          gatherStickRadii(firstVertIndices, paramData.vertexRadii, tempArrays->ScalesArray.data(), primBegin, primEnd);
+        else if (paramData.primitiveRadii)
+          gatherStickRadii(IdentityIndices(), paramData.primitiveRadii, tempArrays->ScalesArray.data(), primBegin, primEnd);
 
-      // Rotation
-      // USD shapes are always lengthwise-oriented along the z axis
-      usdbridgenumerics::DirectionToQuaternionZ(segDir, segLength, tempArrays->OrientationsArray.data() + primIdx*4);
+        if (paramData.vertexColors)
+          gatherBytes(firstVertIndices, paramData.vertexColors->getData(), tempArrays->ColorsArray.data(), anari::sizeOf(colorType), primBegin, primEnd);
 
-      //Colors
-      if (paramData.vertexColors)
-      {
-        assert(vertIdx0 < paramData.vertexColors->getLayout().numItems1);
-        tempArrays->copyToColorsArray(paramData.vertexColors->getData(), vertIdx0, primIdx, 1);
-      }
-
-      // Attributes
-      for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
-      {
-        if(!attributeArray[attribIdx].PerPrimData)
+        for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
         {
-          tempArrays->copyToAttributeDataArray(attribIdx, vertIdx0, primIdx, 1);
+          const UsdBridgeAttribute& attrib = tempArrays->Attributes[attribIdx];
+          if(!attributeArray[attribIdx].PerPrimData && attrib.Data)
+            gatherBytes(firstVertIndices, attrib.Data, attribDataArrays[attribIdx].data(), attrib.EltSize, primBegin, primEnd);
         }
-      }
 
-      // Ids
-      if (paramData.primitiveIds)
-      {
-        tempArrays->IdsArray[primIdx] = (int64_t)getIndex(paramData.primitiveIds->getData(), paramData.primitiveIds->getType(), primIdx);
-      }
-    }
+        if (paramData.primitiveIds)
+          scatterPerPrimIds(IdentityIndices(), paramData.primitiveIds, tempArrays->IdsArray.data(), primBegin, primEnd, nullptr);
+      });
+    });
   }
 
-  void pushVertex(const UsdGeometryData& paramData, const UsdGeometry::AttributeArray& attributeArray, UsdGeometryTempArrays* tempArrays,
-    const void* vertices, ANARIDataType vertexType,
-    bool hasNormals, bool hasColors, bool hasRadii,
-    size_t segStart, size_t primIdx)
+  template<typename IndexType>
+  void reorderCurveGeometryTyped(const UsdGeometryData& paramData, const UsdGeometry::AttributeArray& attributeArray, UsdGeometryTempArrays* tempArrays,
+    IndexType indices, uint64_t numSegments, uint64_t numVertices, unsigned int numThreads)
   {
     auto& attribDataArrays = tempArrays->AttributeDataArrays;
 
-    float point[3];
-    getValues3(vertices, vertexType, segStart, point);
-    tempArrays->PointsArray.push_back(point[0]);
-    tempArrays->PointsArray.push_back(point[1]);
-    tempArrays->PointsArray.push_back(point[2]);
-
-    // Normals
-    if (hasNormals)
+    // A new curve starts wherever a segment doesn't continue from the end vertex of the previous one;
+    // each segment outputs its start vertex, and the last segment of a curve also its end vertex.
+    auto startsCurve = [indices](uint64_t primIdx) {
+      return primIdx == 0 || static_cast<size_t>(indices[primIdx-1]) + 1 != static_cast<size_t>(indices[primIdx]); };
+    auto endsCurve = [numSegments, &startsCurve](uint64_t primIdx) {
+      return primIdx + 1 == numSegments || startsCurve(primIdx + 1); };
+
+    // First pass: count the output vertices and curves of each chunk, followed by a prefix sum to obtain the chunk offsets
+    uint64_t numChunks = getNumConvertChunks(numSegments);
+    std::vector<uint64_t> chunkVertOffsets(numChunks + 1, 0);
+    std::vector<uint64_t> chunkCurveOffsets(numChunks + 1, 0);
+    forEachConvertChunk(numSegments, numThreads, [&](size_t chunkIdx, uint64_t primBegin, uint64_t primEnd)
     {
-      float normals[3];
-      if (paramData.vertexNormals)
+      uint64_t numChunkVerts = 0, numChunkCurves = 0;
+      for (uint64_t primIdx = primBegin; primIdx < primEnd; ++primIdx)
       {
-        getValues3(paramData.vertexNormals->getData(), paramData.vertexNormals->getType(), segStart, normals);
+        numChunkVerts += endsCurve(primIdx) ? 2 : 1;
+        numChunkCurves += startsCurve(primIdx) ? 1 : 0;
       }
-      else if (paramData.primitiveNormals)
+      chunkVertOffsets[chunkIdx + 1] = numChunkVerts;
+      chunkCurveOffsets[chunkIdx + 1] = numChunkCurves;
+    });
+    for (uint64_t chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx)
+    {
+      chunkVertOffsets[chunkIdx + 1] += chunkVertOffsets[chunkIdx];
+      chunkCurveOffsets[chunkIdx + 1] += chunkCurveOffsets[chunkIdx];
+    }
+    uint64_t numOutVerts = chunkVertOffsets[numChunks];
+    uint64_t numCurves = chunkCurveOffsets[numChunks];
+
+    // Second pass: map every output vertex to its source vertex and primitive, and find the curve start offsets
+    std::vector<size_t> srcVertIndices(numOutVerts);
+    std::vector<size_t> srcPrimIndices(numOutVerts);
+    std::vector<uint64_t> curveStarts(numCurves + 1);
+    forEachConvertChunk(numSegments, numThreads, [&](size_t chunkIdx, uint64_t primBegin, uint64_t primEnd)
+    {
+      uint64_t outIdx = chunkVertOffsets[chunkIdx];
+      uint64_t curveIdx = chunkCurveOffsets[chunkIdx];
+      for (uint64_t primIdx = primBegin; primIdx < primEnd; ++primIdx)
       {
-        getValues3(paramData.primitiveNormals->getData(), paramData.primitiveNormals->getType(), primIdx, normals);
+        size_t segStart = static_cast<size_t>(indices[primIdx]);
+        assert(segStart+1 < numVertices); // begin and end vertex should be in range
+
+        if (startsCurve(primIdx))
+          curveStarts[curveIdx++] = outIdx;
+
+        srcVertIndices[outIdx] = segStart;
+        srcPrimIndices[outIdx++] = primIdx;
+        if (endsCurve(primIdx))
+        {
+          srcVertIndices[outIdx] = segStart + 1;
+          srcPrimIndices[outIdx++] = primIdx;
+        }
       }
+    });
+    curveStarts[numCurves] = numOutVerts;
 
-      tempArrays->NormalsArray.push_back(normals[0]);
-      tempArrays->NormalsArray.push_back(normals[1]);
-      tempArrays->NormalsArray.push_back(normals[2]);
-    }
+    tempArrays->CurveLengths.resize(numCurves);
+    forEachConvertChunk(numCurves, numThreads, [&](size_t chunkIdx, uint64_t curveBegin, uint64_t curveEnd)
+    {
+      for (uint64_t curveIdx = curveBegin; curveIdx < curveEnd; ++curveIdx)
+        tempArrays->CurveLengths[curveIdx] = static_cast<int>(curveStarts[curveIdx + 1] - curveStarts[curveIdx]);
+    });
+
+    // Final pass: gather all vertex data into the presized output arrays
+    bool hasNormals = paramData.vertexNormals || paramData.primitiveNormals;
+    bool hasColors = paramData.vertexColors || paramData.primitiveColors;
+    bool hasRadii = paramData.vertexRadii || paramData.primitiveRadii;
+    ANARIDataType colorType = hasColors ? (paramData.vertexColors ? paramData.vertexColors->getType() : paramData.primitiveColors->getType()) : ANARI_UINT8;
 
-    // Radii
+    tempArrays->PointsArray.resize(numOutVerts * 3);
+    if (hasNormals)
+      tempArrays->NormalsArray.resize(numOutVerts * 3);
+    if (hasColors)
+      tempArrays->resetColorsArray(numOutVerts, colorType);
     if (hasRadii)
+      tempArrays->ScalesArray.resize(numOutVerts);
+    for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
     {
-      float radii;
-      if (paramData.vertexRadii)
-      {
-        getValues1(paramData.vertexRadii->getData(), paramData.vertexRadii->getType(), segStart, &radii);
-      }
-      else if (paramData.primitiveRadii)
-      {
-        getValues1(paramData.primitiveRadii->getData(), paramData.primitiveRadii->getType(), primIdx, &radii);
-      }
-
-      tempArrays->ScalesArray.push_back(radii);
+      tempArrays->resetAttributeDataArray(attribIdx, numOutVerts);
     }
 
-    // Colors
-    if (hasColors)
+    const size_t* vertIdxs = srcVertIndices.data();
+    const size_t* primIdxs = srcPrimIndices.data();
+    forEachConvertChunk(numOutVerts, numThreads, [&](size_t chunkIdx, uint64_t begin, uint64_t end)
     {
-      size_t destIdx = tempArrays->expandColorsArray(1);
+      gatherFloats<const size_t*, 3>(vertIdxs, paramData.vertexPositions, tempArrays->PointsArray.data(), begin, end);
+
+      if (paramData.vertexNormals)
+        gatherFloats<const size_t*, 3>(vertIdxs, paramData.vertexNormals, tempArrays->NormalsArray.data(), begin, end);
+      else if (paramData.primitiveNormals)
+        gatherFloats<const size_t*, 3>(primIdxs, paramData.primitiveNormals, tempArrays->NormalsArray.data(), begin, end);
+
+      if (paramData.vertexRadii)
+        gatherFloats<const size_t*, 1>(vertIdxs, paramData.vertexRadii, tempArrays->ScalesArray.data(), begin, end);
+      else if (paramData.primitiveRadii)
+        gatherFloats<const size_t*, 1>(primIdxs, paramData.primitiveRadii, tempArrays->ScalesArray.data(), begin, end);
+
       if (paramData.vertexColors)
-      {
-        tempArrays->copyToColorsArray(paramData.vertexColors->getData(), segStart, destIdx, 1);
-      }
+        gatherBytes(vertIdxs, paramData.vertexColors->getData(), tempArrays->ColorsArray.data(), anari::sizeOf(colorType), begin, end);
       else if (paramData.primitiveColors)
+        gatherBytes(primIdxs, paramData.primitiveColors->getData(), tempArrays->ColorsArray.data(), anari::sizeOf(colorType), begin, end);
+
+      for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
       {
-        tempArrays->copyToColorsArray(paramData.primitiveColors->getData(), primIdx, destIdx, 1);
+        const UsdBridgeAttribute& attrib = tempArrays->Attributes[attribIdx];
+        if(attrib.Data)
+          gatherBytes(attributeArray[attribIdx].PerPrimData ? primIdxs : vertIdxs, attrib.Data, attribDataArrays[attribIdx].data(), attrib.EltSize, begin, end);
       }
-    }
-
-    // Attributes
-    for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
-    {
-      size_t srcIdx = attributeArray[attribIdx].PerPrimData ? primIdx : segStart;
-      size_t destIdx = tempArrays->expandAttributeDataArray(attribIdx, 1);
-      tempArrays->copyToAttributeDataArray(attribIdx, srcIdx, destIdx, 1);
-    }
+    });
   }
 
-#define PUSH_VERTEX(x, y) \
-  pushVertex(paramData, attributeArray, tempArrays, \
-    vertices, vertexType, \
-    hasNormals, hasColors, hasRadii, \
-    x, y)
-
-  void reorderCurveGeometry(const UsdGeometryData& paramData, const UsdGeometry::AttributeArray& attributeArray, UsdGeometryTempArrays* tempArrays)
+  void reorderCurveGeometry(const UsdGeometryData& paramData, const UsdGeometry::AttributeArray& attributeArray, UsdGeometryTempArrays* tempArrays,
+    unsigned int numThreads)
   {
-    auto& attribDataArrays = tempArrays->AttributeDataArrays;
-    assert(attribDataArrays.size() == attributeArray.size());
+    assert(tempArrays->AttributeDataArrays.size() == attributeArray.size());
 
     const UsdDataArray* vertexArray = paramData.vertexPositions;
     uint64_t numVertices = vertexArray->getLayout().numItems1;
-    const void* vertices = vertexArray->getData();
-    ANARIDataType vertexType = vertexArray->getType();
 
     const UsdDataArray* indexArray = paramData.indices;
     uint64_t numSegments = indexArray ? indexArray->getLayout().numItems1 : numVertices-1;
     const void* indices = indexArray ? indexArray->getData() : nullptr;
     ANARIDataType indexType = indexArray ? indexArray->getType() : ANARI_UINT32;
 
-    uint64_t maxNumVerts = numSegments*2;
-    tempArrays->CurveLengths.resize(0);
-    tempArrays->PointsArray.resize(0);
-    tempArrays->PointsArray.reserve(maxNumVerts * 3); // Conservative max number of points
-    bool hasNormals = paramData.vertexNormals || paramData.primitiveNormals;
-    if (hasNormals)
-    {
-      tempArrays->NormalsArray.resize(0);
-      tempArrays->NormalsArray.reserve(maxNumVerts * 3);
-    }
-    bool hasColors = paramData.vertexColors || paramData.primitiveColors;
-    if (hasColors)
-    {
-      tempArrays->resetColorsArray(0, paramData.vertexColors ? paramData.vertexColors->getType() : paramData.primitiveColors->getType());
-      tempArrays->reserveColorsArray(maxNumVerts);
-    }
-    bool hasRadii = paramData.vertexRadii || paramData.primitiveRadii;
-    if (hasRadii)
+    dispatchIndices(indices, indexType, [&](auto typedIndices)
     {
-      tempArrays->ScalesArray.resize(0);
-      tempArrays->ScalesArray.reserve(maxNumVerts);
-    }
-    for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
-    {
-      tempArrays->resetAttributeDataArray(attribIdx, 0);
-      tempArrays->reserveAttributeDataArray(attribIdx, maxNumVerts);
-    }
-
-    size_t prevSegEnd = 0;
-    int curveLength = 0;
-    for (size_t primIdx = 0; primIdx < numSegments; ++primIdx)
-    {
-      size_t segStart = indices ? getIndex(indices, indexType, primIdx) : primIdx;
-
-      if (primIdx != 0 && prevSegEnd != segStart)
-      {
-        PUSH_VERTEX(prevSegEnd, primIdx - 1);
-        curveLength += 1;
-        tempArrays->CurveLengths.push_back(curveLength);
-        curveLength = 0;
-      }
-
-      assert(segStart+1 < numVertices); // begin and end vertex should be in range
-
-      PUSH_VERTEX(segStart, primIdx);
-      curveLength += 1;
-
-      prevSegEnd = segStart + 1;
-    }
-    if (curveLength != 0)
-    {
-      PUSH_VERTEX(prevSegEnd, numSegments - 1);
-      curveLength += 1;
-      tempArrays->CurveLengths.push_back(curveLength);
-    }
+      reorderCurveGeometryTyped(paramData, attributeArray, tempArrays, typedIndices, numSegments, numVertices, numThreads);
+    });
   }
 
   template<typename T>
@@ -796,6 +896,8 @@ void UsdGeometry::syncAttributeArrays()
       if (attribArray)
       {
         attributeArray[i].Data = attribArray->getData();
+        attributeArray[i].DataOwner = attribArray->getDataOwner();
+        attributeArray[i].DataHash.Source = attribArray;
         attributeArray[i].DataType = AnariToUsdBridgeType(attribArray->getType());
         attributeArray[i].PerPrimData = paramData.vertexAttributes[i] ? false : true;
         attributeArray[i].EltSize = static_cast<uint32_t>(anari::sizeOf(attribArray->getType()));
@@ -804,6 +906,8 @@ void UsdGeometry::syncAttributeArrays()
       else
       {
         attributeArray[i].Data = nullptr;
+        attributeArray[i].DataOwner = nullptr;
+        attributeArray[i].DataHash = UsdBridgeDataHash();
         attributeArray[i].DataType = UsdBridgeType::UNDEFINED;
       }
     }
@@ -827,7 +931,11 @@ void UsdGeometry::assignTempDataToAttributes(bool perPrimInterpolation)
   for(size_t attribIdx = 0; attribIdx < attribDataArrays.size(); ++attribIdx)
   {
     if(attribDataArrays[attribIdx].size()) // Always > 0 if attributeArray[attribIdx].Data is set
+    {
       attributeArray[attribIdx].Data = attribDataArrays[attribIdx].data();
+      attributeArray[attribIdx].DataOwner = nullptr;
+      attributeArray[attribIdx].DataHash = UsdBridgeDataHash();
+    }
 
     attributeArray[attribIdx].PerPrimData = perPrimInterpolation; // Already converted to per-vertex (or per-prim)
   }
@@ -867,6 +975,7 @@ void UsdGeometry::initializeGeomData(UsdBridgeInstancerData& geomData)
   setAttributeTimeVarying<UsdBridgeInstancerData>(geomData.TimeVarying);
 
   geomData.UseUsdGeomPoints = geomType == GEOM_SPHERE && paramData.UseUsdGeomPoints;
+  geomData.MaxPointsPerTile = paramData.maxPointsPerTile;
 }
 
 void UsdGeometry::initializeGeomData(UsdBridgeCurveData& geomData)
@@ -1118,12 +1227,16 @@ void UsdGeometry::updateGeomData(UsdDevice* device, UsdBridge* usdBridge, UsdBri
   meshData.NumPoints = vertices->getLayout().numItems1;
   meshData.Points = vertices->getData();
   meshData.PointsType = AnariToUsdBridgeType(vertices->getType());
+  meshData.PointsOwner = vertices->getDataOwner();
+  meshData.PointsHash.Source = vertices;
 
   const UsdDataArray* normals = paramData.vertexNormals ? paramData.vertexNormals : paramData.primitiveNormals;
   if (normals)
   {
     meshData.Normals = normals->getData();
     meshData.NormalsType = AnariToUsdBridgeType(normals->getType());
+    meshData.NormalsOwner = normals->getDataOwner();
+    meshData.NormalsHash.Source = normals;
     meshData.PerPrimNormals = paramData.vertexNormals ? false : true;
   }
   const UsdDataArray* colors = paramData.vertexColors ? paramData.vertexColors : paramData.primitiveColors;
@@ -1131,6 +1244,7 @@ void UsdGeometry::updateGeomData(UsdDevice* device, UsdBridge* usdBridge, UsdBri
   {
     meshData.Colors = colors->getData();
     meshData.ColorsType = AnariToUsdBridgeType(colors->getType());
+    meshData.ColorsHash.Source = colors;
     meshData.PerPrimColors = paramData.vertexColors ? false : true;
   }
 
@@ -1141,6 +1255,8 @@ void UsdGeometry::updateGeomData(UsdDevice* device, UsdBridge* usdBridge, UsdBri
     meshData.NumIndices = indices->getLayout().numItems1 * anari::componentsOf(indexType);
     meshData.Indices = indices->getData();
     meshData.IndicesType = AnariToUsdBridgeType_Flattened(indexType);
+    meshData.IndicesOwner = indices->getDataOwner();
+    meshData.IndicesHash.Source = indices;
   }
   else
   {
@@ -1164,12 +1280,15 @@ void UsdGeometry::updateGeomData(UsdDevice* device, UsdBridge* usdBridge, UsdBri
     // A paramData.indices (primitive-indexed spheres) array, is not supported in USD, also duplicate spheres make no sense.
     // Instead, Ids/InvisibleIds are assigned to emulate sparsely indexed spheres (sourced from paramData.primitiveIds if available),
     // with the per-vertex arrays remaining intact. Any per-prim arrays are explicitly converted to per-vertex via the tempArrays.
-    generateIndexedSphereData(paramData, attributeArray, tempArrays.get());
+    if(tempDataState != TEMPDATA_CONVERTED)
+      generateIndexedSphereData(paramData, attributeArray, tempArrays.get(), device->getNumThreads());
 
     const UsdDataArray* vertices = paramData.vertexPositions;
     instancerData.NumPoints = vertices->getLayout().numItems1;
     instancerData.Points = vertices->getData();
     instancerData.PointsType = AnariToUsdBridgeType(vertices->getType());
+    instancerData.PointsOwner = vertices->getDataOwner();
+    instancerData.PointsHash.Source = vertices;
 
     UsdGeometryDebugData dbgData = { device, this, debugName };
 
@@ -1267,7 +1386,8 @@ void UsdGeometry::updateGeomData(UsdDevice* device, UsdBridge* usdBridge, UsdBri
   }
   else
   {
-    convertLinesToSticks(paramData, attributeArray, tempArrays.get());
+    if(tempDataState != TEMPDATA_CONVERTED)
+      convertLinesToSticks(paramData, attributeArray, tempArrays.get(), device->getNumThreads());
 
     instancerData.NumPoints = tempArrays->PointsArray.size()/3;
     if (instancerData.NumPoints > 0)
@@ -1289,6 +1409,7 @@ void UsdGeometry::updateGeomData(UsdDevice* device, UsdBridge* usdBridge, UsdBri
       { // Per-primitive color array corresponds to per-vertex stick output
         instancerData.Colors = colors->getData();
         instancerData.ColorsType = AnariToUsdBridgeType(colors->getType());
+        instancerData.ColorsHash.Source = colors;
       }
 
       // Attributes
@@ -1315,7 +1436,8 @@ void UsdGeometry::updateGeomData(UsdDevice* device, UsdBridge* usdBridge, UsdBri
 {
   const UsdGeometryData& paramData = getReadParams();
 
-  reorderCurveGeometry(paramData, attributeArray, tempArrays.get());
+  if(tempDataState != TEMPDATA_CONVERTED)
+    reorderCurveGeometry(paramData, attributeArray, tempArrays.get(), device->getNumThreads());
 
   curveData.NumPoints = tempArrays->PointsArray.size() / 3;
   if (curveData.NumPoints > 0)
@@ -1380,7 +1502,9 @@ bool UsdGeometry::commitTemplate(UsdDevice* device)
   {
     if (paramData.vertexPositions)
     {
-      if(checkGeomParams(device))
+      // Parameters may already have been checked during the conversion phase
+      bool validParams = (tempDataState == TEMPDATA_NONE) ? checkGeomParams(device) : (tempDataState != TEMPDATA_INVALID);
+      if(validParams)
         updateGeomData(device, usdBridge, geomData, isNew);
     }
     else
@@ -1391,6 +1515,8 @@ bool UsdGeometry::commitTemplate(UsdDevice* device)
     paramChanged = false;
   }
 
+  tempDataState = TEMPDATA_NONE;
+
   return isNew;
 }
 
@@ -1427,6 +1553,40 @@ bool UsdGeometry::doCommitData(UsdDevice* device)
   return geomType == GEOM_GLYPH && (isNew || protoShapeChanged); // Defer commit of prototypes until the geometry refs are in place
 }
 
+bool UsdGeometry::prepareCommitData(UsdDevice* device)
+{
+  tempDataState = TEMPDATA_NONE;
+
+  // Only geometries which are reordered into tempArrays have a conversion step,
+  // and only if updateGeomData will be called (ie. the same conditions as commitTemplate).
+  if(!tempArrays || !(paramChanged || !usdHandle.value) || !getReadParams().vertexPositions)
+    return false;
+
+  syncAttributeArrays();
+
+  bool validParams = checkGeomParams(device);
+  tempDataState = validParams ? TEMPDATA_VALID : TEMPDATA_INVALID;
+
+  return validParams;
+}
+
+void UsdGeometry::convertCommitData(UsdDevice* device)
+{
+  const UsdGeometryData& paramData = getReadParams();
+
+  switch (geomType)
+  {
+    case GEOM_SPHERE:
+    case GEOM_GLYPH: generateIndexedSphereData(paramData, attributeArray, tempArrays.get(), device->getNumThreads()); break;
+    case GEOM_CYLINDER:
+    case GEOM_CONE: convertLinesToSticks(paramData, attributeArray, tempArrays.get(), device->getNumThreads()); break;
+    case GEOM_CURVE: reorderCurveGeometry(paramData, attributeArray, tempArrays.get(), device->getNumThreads()); break;
+    default: return;
+  }
+
+  tempDataState = TEMPDATA_CONVERTED;
+}
+
 void UsdGeometry::doCommitRefs(UsdDevice* device)
 {
   assert(geomType == GEOM_GLYPH && protoShapeChanged);
@@ -56,6 +56,7 @@ struct UsdGeometryData
 #else
     false;
 #endif
+  uint64_t maxPointsPerTile = 0; // Spheres, cones, cylinders and glyphs with more points are written as spatial tiles; 0 disables tiling
 
   // Cylinders
   const UsdDataArray* primitiveRadii = nullptr;
@@ -139,6 +140,8 @@ class UsdGeometry : public UsdBridgedBaseObject<UsdGeometry, UsdGeometryData, Us
     bool deferCommit(UsdDevice* device) override;
     bool doCommitData(UsdDevice* device) override;
     void doCommitRefs(UsdDevice* device) override;
+    bool prepareCommitData(UsdDevice* device) override;
+    void convertCommitData(UsdDevice* device) override;
 
     void initializeGeomData(UsdBridgeMeshData& geomData);
     void initializeGeomData(UsdBridgeInstancerData& geomData);
@@ -174,6 +177,16 @@ class UsdGeometry : public UsdBridgedBaseObject<UsdGeometry, UsdGeometryData, Us
 
     bool hasNewAttribName = false;
 
+    // Result of the conversion phase of a commit list flush, consumed (and reset) by doCommitData
+    enum TempDataState
+    {
+      TEMPDATA_NONE = 0,
+      TEMPDATA_INVALID,
+      TEMPDATA_VALID,
+      TEMPDATA_CONVERTED
+    };
+    TempDataState tempDataState = TEMPDATA_NONE;
+
     std::unique_ptr<UsdGeometryTempArrays> tempArrays;
 
     AttributeArray attributeArray;
@@ -5,6 +5,7 @@
 #include "UsdAnari.h"
 #include "UsdDevice.h"
 #include "UsdGroup.h"
+#include "UsdWorld.h"
 
 #define GroupType ANARI_GROUP
 using GroupUsdType = AnariToUsdBridgedObject<GroupType>::Type;
@@ -33,11 +34,48 @@ UsdInstance::~UsdInstance()
 #endif
 }
 
+void UsdInstance::commit(UsdDevice* device)
+{
+  // Notify observers (point instancing worlds) that the group or transform may have changed
+  notify(this, device);
+
+  // Continue with the normal commit, ie. adding to the commit list or immediate execution of doCommitData
+  BridgedBaseObjectType::commit(device);
+}
+
 void UsdInstance::remove(UsdDevice* device)
 {
   applyRemoveFunc(device, &UsdBridge::DeleteInstance);
 }
 
+void UsdInstance::addWorldRef(UsdWorld* world, bool pointInstancing, UsdDevice* device)
+{
+  if(pointInstancing)
+  {
+    addObserver(world);
+    ++numPointInstancingWorlds;
+  }
+  else
+    worldReferenced = true;
+
+  // Create or remove the prim with the next flush, before the world is written
+  if(authorsPrim() != (usdHandle.value != nullptr))
+  {
+    device->addToCommitList(this, true);
+    paramChanged = true;
+  }
+}
+
+void UsdInstance::removeWorldRef(UsdWorld* world, bool pointInstancing)
+{
+  // A prim that is no longer needed is left as is, and a missing one is created once a world references the instance (which also happens at destruction of worlds, when the commit list cannot be changed)
+  if(pointInstancing)
+  {
+    removeObserver(world);
+    --numPointInstancingWorlds;
+  }
+}
+
 bool UsdInstance::isInstanceable() const
 {
   return false;
@@ -60,6 +98,18 @@ bool UsdInstance::doCommitData(UsdDevice* device)
 
   const char* instanceName = getName();
 
+  if(!authorsPrim())
+  {
+    // The group and transform are written by the instancers of the worlds using the instance
+    if(usdHandle.value)
+    {
+      usdBridge->DeleteInstance(usdHandle);
+      usdHandle = UsdInstanceHandle();
+    }
+    paramChanged = false;
+    return false;
+  }
+
   bool isNew = false;
   if (!usdHandle.value)
     isNew = usdBridge->CreateInstance(instanceName, usdHandle);
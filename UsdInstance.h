@@ -6,6 +6,7 @@
 #include "UsdBridgedBaseObject.h"
 
 class UsdGroup;
+class UsdWorld;
 
 enum class UsdInstanceComponents
 {
@@ -31,9 +32,18 @@ class UsdInstance : public UsdBridgedBaseObject<UsdInstance, UsdInstanceData, Us
       UsdDevice* device);
     ~UsdInstance();
 
+    void commit(UsdDevice* device) override;
+
     void remove(UsdDevice* device) override;
 
     bool isInstanceable() const;
+    bool isTransformTimeVarying() const { return isTimeVarying(UsdInstanceComponents::TRANSFORM); }
+
+    // Registration of the worlds using this instance, see UsdWorld::updateInstanceRefs(). Point instancing worlds observe the instance and write
+    // its group and transform into their instancers, so as long as no world has referenced the instance, it doesn't author a prim of its own.
+    void addWorldRef(UsdWorld* world, bool pointInstancing, UsdDevice* device);
+    void removeWorldRef(UsdWorld* world, bool pointInstancing);
+    bool authorsPrim() const { return worldReferenced || numPointInstancingWorlds == 0; }
 
     static constexpr ComponentPair componentParamNames[] = {
       ComponentPair(UsdInstanceComponents::GROUP, "group"),
@@ -43,4 +53,7 @@ class UsdInstance : public UsdBridgedBaseObject<UsdInstance, UsdInstanceData, Us
     bool deferCommit(UsdDevice* device) override;
     bool doCommitData(UsdDevice* device) override;
     void doCommitRefs(UsdDevice* device) override;
+
+    int numPointInstancingWorlds = 0;
+    bool worldReferenced = false; // Once referenced, the prim is kept, as the world prims referencing it outlive the world objects
 };
\ No newline at end of file
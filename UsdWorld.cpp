@@ -13,7 +13,9 @@
 #define InstanceType ANARI_INSTANCE
 #define SurfaceType ANARI_SURFACE
 #define VolumeType ANARI_VOLUME
+#define GroupType ANARI_GROUP
 using InstanceUsdType = AnariToUsdBridgedObject<InstanceType>::Type;
+using GroupUsdType = AnariToUsdBridgedObject<GroupType>::Type;
 using SurfaceUsdType = AnariToUsdBridgedObject<SurfaceType>::Type;
 using VolumeUsdType = AnariToUsdBridgedObject<VolumeType>::Type;
 
@@ -24,6 +26,7 @@ DEFINE_PARAMETER_MAP(UsdWorld,
   REGISTER_PARAMETER_MACRO("instance", ANARI_ARRAY, instances)
   REGISTER_PARAMETER_MACRO("surface", ANARI_ARRAY, surfaces)
   REGISTER_PARAMETER_MACRO("volume", ANARI_ARRAY, volumes)
+  REGISTER_PARAMETER_MACRO("usd::instancing", ANARI_STRING, instancing)
 )
 
 constexpr UsdWorld::ComponentPair UsdWorld::componentParamNames[]; // Workaround for C++14's lack of inlining constexpr arrays
@@ -35,22 +38,87 @@ UsdWorld::UsdWorld(const char* name, UsdDevice* device)
 
 UsdWorld::~UsdWorld()
 {
+  for(auto& instance : observedInstances)
+    instance->removeWorldRef(this, true);
+
 #ifdef OBJECT_LIFETIME_EQUALS_USD_LIFETIME
   if(cachedBridge)
     cachedBridge->DeleteWorld(usdHandle);
 #endif
 }
 
+void UsdWorld::commit(UsdDevice* device)
+{
+  BridgedBaseObjectType::commit(device);
+
+  // Before the next flush, so the instances know whether to author their own prims by then
+  updateInstanceRefs(device);
+}
+
 void UsdWorld::remove(UsdDevice* device)
 {
   applyRemoveFunc(device, &UsdBridge::DeleteWorld);
 }
 
+void UsdWorld::observe(UsdBaseObject* caller, UsdDevice* device)
+{
+  if(caller->getType() == ANARI_INSTANCE)
+  {
+    device->addToCommitList(this, true); // No write to read params; just write to USD
+    paramChanged = true;
+  }
+
+  BridgedBaseObjectType::observe(caller, device);
+}
+
+bool UsdWorld::isPointInstancing() const
+{
+  const char* instancing = UsdSharedString::c_str(getReadParams().instancing);
+  return instancing && strEquals(instancing, "pointInstancer");
+}
+
+void UsdWorld::updateInstanceRefs(UsdDevice* device)
+{
+  const UsdWorldData& paramData = getReadParams();
+  bool pointInstancing = isPointInstancing();
+
+  for(auto& instance : observedInstances)
+    instance->removeWorldRef(this, true);
+  observedInstances.clear();
+
+  if(!paramData.instances || paramData.instances->getType() != InstanceType)
+    return;
+
+  UsdInstance* const* instances = reinterpret_cast<UsdInstance* const*>(paramData.instances->getData());
+  uint64_t numInstances = paramData.instances->getLayout().numItems1;
+  for(uint64_t i = 0; i < numInstances; ++i)
+  {
+    if(!instances[i])
+      continue;
+
+    instances[i]->addWorldRef(this, pointInstancing, device);
+    if(pointInstancing)
+      observedInstances.emplace_back(instances[i]);
+  }
+}
+
 bool UsdWorld::deferCommit(UsdDevice* device)
 {
   const UsdWorldData& paramData = getReadParams();
 
-  if(UsdObjectNotInitialized<InstanceUsdType>(paramData.instances) ||
+  // The point instancers only take the groups from the instances, which don't author prims of their own
+  bool instancesNotInitialized = false;
+  if(isPointInstancing() && paramData.instances && paramData.instances->getType() == InstanceType)
+  {
+    const UsdInstance* const* instances = reinterpret_cast<const UsdInstance* const*>(paramData.instances->getData());
+    uint64_t numInstances = paramData.instances->getLayout().numItems1;
+    for(uint64_t i = 0; i < numInstances && !instancesNotInitialized; ++i)
+      instancesNotInitialized = instances[i] && UsdObjectNotInitialized<GroupUsdType>(instances[i]->getReadParams().group);
+  }
+  else
+    instancesNotInitialized = UsdObjectNotInitialized<InstanceUsdType>(paramData.instances);
+
+  if(instancesNotInitialized ||
     UsdObjectNotInitialized<SurfaceUsdType>(paramData.surfaces) || 
     UsdObjectNotInitialized<VolumeUsdType>(paramData.volumes))
   {
@@ -93,9 +161,18 @@ void UsdWorld::doCommitRefs(UsdDevice* device)
 
   UsdLogInfo logInfo(device, this, ANARI_WORLD, this->getName());
 
-  ManageRefArray<InstanceType, ANARIInstance, UsdInstance>(usdHandle, paramData.instances, instancesTimeVarying, timeStep,
-    instanceHandles, instanceableValues, &UsdBridge::SetInstanceRefs, &UsdBridge::DeleteInstanceRefs,
-    usdBridge, logInfo, "UsdWorld commit failed: 'instance' array elements should be of type ANARI_INSTANCE");
+  const char* instancing = UsdSharedString::c_str(paramData.instancing);
+  bool pointInstancing = isPointInstancing();
+  if(instancing && !pointInstancing && !strEquals(instancing, "reference"))
+    reportStatusThroughDevice(logInfo, ANARI_SEVERITY_WARNING, ANARI_STATUS_INVALID_ARGUMENT,
+      "UsdWorld '%s' usd::instancing should be \"reference\" or \"pointInstancer\", defaulting to reference.", objName);
+
+  if(pointInstancing)
+    commitInstancers(device, instancesTimeVarying, timeStep, logInfo);
+  else
+    ManageRefArray<InstanceType, ANARIInstance, UsdInstance>(usdHandle, paramData.instances, instancesTimeVarying, timeStep,
+      instanceHandles, instanceableValues, &UsdBridge::SetInstanceRefs, &UsdBridge::DeleteInstanceRefs,
+      usdBridge, logInfo, "UsdWorld commit failed: 'instance' array elements should be of type ANARI_INSTANCE");
 
   ManageRefArray<SurfaceType, ANARISurface, UsdSurface>(usdHandle, paramData.surfaces, surfacesTimeVarying, timeStep,
     surfaceHandles, instanceableValues, &UsdBridge::SetSurfaceRefs, &UsdBridge::DeleteSurfaceRefs,
@@ -104,4 +181,44 @@ void UsdWorld::doCommitRefs(UsdDevice* device)
   ManageRefArray<VolumeType, ANARIVolume, UsdVolume>(usdHandle, paramData.volumes, volumesTimeVarying, timeStep,
     volumeHandles, instanceableValues, &UsdBridge::SetVolumeRefs, &UsdBridge::DeleteVolumeRefs,
     usdBridge, logInfo, "UsdGroup commit failed: 'volume' array elements should be of type ANARI_VOLUME");
-}
\ No newline at end of file
+}
+
+void UsdWorld::commitInstancers(UsdDevice* device, bool instancesTimeVarying, double timeStep, UsdLogInfo& logInfo)
+{
+  UsdBridge* usdBridge = device->getUsdBridge();
+  const UsdWorldData& paramData = getReadParams();
+
+  if(!AssertArrayType(paramData.instances, InstanceType, logInfo, "UsdWorld commit failed: 'instance' array elements should be of type ANARI_INSTANCE"))
+    return;
+
+  if(!paramData.instances)
+  {
+    usdBridge->DeleteInstanceRefs(usdHandle, instancesTimeVarying, timeStep);
+    return;
+  }
+
+  // Instances are written as point instancers per group, which take the group and transform of each instance; rewritten whenever one of the instances is committed, see observe()
+  const ANARIInstance* instances = reinterpret_cast<const ANARIInstance*>(paramData.instances->getData());
+  uint64_t numInstances = paramData.instances->getLayout().numItems1;
+
+  bool transformsTimeVarying = false;
+  instancerGroupHandles.clear();
+  instancerTransforms.clear();
+  for(uint64_t i = 0; i < numInstances; ++i)
+  {
+    const UsdInstance* usdInstance = reinterpret_cast<const UsdInstance*>(instances[i]);
+    if(!usdInstance)
+      continue;
+
+    const UsdInstanceData& instanceParams = usdInstance->getReadParams();
+    if(!instanceParams.group)
+      continue; // Nothing to instance
+
+    instancerGroupHandles.push_back(instanceParams.group->getUsdHandle());
+    instancerTransforms.insert(instancerTransforms.end(), instanceParams.transform.Data, instanceParams.transform.Data + 16);
+    transformsTimeVarying = transformsTimeVarying || usdInstance->isTransformTimeVarying();
+  }
+
+  usdBridge->SetInstancerRefs(usdHandle, instancerGroupHandles.data(), instancerTransforms.data(), instancerGroupHandles.size(),
+    instancesTimeVarying || transformsTimeVarying, timeStep);
+}
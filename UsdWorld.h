@@ -6,6 +6,7 @@
 #include "UsdBridgedBaseObject.h"
 
 class UsdDataArray;
+class UsdInstance;
 
 enum class UsdWorldComponents
 {
@@ -23,6 +24,7 @@ struct UsdWorldData
   UsdDataArray* instances = nullptr;
   UsdDataArray* surfaces = nullptr;
   UsdDataArray* volumes = nullptr;
+  UsdSharedString* instancing = nullptr; // "reference" (default) or "pointInstancer"
 };
 
 class UsdWorld : public UsdBridgedBaseObject<UsdWorld, UsdWorldData, UsdWorldHandle, UsdWorldComponents>
@@ -31,6 +33,8 @@ class UsdWorld : public UsdBridgedBaseObject<UsdWorld, UsdWorldData, UsdWorldHan
     UsdWorld(const char* name, UsdDevice* device);
     ~UsdWorld();
 
+    void commit(UsdDevice* device) override;
+
     void remove(UsdDevice* device) override;
 
     static constexpr ComponentPair componentParamNames[] = {
@@ -43,9 +47,17 @@ class UsdWorld : public UsdBridgedBaseObject<UsdWorld, UsdWorldData, UsdWorldHan
     bool deferCommit(UsdDevice* device) override;
     bool doCommitData(UsdDevice* device) override;
     void doCommitRefs(UsdDevice* device) override;
+    void commitInstancers(UsdDevice* device, bool instancesTimeVarying, double timeStep, UsdLogInfo& logInfo);
+
+    void observe(UsdBaseObject* caller, UsdDevice* device) override;
+    bool isPointInstancing() const;
+    void updateInstanceRefs(UsdDevice* device);
 
     std::vector<UsdInstanceHandle> instanceHandles; // for convenience
     std::vector<UsdSurfaceHandle> surfaceHandles; // for convenience
     std::vector<UsdVolumeHandle> volumeHandles; // for convenience
     std::vector<int> instanceableValues; // for convenience
+    std::vector<UsdGroupHandle> instancerGroupHandles; // for convenience
+    std::vector<float> instancerTransforms; // for convenience
+    std::vector<helium::IntrusivePtr<UsdInstance>> observedInstances; // Instances written into the point instancers, observed for their commits
 };
\ No newline at end of file
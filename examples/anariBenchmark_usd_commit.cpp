@@ -0,0 +1,150 @@
+// Copyright 2024 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures how committing many objects through the USD device scales.
+// Usage: anariBenchmarkUsdCommit [numObjects (default 100000)] [--no-flush]
+//
+// Reports the time spent in anariCommitParameters for first-time commits,
+// for recommits of objects that are already queued (deduplication),
+// and for the flush of the commit list to USD at anariRenderFrame.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <array>
+#include <chrono>
+#include <vector>
+// anari
+#include "anari/anari_cpp.hpp"
+#include "anari/anari_cpp/ext/std.h"
+
+using vec3 = std::array<float, 3>;
+
+using BenchClock = std::chrono::steady_clock;
+
+static double msSince(BenchClock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+}
+
+void statusFunc(const void *userData,
+    ANARIDevice device,
+    ANARIObject source,
+    ANARIDataType sourceType,
+    ANARIStatusSeverity severity,
+    ANARIStatusCode code,
+    const char *message)
+{
+  (void)userData;
+  (void)device;
+  (void)source;
+  (void)sourceType;
+  (void)code;
+  if (severity == ANARI_SEVERITY_FATAL_ERROR) {
+    fprintf(stderr, "[FATAL] %s\n", message);
+  } else if (severity == ANARI_SEVERITY_ERROR) {
+    fprintf(stderr, "[ERROR] %s\n", message);
+  } else if (severity == ANARI_SEVERITY_WARNING) {
+    fprintf(stderr, "[WARN ] %s\n", message);
+  }
+}
+
+int main(int argc, const char **argv)
+{
+  size_t numObjects = 100000;
+  bool flush = true;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--no-flush") == 0)
+      flush = false;
+    else
+      numObjects = strtoull(argv[i], nullptr, 10);
+  }
+  if (numObjects == 0)
+    numObjects = 1;
+
+  printf("committing %zu geometries and %zu surfaces\n", numObjects, numObjects);
+
+  anari::Library lib = anari::loadLibrary("usd", statusFunc);
+  anari::Device d = anariNewDevice(lib, "default");
+
+  bool outputBinary = true;
+  anari::setParameter(d, d, "usd::serialize.outputBinary", outputBinary);
+  anari::commitParameters(d, d);
+
+  auto mat = anari::newObject<anari::Material>(d, "matte");
+  anari::commitParameters(d, mat);
+
+  std::vector<anari::Geometry> geometries(numObjects);
+  std::vector<anari::Surface> surfaces(numObjects);
+
+  for (size_t i = 0; i < numObjects; ++i) {
+    vec3 position = {float(i % 1000), float((i / 1000) % 1000), float(i / 1000000)};
+    float radius = 0.25f;
+
+    geometries[i] = anari::newObject<anari::Geometry>(d, "sphere");
+    anari::setAndReleaseParameter(
+        d, geometries[i], "vertex.position", anari::newArray1D(d, &position, 1));
+    anari::setParameter(d, geometries[i], "radius", radius);
+
+    surfaces[i] = anari::newObject<anari::Surface>(d);
+    anari::setParameter(d, surfaces[i], "geometry", geometries[i]);
+    anari::setParameter(d, surfaces[i], "material", mat);
+  }
+
+  // First commit of every object, each one enters the commit list
+  auto start = BenchClock::now();
+  for (size_t i = 0; i < numObjects; ++i) {
+    anari::commitParameters(d, geometries[i]);
+    anari::commitParameters(d, surfaces[i]);
+  }
+  double firstCommitMs = msSince(start);
+
+  // Recommit the same objects, which are rejected as already queued
+  start = BenchClock::now();
+  for (size_t i = 0; i < numObjects; ++i) {
+    anari::commitParameters(d, geometries[i]);
+    anari::commitParameters(d, surfaces[i]);
+  }
+  double recommitMs = msSince(start);
+
+  auto world = anari::newObject<anari::World>(d);
+  anari::setAndReleaseParameter(
+      d, world, "surface", anari::newArray1D(d, surfaces.data(), numObjects));
+  anari::commitParameters(d, world);
+
+  auto frame = anari::newObject<anari::Frame>(d);
+  std::array<unsigned int, 2> imgSize = {64, 64};
+  anari::setParameter(d, frame, "size", imgSize);
+  anari::setParameter(d, frame, "channel.color", ANARI_UFIXED8_RGBA_SRGB);
+  anari::setAndReleaseParameter(d, frame, "renderer", anari::newObject<anari::Renderer>(d, "default"));
+  anari::setAndReleaseParameter(d, frame, "camera", anari::newObject<anari::Camera>(d, "perspective"));
+  anari::setParameter(d, frame, "world", world);
+  anari::commitParameters(d, frame);
+
+  double flushMs = 0.0;
+  if (flush) {
+    // The commit list is written to USD when rendering the frame
+    start = BenchClock::now();
+    anari::render(d, frame);
+    anari::wait(d, frame);
+    flushMs = msSince(start);
+  }
+
+  printf("first commit: %10.2f ms (%.3f us/object)\n", firstCommitMs, 1000.0 * firstCommitMs / double(2 * numObjects));
+  printf("recommit:     %10.2f ms (%.3f us/object)\n", recommitMs, 1000.0 * recommitMs / double(2 * numObjects));
+  if (flush)
+    printf("flush:        %10.2f ms (%.3f us/object)\n", flushMs, 1000.0 * flushMs / double(2 * numObjects));
+
+  for (size_t i = 0; i < numObjects; ++i) {
+    anari::release(d, geometries[i]);
+    anari::release(d, surfaces[i]);
+  }
+  anari::release(d, mat);
+  anari::release(d, world);
+  anari::release(d, frame);
+  anari::release(d, d);
+  anari::unloadLibrary(lib);
+
+  return 0;
+}
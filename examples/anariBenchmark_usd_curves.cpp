@@ -0,0 +1,153 @@
+// Copyright 2024 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures the conversion of large streamline geometries by the USD device.
+// Usage: anariBenchmarkUsdCurves [numSegments (default 10000000)] [segmentsPerLine (default 100)] [numThreads (default 0)]
+//
+// Creates one curve and one cylinder geometry from the same indexed polylines, with per-vertex colors
+// and radii, and reports the time spent in the flush at anariRenderFrame, which reorders the curves
+// into USD basis curves and converts the cylinders into sticks. numThreads sets usd::flush.threads.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <vector>
+// anari
+#include "anari/anari_cpp.hpp"
+#include "anari/anari_cpp/ext/std.h"
+
+using vec3 = std::array<float, 3>;
+using vec4 = std::array<float, 4>;
+
+using BenchClock = std::chrono::steady_clock;
+
+static double msSince(BenchClock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+}
+
+void statusFunc(const void *userData,
+    ANARIDevice device,
+    ANARIObject source,
+    ANARIDataType sourceType,
+    ANARIStatusSeverity severity,
+    ANARIStatusCode code,
+    const char *message)
+{
+  (void)userData;
+  (void)device;
+  (void)source;
+  (void)sourceType;
+  (void)code;
+  if (severity == ANARI_SEVERITY_FATAL_ERROR) {
+    fprintf(stderr, "[FATAL] %s\n", message);
+  } else if (severity == ANARI_SEVERITY_ERROR) {
+    fprintf(stderr, "[ERROR] %s\n", message);
+  } else if (severity == ANARI_SEVERITY_WARNING) {
+    fprintf(stderr, "[WARN ] %s\n", message);
+  }
+}
+
+static double renderAndWait(anari::Device d, anari::World world, anari::Surface surface)
+{
+  anari::setAndReleaseParameter(d, world, "surface", anari::newArray1D(d, &surface, 1));
+  anari::commitParameters(d, world);
+
+  auto frame = anari::newObject<anari::Frame>(d);
+  std::array<unsigned int, 2> imgSize = {64, 64};
+  anari::setParameter(d, frame, "size", imgSize);
+  anari::setParameter(d, frame, "channel.color", ANARI_UFIXED8_RGBA_SRGB);
+  anari::setAndReleaseParameter(d, frame, "renderer", anari::newObject<anari::Renderer>(d, "default"));
+  anari::setAndReleaseParameter(d, frame, "camera", anari::newObject<anari::Camera>(d, "perspective"));
+  anari::setParameter(d, frame, "world", world);
+  anari::commitParameters(d, frame);
+
+  auto start = BenchClock::now();
+  anari::render(d, frame);
+  anari::wait(d, frame);
+  double flushMs = msSince(start);
+
+  anari::release(d, frame);
+  return flushMs;
+}
+
+int main(int argc, const char **argv)
+{
+  uint64_t numSegments = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+  uint64_t segmentsPerLine = argc > 2 ? strtoull(argv[2], nullptr, 10) : 100;
+  int numThreads = argc > 3 ? atoi(argv[3]) : 0;
+  if (segmentsPerLine == 0)
+    segmentsPerLine = 1;
+  uint64_t numLines = (numSegments + segmentsPerLine - 1) / segmentsPerLine;
+  numSegments = numLines * segmentsPerLine;
+  uint64_t numVertices = numLines * (segmentsPerLine + 1);
+
+  printf("converting %llu segments in %llu lines (%llu vertices), usd::flush.threads %d\n",
+      (unsigned long long)numSegments, (unsigned long long)numLines, (unsigned long long)numVertices, numThreads);
+
+  // Helical streamlines, indexed by segment start
+  std::vector<vec3> positions(numVertices);
+  std::vector<vec4> colors(numVertices);
+  std::vector<float> radii(numVertices);
+  std::vector<uint32_t> indices(numSegments);
+  for (uint64_t line = 0; line < numLines; ++line) {
+    float cx = float(line % 1000), cy = float(line / 1000);
+    for (uint64_t v = 0; v <= segmentsPerLine; ++v) {
+      uint64_t vertIdx = line * (segmentsPerLine + 1) + v;
+      float t = float(v) / float(segmentsPerLine);
+      positions[vertIdx] = {cx + 0.3f * std::cos(t * 12.0f), cy + 0.3f * std::sin(t * 12.0f), t * 10.0f};
+      colors[vertIdx] = {t, 1.0f - t, 0.5f, 1.0f};
+      radii[vertIdx] = 0.02f + 0.01f * t;
+      if (v < segmentsPerLine)
+        indices[line * segmentsPerLine + v] = uint32_t(vertIdx);
+    }
+  }
+
+  anari::Library lib = anari::loadLibrary("usd", statusFunc);
+  anari::Device d = anariNewDevice(lib, "default");
+
+  bool outputBinary = true;
+  anari::setParameter(d, d, "usd::serialize.outputBinary", outputBinary);
+  anari::setParameter(d, d, "usd::flush.threads", numThreads);
+  anari::commitParameters(d, d);
+
+  auto mat = anari::newObject<anari::Material>(d, "matte");
+  anari::setParameter(d, mat, "color", "color");
+  anari::commitParameters(d, mat);
+
+  const char *geomTypes[] = {"curve", "cylinder"};
+  for (const char *geomType : geomTypes) {
+    auto start = BenchClock::now();
+    auto geom = anari::newObject<anari::Geometry>(d, geomType);
+    anari::setAndReleaseParameter(d, geom, "vertex.position", anari::newArray1D(d, positions.data(), numVertices));
+    anari::setAndReleaseParameter(d, geom, "vertex.color", anari::newArray1D(d, colors.data(), numVertices));
+    anari::setAndReleaseParameter(d, geom, "vertex.radius", anari::newArray1D(d, radii.data(), numVertices));
+    anari::setAndReleaseParameter(d, geom, "primitive.index", anari::newArray1D(d, indices.data(), numSegments));
+    anari::commitParameters(d, geom);
+
+    auto surface = anari::newObject<anari::Surface>(d);
+    anari::setParameter(d, surface, "geometry", geom);
+    anari::setParameter(d, surface, "material", mat);
+    anari::commitParameters(d, surface);
+    double commitMs = msSince(start);
+
+    auto world = anari::newObject<anari::World>(d);
+    double flushMs = renderAndWait(d, world, surface);
+
+    printf("%-8s commit: %10.2f ms  flush: %10.2f ms (%.3f ns/segment)\n", geomType, commitMs, flushMs,
+        1.0e6 * flushMs / double(numSegments));
+
+    anari::release(d, geom);
+    anari::release(d, surface);
+    anari::release(d, world);
+  }
+
+  anari::release(d, mat);
+  anari::release(d, d);
+  anari::unloadLibrary(lib);
+
+  return 0;
+}
@@ -0,0 +1,174 @@
+// Copyright 2024 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Compares the primvar conversion kernels of ubutils against the per-element scalar loops they replaced,
+// checking that both produce bitwise identical output.
+// Usage: usdBridgeBenchmarkKernels [numElements (default 4000000)] [numRepeats (default 10)]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <limits>
+#include <vector>
+
+#include "UsdBridgeUtils.h"
+
+using BenchClock = std::chrono::steady_clock;
+
+static double msSince(BenchClock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+}
+
+// Scalar reference loops, as previously used by the USD writer
+
+template<typename InputEltType>
+static void scalarExpandToColor(const InputEltType* input, int numComponents, size_t numElements, float* output)
+{
+  for (size_t i = 0; i < numElements; ++i) {
+    float* out = output + i * 4;
+    out[0] = float(input[i * numComponents]);
+    out[1] = numComponents > 1 ? float(input[i * numComponents + 1]) : 0.0f;
+    out[2] = numComponents > 2 ? float(input[i * numComponents + 2]) : 0.0f;
+    out[3] = numComponents > 3 ? float(input[i * numComponents + 3]) : 1.0f;
+  }
+}
+
+template<typename InputEltType>
+static void scalarExpandToColorNormalize(const InputEltType* input, int numComponents, size_t numElements, float* output)
+{
+  double normFactor = 1.0 / (double)std::numeric_limits<InputEltType>::max();
+  for (size_t i = 0; i < numElements; ++i) {
+    float* out = output + i * 4;
+    out[0] = float(input[i * numComponents] * normFactor);
+    out[1] = numComponents > 1 ? float(input[i * numComponents + 1] * normFactor) : 0.0f;
+    out[2] = numComponents > 2 ? float(input[i * numComponents + 2] * normFactor) : 0.0f;
+    out[3] = numComponents > 3 ? float(input[i * numComponents + 3] * normFactor) : 1.0f;
+  }
+}
+
+static void scalarExpandSrgbToColor(const uint8_t* input, size_t numElements, float* output) // 4 components
+{
+  float normFactor = 1.0f / 255.0f;
+  const float* srgbTable = ubutils::SrgbToLinearTable();
+  for (size_t i = 0; i < numElements; ++i) {
+    float* out = output + i * 4;
+    out[0] = srgbTable[input[i * 4]];
+    out[1] = srgbTable[input[i * 4 + 1]];
+    out[2] = srgbTable[input[i * 4 + 2]];
+    out[3] = input[i * 4 + 3] * normFactor;
+  }
+}
+
+static void scalarExpand1ToVec3(const float* input, size_t numElements, float* output)
+{
+  for (size_t i = 0; i < numElements; ++i) {
+    output[i * 3] = input[i];
+    output[i * 3 + 1] = input[i];
+    output[i * 3 + 2] = input[i];
+  }
+}
+
+static void scalarConvertToFloat(const double* input, size_t numValues, float* output)
+{
+  for (size_t i = 0; i < numValues; ++i)
+    output[i] = float(input[i]);
+}
+
+struct BenchResult
+{
+  double scalarMs = 0.0;
+  double kernelMs = 0.0;
+  bool identical = true;
+};
+
+template<typename ScalarFunc, typename KernelFunc>
+static BenchResult bench(size_t numOutputValues, int numRepeats, const ScalarFunc& scalarFunc, const KernelFunc& kernelFunc)
+{
+  std::vector<float> scalarOut(numOutputValues), kernelOut(numOutputValues);
+  BenchResult result;
+
+  // Warm up, touching the output pages
+  scalarFunc(scalarOut.data());
+  kernelFunc(kernelOut.data());
+  result.identical = memcmp(scalarOut.data(), kernelOut.data(), numOutputValues * sizeof(float)) == 0;
+
+  auto start = BenchClock::now();
+  for (int r = 0; r < numRepeats; ++r)
+    scalarFunc(scalarOut.data());
+  result.scalarMs = msSince(start) / numRepeats;
+
+  start = BenchClock::now();
+  for (int r = 0; r < numRepeats; ++r)
+    kernelFunc(kernelOut.data());
+  result.kernelMs = msSince(start) / numRepeats;
+
+  return result;
+}
+
+static bool report(const char* name, const BenchResult& result)
+{
+  printf("%-32s scalar %9.3f ms  kernel %9.3f ms  speedup %5.2fx  %s\n", name, result.scalarMs, result.kernelMs,
+      result.kernelMs > 0.0 ? result.scalarMs / result.kernelMs : 0.0, result.identical ? "identical" : "MISMATCH");
+  return result.identical;
+}
+
+int main(int argc, const char **argv)
+{
+  size_t numElements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 4000000;
+  int numRepeats = argc > 2 ? atoi(argv[2]) : 10;
+  if (numElements == 0)
+    numElements = 1;
+  if (numRepeats <= 0)
+    numRepeats = 1;
+
+  printf("converting %zu elements, averaged over %d repeats\n", numElements, numRepeats);
+
+  // Deterministic pseudo-random input covering the full value range of every type
+  std::vector<float> floats(numElements * 4);
+  std::vector<double> doubles(numElements * 4);
+  std::vector<uint8_t> bytes(numElements * 4);
+  std::vector<uint16_t> shorts(numElements * 4);
+  std::vector<uint32_t> ints(numElements * 4);
+  uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (size_t i = 0; i < numElements * 4; ++i) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    uint32_t bits = uint32_t(state >> 32);
+    ints[i] = bits;
+    shorts[i] = uint16_t(bits);
+    bytes[i] = uint8_t(bits);
+    doubles[i] = double(bits) / double(0xFFFFFFFFu) * 2.0 - 1.0;
+    floats[i] = float(doubles[i]);
+  }
+
+  bool allIdentical = true;
+
+  allIdentical &= report("ExpandToFloat4 (float3)", bench(numElements * 4, numRepeats,
+      [&](float* out) { scalarExpandToColor(floats.data(), 3, numElements, out); },
+      [&](float* out) { ubutils::ExpandToFloat4(floats.data(), 3, numElements, out); }));
+  allIdentical &= report("ExpandToFloat4 (double3)", bench(numElements * 4, numRepeats,
+      [&](float* out) { scalarExpandToColor(doubles.data(), 3, numElements, out); },
+      [&](float* out) { ubutils::ExpandToFloat4(doubles.data(), 3, numElements, out); }));
+  allIdentical &= report("ExpandToFloat4Normalized (u8x4)", bench(numElements * 4, numRepeats,
+      [&](float* out) { scalarExpandToColorNormalize(bytes.data(), 4, numElements, out); },
+      [&](float* out) { ubutils::ExpandToFloat4Normalized(bytes.data(), 4, numElements, out); }));
+  allIdentical &= report("ExpandToFloat4Normalized (u16x3)", bench(numElements * 4, numRepeats,
+      [&](float* out) { scalarExpandToColorNormalize(shorts.data(), 3, numElements, out); },
+      [&](float* out) { ubutils::ExpandToFloat4Normalized(shorts.data(), 3, numElements, out); }));
+  allIdentical &= report("ExpandToFloat4Normalized (u32x4)", bench(numElements * 4, numRepeats,
+      [&](float* out) { scalarExpandToColorNormalize(ints.data(), 4, numElements, out); },
+      [&](float* out) { ubutils::ExpandToFloat4Normalized(ints.data(), 4, numElements, out); }));
+  allIdentical &= report("ExpandSrgbToFloat4 (u8x4)", bench(numElements * 4, numRepeats,
+      [&](float* out) { scalarExpandSrgbToColor(bytes.data(), numElements, out); },
+      [&](float* out) { ubutils::ExpandSrgbToFloat4(bytes.data(), 4, numElements, out); }));
+  allIdentical &= report("ExpandToFloat3 (float)", bench(numElements * 3, numRepeats,
+      [&](float* out) { scalarExpand1ToVec3(floats.data(), numElements, out); },
+      [&](float* out) { ubutils::ExpandToFloat3(floats.data(), numElements, out); }));
+  allIdentical &= report("ConvertToFloat (double)", bench(numElements * 4, numRepeats,
+      [&](float* out) { scalarConvertToFloat(doubles.data(), numElements * 4, out); },
+      [&](float* out) { ubutils::ConvertToFloat(doubles.data(), numElements * 4, out); }));
+
+  return allIdentical ? 0 : 1;
+}
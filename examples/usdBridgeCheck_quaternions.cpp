@@ -0,0 +1,161 @@
+// Copyright 2024 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Checks ubutils::DirectionsToQuaternionsZ, which converts glyph orientation directions into quaternions,
+// against the GfRotation(z, direction) quaternions it replaces. Covers random directions over a wide range
+// of lengths, (nearly) parallel and antiparallel directions and zero-length directions, for float and double input.
+// Usage: usdBridgeCheckQuaternions [numRandom (default 1000000)]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "UsdBridgeUtils.h"
+
+#include <pxr/base/gf/rotation.h>
+#include <pxr/base/gf/quaternion.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Float precision; the kernel's error against the double-precision GfRotation is about 2e-7
+static const double maxQuatError = 1e-6;
+
+struct CheckResult
+{
+  double maxError = 0.0;
+  size_t worstDir = 0;
+  size_t numFailed = 0;
+  size_t numSkipped = 0;
+};
+
+// Distance between the rotations of two unit quaternions, for which q and -q are equal
+static double quatDistance(const float* quat, const GfQuaternion& ref)
+{
+  const GfVec3d& refIm = ref.GetImaginary();
+  double refQuat[4] = {refIm[0], refIm[1], refIm[2], ref.GetReal()};
+  double minus2 = 0.0, plus2 = 0.0;
+  for (int c = 0; c < 4; ++c) {
+    minus2 += (quat[c] - refQuat[c]) * (quat[c] - refQuat[c]);
+    plus2 += (quat[c] + refQuat[c]) * (quat[c] + refQuat[c]);
+  }
+  return std::sqrt(std::min(minus2, plus2));
+}
+
+template<typename DirType>
+static CheckResult check(const std::vector<DirType>& dirs)
+{
+  size_t numDirs = dirs.size() / 3;
+  std::vector<float> quats(numDirs * 4);
+  ubutils::DirectionsToQuaternionsZ(dirs.data(), numDirs, quats.data());
+
+  CheckResult result;
+  for (size_t i = 0; i < numDirs; ++i) {
+    // Same input as the former writer code, which rotated into the float direction
+    GfVec3f dir((float)dirs[i * 3], (float)dirs[i * 3 + 1], (float)dirs[i * 3 + 2]);
+    double length = GfVec3d(dir).GetLength();
+
+    // GfRotation normalizes the direction and the rotation axis (cross(z, dir)) with a minimum length of 1e-10,
+    // which skews its result if either is shorter, unless the direction is within its parallel threshold
+    double crossLength = std::sqrt(double(dir[0]) * dir[0] + double(dir[1]) * dir[1]);
+    bool parallel = std::fabs(dir[2]) > 0.9999999 * length;
+    if (length > 0.0 && (length < 1e-9 || (crossLength < 1e-9 && !parallel))) {
+      ++result.numSkipped;
+      continue;
+    }
+
+    // Zero-length directions give the identity, which is what GfRotation's (non-unit) quaternion represents as well
+    GfQuaternion ref = GfQuaternion::GetIdentity();
+    if (length > 0.0)
+      ref = GfRotation(GfVec3d(0.0, 0.0, 1.0), GfVec3d(dir)).GetQuaternion().GetNormalized();
+
+    double error = quatDistance(quats.data() + i * 4, ref);
+    if (!(error <= maxQuatError))
+      ++result.numFailed;
+    if (!(error <= result.maxError)) {
+      result.maxError = error;
+      result.worstDir = i;
+    }
+  }
+  return result;
+}
+
+template<typename DirType>
+static bool report(const char* name, const std::vector<DirType>& dirs)
+{
+  CheckResult result = check(dirs);
+  size_t w = result.worstDir;
+  printf("%-20s %8zu directions (%zu skipped), max error %.3g at (%g, %g, %g): %s\n", name, dirs.size() / 3, result.numSkipped,
+      result.maxError, (double)dirs[w * 3], (double)dirs[w * 3 + 1], (double)dirs[w * 3 + 2], result.numFailed ? "FAILED" : "ok");
+  if (result.numFailed)
+    printf("  %zu directions exceed %g\n", result.numFailed, maxQuatError);
+  return result.numFailed == 0;
+}
+
+template<typename DirType>
+static void addDir(std::vector<DirType>& dirs, double x, double y, double z)
+{
+  dirs.push_back(DirType(x));
+  dirs.push_back(DirType(y));
+  dirs.push_back(DirType(z));
+}
+
+template<typename DirType>
+static std::vector<DirType> specialDirections()
+{
+  std::vector<DirType> dirs;
+  for (double scale : {1e-8, 1e-3, 1.0, 5.0, 1e6, 1e20}) {
+    // Axes, including exactly parallel and antiparallel
+    addDir(dirs, 0.0, 0.0, scale);
+    addDir(dirs, 0.0, 0.0, -scale);
+    addDir(dirs, scale, 0.0, 0.0);
+    addDir(dirs, -scale, 0.0, 0.0);
+    addDir(dirs, 0.0, scale, 0.0);
+    addDir(dirs, 0.0, -scale, 0.0);
+    // Off the z axis by angles inside and outside GfRotation's parallel threshold (|cos| > 0.9999999, about 4.5e-4 rad)
+    for (double angle : {1e-6, 1e-4, 4e-4, 5e-4, 1e-3, 1e-2}) {
+      for (double azimuth : {0.0, 0.7, 1.9, 3.1, 4.4, 5.8}) {
+        double s = std::sin(angle) * scale, c = std::cos(angle) * scale;
+        addDir(dirs, s * std::cos(azimuth), s * std::sin(azimuth), c);
+        addDir(dirs, s * std::cos(azimuth), s * std::sin(azimuth), -c);
+      }
+    }
+  }
+  // Zero-length
+  addDir(dirs, 0.0, 0.0, 0.0);
+  addDir(dirs, -0.0, 0.0, -0.0);
+  return dirs;
+}
+
+template<typename DirType>
+static std::vector<DirType> randomDirections(size_t numDirs)
+{
+  std::mt19937_64 rng(1);
+  std::normal_distribution<double> normal;
+  std::vector<DirType> dirs;
+  dirs.reserve(numDirs * 3);
+  for (size_t i = 0; i < numDirs; ++i) {
+    double scale = std::exp(normal(rng) * 4.0);
+    addDir(dirs, normal(rng) * scale, normal(rng) * scale, normal(rng) * scale);
+  }
+  return dirs;
+}
+
+int main(int argc, const char **argv)
+{
+  size_t numRandom = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+
+  bool passed = true;
+  passed &= report("special (float)", specialDirections<float>());
+  passed &= report("special (double)", specialDirections<double>());
+  passed &= report("random (float)", randomDirections<float>(numRandom));
+  passed &= report("random (double)", randomDirections<double>(numRandom));
+
+  printf("%s\n", passed ? "PASSED" : "FAILED");
+  return passed ? 0 : 1;
+}